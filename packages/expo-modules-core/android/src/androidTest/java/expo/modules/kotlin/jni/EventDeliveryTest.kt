@@ -0,0 +1,101 @@
+package expo.modules.kotlin.jni
+
+import com.google.common.truth.Truth
+import expo.modules.kotlin.events.EventDeliveryPolicy
+import expo.modules.kotlin.events.KModuleEventEmitterWrapper
+import io.mockk.mockk
+import org.junit.Test
+import java.lang.ref.WeakReference
+
+class EventDeliveryTest {
+  @Test
+  fun latest_value_should_deliver_only_the_newest_event() = withEventDelivery(EventDeliveryPolicy.LatestValue) { emitter ->
+    emitter.emit("onChange", mapOf("value" to 1))
+    emitter.emit("onChange", mapOf("value" to 2))
+    emitter.emit("onChange", mapOf("value" to 3))
+    Truth.assertThat(deliveredValues()).isEmpty()
+
+    deliverEvents()
+    Truth.assertThat(deliveredValues()).containsExactly(3)
+  }
+
+  @Test
+  fun max_rate_should_hold_events_until_the_interval_passes() = withEventDelivery(EventDeliveryPolicy.MaxRate(0.001)) { emitter ->
+    emitter.emit("onChange", mapOf("value" to 1))
+    deliverEvents()
+    Truth.assertThat(deliveredValues()).containsExactly(1)
+
+    emitter.emit("onChange", mapOf("value" to 2))
+    emitter.emit("onChange", mapOf("value" to 3))
+    deliverEvents()
+    Truth.assertThat(deliveredValues()).containsExactly(1)
+    // The next delivery is requested once the interval passes.
+    Truth.assertThat(scheduledDelays.last()).isGreaterThan(0L)
+  }
+
+  @Test
+  fun batched_should_deliver_all_events_at_once() = withEventDelivery(EventDeliveryPolicy.Batched) { emitter ->
+    emitter.emit("onChange", mapOf("value" to 1))
+    emitter.emit("onChange", mapOf("value" to 2))
+    deliverEvents()
+
+    val batches = evaluateScript("JSON.stringify(global.batches)").getString()
+    Truth.assertThat(batches).isEqualTo("[[{\"value\":1},{\"value\":2}]]")
+  }
+
+  @Test
+  fun delivery_should_be_scheduled_once_for_coalesced_events() = withEventDelivery(EventDeliveryPolicy.LatestValue) { emitter ->
+    emitter.emit("onChange", mapOf("value" to 1))
+    emitter.emit("onChange", mapOf("value" to 2))
+    Truth.assertThat(scheduledDelays).containsExactly(0L)
+  }
+
+  private class EventDeliveryTestContext(
+    val testContext: SingleTestContext,
+    val scheduledDelays: List<Long>
+  ) {
+    fun evaluateScript(script: String) = testContext.evaluateScript(script)
+
+    fun deliverEvents() {
+      testContext.jsiInterop.deliverPendingEvents()
+      testContext.jsiInterop.drainJSEventLoop()
+    }
+
+    fun deliveredValues(): List<Int> {
+      val values = evaluateScript("global.values").getArray()
+      return values.map { it.getInt() }
+    }
+  }
+
+  private inline fun withEventDelivery(
+    policy: EventDeliveryPolicy,
+    crossinline block: EventDeliveryTestContext.(emitter: KModuleEventEmitterWrapper) -> Unit
+  ) = withSingleModule({
+    Events("onChange")
+    EventDelivery("onChange", policy)
+  }) {
+    // Events are delivered manually, so the JS code doesn't run on the main thread.
+    val scheduledDelays = mutableListOf<Long>()
+    jsiInterop.eventDeliveryScheduler = { scheduledDelays.add(it) }
+
+    evaluateScript(
+      """
+      global.values = [];
+      global.batches = [];
+      $moduleRef.addListener('onChange', (payload) => {
+        if (Array.isArray(payload)) {
+          global.batches.push(payload);
+        } else {
+          global.values.push(payload.value);
+        }
+      });
+      """.trimIndent()
+    )
+
+    val moduleHolder = requireNotNull(
+      jsiInterop.runtimeContextHolder.get()?.registry?.getModuleHolder("TestModule")
+    )
+    val emitter = KModuleEventEmitterWrapper(moduleHolder, mockk(relaxed = true), WeakReference(null))
+    block(EventDeliveryTestContext(this, scheduledDelays), emitter)
+  }
+}
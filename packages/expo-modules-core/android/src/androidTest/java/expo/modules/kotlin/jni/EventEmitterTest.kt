@@ -1,6 +1,9 @@
+@file:OptIn(ExperimentalCoroutinesApi::class)
+
 package expo.modules.kotlin.jni
 
 import com.google.common.truth.Truth
+import kotlinx.coroutines.ExperimentalCoroutinesApi
 import org.junit.Test
 
 class EventEmitterTest {
@@ -21,4 +24,62 @@ class EventEmitterTest {
     )
     Truth.assertThat(emittersAreEqual.getBool()).isTrue()
   }
+
+  @Test
+  fun module_should_call_observing_functions_before_they_are_accessed() {
+    var lastOnStartObserving = ""
+    var lastOnStopObserving = ""
+
+    withSingleModule({
+      Events("onChange")
+
+      OnStartObserving("onChange") {
+        lastOnStartObserving = "onChange"
+      }
+
+      OnStopObserving("onChange") {
+        lastOnStopObserving = "onChange"
+      }
+    }) {
+      // `startObserving` and `stopObserving` are never read from JS before the listener is added.
+      evaluateScript("global.subscription = $moduleRef.addListener('onChange', () => {})")
+      methodQueue.testScheduler.advanceUntilIdle()
+      jsiInterop.drainJSEventLoop()
+      Truth.assertThat(lastOnStartObserving).isEqualTo("onChange")
+
+      evaluateScript("global.subscription.remove()")
+      methodQueue.testScheduler.advanceUntilIdle()
+      jsiInterop.drainJSEventLoop()
+      Truth.assertThat(lastOnStopObserving).isEqualTo("onChange")
+    }
+  }
+
+  @Test
+  fun event_emitter_should_ignore_events_that_were_never_listened_to() = withJSIInterop {
+    val listenerCount = evaluateScript(
+      """
+      emitter = new expo.EventEmitter();
+      emitter.emit('neverListenedEvent', 1);
+      emitter.removeListener('neverListenedEvent', () => {});
+      emitter.removeAllListeners('neverListenedEvent');
+      emitter.listenerCount('neverListenedEvent');
+      """.trimIndent()
+    )
+    Truth.assertThat(listenerCount.getInt()).isEqualTo(0)
+  }
+
+  @Test
+  fun event_emitter_should_call_listeners_added_after_emitting_without_listeners() = withJSIInterop {
+    val result = evaluateScript(
+      """
+      emitter = new expo.EventEmitter();
+      emitter.emit('lateListenedEvent', 1);
+      result = 0;
+      emitter.addListener('lateListenedEvent', (value) => result += value);
+      emitter.emit('lateListenedEvent', 2);
+      result;
+      """.trimIndent()
+    )
+    Truth.assertThat(result.getInt()).isEqualTo(2)
+  }
 }
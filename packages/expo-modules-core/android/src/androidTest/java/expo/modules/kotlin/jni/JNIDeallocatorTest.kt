@@ -19,4 +19,24 @@ class JNIDeallocatorTest {
 
     Truth.assertThat(deallocator.inspectMemory()).contains(moduleObject)
   }
+
+  @Test
+  fun inspect_memory_should_include_references_from_incomplete_batches() = withJSIInterop {
+    val values = List(100) { evaluateScript("({ index: $it })") }
+
+    val deallocator = runtimeContextHolder.get()!!.jniDeallocator
+
+    Truth.assertThat(deallocator.inspectMemory()).containsAtLeastElementsIn(values)
+  }
+
+  @Test
+  fun references_from_incomplete_batches_should_be_deallocated_after_the_runtime() {
+    // Fewer values than a single batch, so they're still buffered when the runtime is destroyed.
+    lateinit var values: List<JavaScriptValue>
+    withJSIInterop(deallocateAfterRuntime = true) {
+      values = List(10) { evaluateScript("({ index: $it })") }
+    }
+
+    Truth.assertThat(values.none { it.isValid() }).isTrue()
+  }
 }
@@ -0,0 +1,67 @@
+package expo.modules.kotlin.jni
+
+import com.google.common.truth.Truth
+import expo.modules.kotlin.jni.decorators.JSDecoratorsBridgingObject
+import expo.modules.kotlin.jni.decorators.JSFunctionsBatch
+import org.junit.Test
+
+class JSFunctionsBatchTest {
+  private val functionsDefinition = inlineModule {
+    Name("Functions")
+    Function("sum") { a: Int, b: Int -> a + b }
+    Function("concat") { a: String, b: List<String> -> a + b.joinToString("") }
+    Function("keys") { values: Map<String, Double> -> values.keys.sorted() }
+    Function("unit") { }
+    AsyncFunction("sumAsync") { a: Double, b: Double -> a + b }
+  }.definition()
+
+  @Test
+  fun batched_functions_should_match_functions_registered_one_by_one() {
+    val objects = mutableMapOf<String, JavaScriptModuleObject>()
+
+    withJSIInterop(
+      inlineModule {
+        Name("TestModule")
+        Function("getObject") { name: String -> objects.getValue(name) }
+      }
+    ) { methodQueue ->
+      val runtimeContext = requireNotNull(runtimeContextHolder.get())
+      fun createObject(name: String, register: JSFunctionsBatch.(JSDecoratorsBridgingObject) -> Unit): JavaScriptModuleObject {
+        val batch = JSFunctionsBatch()
+        functionsDefinition.objectDefinition.functions.forEach { it.appendTo(batch, runtimeContext.appContext, name) }
+        val decorator = JSDecoratorsBridgingObject(runtimeContext.jniDeallocator)
+        batch.register(decorator)
+        return JavaScriptModuleObject(runtimeContext.jniDeallocator, name).apply { decorate(decorator) }
+      }
+      objects["batched"] = createObject("Batched") { registerIn(it) }
+      objects["oneByOne"] = createObject("OneByOne") { registerOneByOneIn(it) }
+
+      val (batched, oneByOne) = listOf("batched", "oneByOne").map { name ->
+        evaluateScript(
+          """
+          (() => {
+            const object = expo.modules.TestModule.getObject('$name');
+            return JSON.stringify({
+              keys: Object.keys(object).sort(),
+              lengths: ['sum', 'concat', 'keys', 'unit', 'sumAsync'].map((key) => object[key].length),
+              sum: object.sum(1, 2),
+              concat: object.concat('a', ['b', 'c']),
+              keysResult: object.keys({ y: 1, x: 2 }),
+              unit: typeof object.unit(),
+            });
+          })()
+          """.trimIndent()
+        ).getString()
+      }
+      Truth.assertThat(batched).isEqualTo(oneByOne)
+      Truth.assertThat(batched).isEqualTo(
+        """{"keys":["concat","keys","sum","sumAsync","unit"],"lengths":[2,2,1,0,2],"sum":3,"concat":"abc","keysResult":["x","y"],"unit":"undefined"}"""
+      )
+
+      val batchedAsync = waitForAsyncFunction(methodQueue, "expo.modules.TestModule.getObject('batched').sumAsync(1.5, 2)")
+      Truth.assertThat(batchedAsync.getDouble()).isEqualTo(3.5)
+      val oneByOneAsync = waitForAsyncFunction(methodQueue, "expo.modules.TestModule.getObject('oneByOne').sumAsync(1.5, 2)")
+      Truth.assertThat(oneByOneAsync.getDouble()).isEqualTo(3.5)
+    }
+  }
+}
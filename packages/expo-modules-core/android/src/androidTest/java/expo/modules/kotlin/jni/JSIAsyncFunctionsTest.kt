@@ -3,6 +3,7 @@
 package expo.modules.kotlin.jni
 
 import com.google.common.truth.Truth
+import expo.modules.kotlin.Promise
 import expo.modules.kotlin.RuntimeContext
 import expo.modules.kotlin.exception.CodedException
 import expo.modules.kotlin.jni.extensions.addSingleQuotes
@@ -13,6 +14,7 @@ import expo.modules.kotlin.types.Enumerable
 import kotlinx.coroutines.ExperimentalCoroutinesApi
 import org.junit.Assert
 import org.junit.Test
+import java.util.concurrent.ConcurrentLinkedQueue
 
 class JSIAsyncFunctionsTest {
   enum class SimpleEnumClass : Enumerable {
@@ -290,4 +292,38 @@ class JSIAsyncFunctionsTest {
     val value = call("getRef", "global.promiseResult").getInt()
     Truth.assertThat(value).isEqualTo(123)
   }
+
+  @Test
+  fun promises_settled_from_many_threads_should_all_be_delivered() {
+    val promises = ConcurrentLinkedQueue<Promise>()
+    withSingleModule({
+      AsyncFunction("deferred") { promise: Promise ->
+        promises.add(promise)
+      }
+    }) {
+      val count = 1000
+      evaluateScript(
+        "global.settled = 0",
+        "for (let i = 0; i < $count; i++) { $moduleRef.deferred().then(() => global.settled++) }"
+      )
+      methodQueue.testScheduler.advanceUntilIdle()
+      Truth.assertThat(promises).hasSize(count)
+
+      // The testing call invoker runs a drain right away on the thread that schedules it.
+      // Producers race with each other and with those drains, which must never overlap or miss a settlement.
+      val producers = List(8) {
+        Thread {
+          while (true) {
+            val promise = promises.poll() ?: break
+            promise.resolve(null)
+          }
+        }
+      }
+      producers.forEach { it.start() }
+      producers.forEach { it.join() }
+      jsiInterop.drainJSEventLoop()
+
+      Truth.assertThat(evaluateScript("global.settled").getInt()).isEqualTo(count)
+    }
+  }
 }
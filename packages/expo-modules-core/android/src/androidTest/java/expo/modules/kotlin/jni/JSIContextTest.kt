@@ -85,4 +85,22 @@ class JSIContextTest {
     val unboxedI1Value = i1Value.getInt()
     Truth.assertThat(unboxedI1Value).isEqualTo(123)
   }
+
+  @Test
+  fun members_should_be_available_after_other_member_was_accessed() = withSingleModule({
+    Name("TestModule")
+    Constants("c1" to 123)
+    Function("f") { 321 }
+    Property("p") { "p" }
+  }) {
+    val c1Value = evaluateScript("$moduleRef.c1").getInt()
+    val fValue = evaluateScript("$moduleRef.f()").getInt()
+    val keys = evaluateScript("Object.keys($moduleRef)")
+      .getArray()
+      .map { it.getString() }
+
+    Truth.assertThat(c1Value).isEqualTo(123)
+    Truth.assertThat(fValue).isEqualTo(321)
+    Truth.assertThat(keys).containsAtLeast("c1", "f", "p")
+  }
 }
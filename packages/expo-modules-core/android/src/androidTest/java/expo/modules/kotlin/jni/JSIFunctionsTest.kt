@@ -57,6 +57,85 @@ class JSIFunctionsTest {
     Truth.assertThat(longValue).isEqualTo(21474836470)
   }
 
+  @Test
+  fun primitive_signatures_should_be_callable() = withSingleModule({
+    Function("mixedF") { a: Int, b: Double, c: Boolean, d: String, e: Long, f: Float ->
+      "$a $b $c $d $e $f"
+    }
+    Function("sumF") { a: Int, b: Int -> a + b }
+    Function("notF") { a: Boolean -> !a }
+    Function("voidF") { _: Double -> }
+    Function("nullableF") { a: String -> a.takeIf { it.isNotEmpty() } }
+  }) {
+    val mixedValue = call("mixedF", "1, 2.5, true, 'expo', 21474836470, 0.5").getString()
+    val sumValue = call("sumF", "2, 3").getInt()
+    val notValue = call("notF", "false").getBool()
+    val voidValue = call("voidF", "1")
+    val nullableValue = call("nullableF", "''")
+
+    Truth.assertThat(mixedValue).isEqualTo("1 2.5 true expo 21474836470 0.5")
+    Truth.assertThat(sumValue).isEqualTo(5)
+    Truth.assertThat(notValue).isEqualTo(true)
+    Truth.assertThat(voidValue.isUndefined()).isTrue()
+    Truth.assertThat(nullableValue.isNull()).isTrue()
+  }
+
+  @Test
+  fun primitive_signatures_should_accept_optional_arguments() = withSingleModule({
+    Function("optionalF") { a: Int? -> a ?: -1 }
+  }) {
+    val nullValue = call("optionalF", "null").getInt()
+    val missingValue = call("optionalF").getInt()
+    val value = call("optionalF", "10").getInt()
+
+    Truth.assertThat(nullValue).isEqualTo(-1)
+    Truth.assertThat(missingValue).isEqualTo(-1)
+    Truth.assertThat(value).isEqualTo(10)
+  }
+
+  @Test
+  fun typed_results_should_be_convertible() = withSingleModule({
+    Function("listOfMapsF") {
+      listOf(mapOf("x" to 1.5, "y" to null), mapOf("x" to 2.5))
+    }
+    Function("longsF") { listOf(1L, 21474836470L) }
+    Function("anyF") { listOf<Any?>(1, "expo", listOf(true)) }
+  }) {
+    val listOfMaps = call("listOfMapsF").getArray()
+    val longs = call("longsF").getArray()
+    val anyList = call("anyF").getArray()
+
+    Truth.assertThat(listOfMaps).hasLength(2)
+    Truth.assertThat(listOfMaps[0].getObject().getProperty("x").getDouble()).isEqualTo(1.5)
+    Truth.assertThat(listOfMaps[0].getObject().getProperty("y").isNull()).isTrue()
+    Truth.assertThat(listOfMaps[1].getObject().getProperty("x").getDouble()).isEqualTo(2.5)
+    Truth.assertThat(longs.map { it.getDouble().toLong() }).containsExactly(1L, 21474836470L).inOrder()
+    Truth.assertThat(anyList[0].getInt()).isEqualTo(1)
+    Truth.assertThat(anyList[1].getString()).isEqualTo("expo")
+    Truth.assertThat(anyList[2].getArray()[0].getBool()).isTrue()
+  }
+
+  @Test
+  fun mistyped_results_should_be_convertible() = withSingleModule({
+    Function("mistypedListF") {
+      @Suppress("UNCHECKED_CAST")
+      listOf<Any>(1, "expo", listOf(true)) as List<Double>
+    }
+    Function("mistypedMapF") {
+      @Suppress("UNCHECKED_CAST")
+      mapOf<Any, Any>(1 to "one", "two" to 2.5) as Map<String, Int>
+    }
+  }) {
+    val list = call("mistypedListF").getArray()
+    val map = call("mistypedMapF").getObject()
+
+    Truth.assertThat(list[0].getInt()).isEqualTo(1)
+    Truth.assertThat(list[1].getString()).isEqualTo("expo")
+    Truth.assertThat(list[2].getArray()[0].getBool()).isTrue()
+    Truth.assertThat(map.getProperty("1").getString()).isEqualTo("one")
+    Truth.assertThat(map.getProperty("two").getDouble()).isEqualTo(2.5)
+  }
+
   @Test
   fun simple_list_should_be_convertible() = withSingleModule({
     Function("listF") { a: List<String> -> a }
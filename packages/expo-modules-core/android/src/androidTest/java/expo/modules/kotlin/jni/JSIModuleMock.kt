@@ -44,11 +44,14 @@ private fun defaultAppContextMock(): Pair<AppContext, RuntimeContext> {
 
 /**
  * Sets up a test jsi environment with provided modules.
+ * If [deallocateAfterRuntime] is set, the [JNIDeallocator] is deallocated after the JS runtime is destroyed,
+ * instead of before it.
  */
 @OptIn(ExperimentalCoroutinesApi::class, FrameworkAPI::class)
 internal inline fun withJSIInterop(
   vararg modules: Module,
   numberOfReloads: Int = 1,
+  deallocateAfterRuntime: Boolean = false,
   block: JSIContext.(methodQueue: TestScope) -> Unit
 ) {
   val (appContextMock, runtimeContext) = defaultAppContextMock()
@@ -113,11 +116,18 @@ internal inline fun withJSIInterop(
 
         jsiContext.installJSI(runtimeContext, runtimePtr, callInvokerHolder)
 
-        jniDeallocator.use {
+        if (deallocateAfterRuntime) {
           block(jsiContext, methodQueue)
+        } else {
+          jniDeallocator.use {
+            block(jsiContext, methodQueue)
+          }
         }
       }
     }
+    if (deallocateAfterRuntime) {
+      jniDeallocator.deallocate()
+    }
   }
   Truth.assertWithMessage("Memory leak detected").that(jniDeallocator.inspectMemory()).isEmpty()
 }
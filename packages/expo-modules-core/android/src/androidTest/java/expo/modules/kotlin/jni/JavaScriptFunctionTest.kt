@@ -37,6 +37,41 @@ class JavaScriptFunctionTest {
     Truth.assertThat(result).isEqualTo("expo")
   }
 
+  @Test
+  fun should_be_able_to_accept_primitives() = withJSIInterop {
+    val add = evaluateScript("(a, b) => { return a + b }").getFunction<Double>()
+    Truth.assertThat(add(1.5, 2.0)).isEqualTo(3.5)
+
+    val negate = evaluateScript("(value) => { return !value }").getFunction<Boolean>()
+    Truth.assertThat(negate(true)).isFalse()
+
+    val greet = evaluateScript("(name) => { return 'Hello ' + name }").getFunction<String>()
+    Truth.assertThat(greet("expo")).isEqualTo("Hello expo")
+
+    val double = evaluateScript("(value) => { return value * 2 }").getFunction<Int>()
+    Truth.assertThat(double(21)).isEqualTo(42)
+  }
+
+  @Test
+  fun should_pass_all_positional_args_after_a_primitive() = withJSIInterop {
+    val isSecondArgNull = evaluateScript("(a, b) => { return a === 1 && b === null }").getFunction<Boolean>()
+    Truth.assertThat(isSecondArgNull(1.0, null)).isTrue()
+
+    // The object is an argument, not `this`, unless it's passed as a named argument.
+    val receiver = evaluateScript("global.receiver = { key: 'value' }").getObject()
+    val isBound = evaluateScript("(function () { return this === global.receiver })").getFunction<Boolean>()
+    Truth.assertThat(isBound("expo", receiver)).isFalse()
+    Truth.assertThat(isBound("expo", thisValue = receiver)).isTrue()
+  }
+
+  @Test
+  fun should_be_able_to_be_called_many_times() = withJSIInterop {
+    val function = evaluateScript("(value) => { return [value] }").getFunction<List<Int>>()
+    repeat(3) { index ->
+      Truth.assertThat(function(index)).containsExactly(index)
+    }
+  }
+
   @Test
   fun should_be_accepted_as_a_function_arg() = withSingleModule({
     Function("decorate") { jsFunction: JavaScriptFunction<String> ->
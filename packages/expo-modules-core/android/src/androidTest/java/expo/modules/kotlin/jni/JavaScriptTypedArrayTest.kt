@@ -32,6 +32,33 @@ internal class JavaScriptTypedArrayTest {
     Truth.assertThat(float32TypedArray.kind).isEqualTo(TypedArrayKind.Float32Array)
   }
 
+  @Test
+  fun objects_with_typed_array_prototype_should_not_be_typed_arrays() = withJSIInterop {
+    val fromPrototype = evaluateScript("Object.create(Uint8Array.prototype)")
+    val withConstructor = evaluateScript("({ constructor: Float32Array })")
+    val plainObject = evaluateScript("({ length: 2 })")
+    val withSpoofedBuffer = evaluateScript(
+      """
+      Object.create(Uint8Array.prototype, {
+        buffer: { value: new ArrayBuffer(4) },
+        byteOffset: { value: 0 },
+        byteLength: { value: 1024 }
+      })
+      """.trimIndent()
+    )
+
+    Truth.assertThat(fromPrototype.isTypedArray()).isFalse()
+    Truth.assertThat(withConstructor.isTypedArray()).isFalse()
+    Truth.assertThat(plainObject.isTypedArray()).isFalse()
+    Truth.assertThat(withSpoofedBuffer.isTypedArray()).isFalse()
+  }
+
+  @Test
+  fun other_objects_should_not_be_typed_arrays() = withJSIInterop {
+    Truth.assertThat(evaluateScript("new Date()").isTypedArray()).isFalse()
+    Truth.assertThat(evaluateScript("new (class Foo {})()").isTypedArray()).isFalse()
+  }
+
   @Test
   fun should_be_able_access_elements_via_object_api() = withJSIInterop {
     val typedArray = evaluateScript("new Float32Array([1.2, 3.4])").getTypedArray()
@@ -91,6 +118,17 @@ internal class JavaScriptTypedArrayTest {
     Truth.assertThat(second).isEqualTo(31)
   }
 
+  @Test
+  fun direct_buffer_should_span_only_the_view() = withJSIInterop {
+    val typedArray = evaluateScript("new Int8Array(new Int8Array([1, 2, 3, 4, 5, 6]).buffer, 4)").getTypedArray()
+
+    val buffer = typedArray.toDirectBuffer()
+
+    Truth.assertThat(buffer.capacity()).isEqualTo(2)
+    Truth.assertThat(buffer.get(0)).isEqualTo(5)
+    Truth.assertThat(buffer.get(1)).isEqualTo(6)
+  }
+
   @Test
   fun raw_read() = withJSIInterop {
     val typedArray = evaluateScript("new Int32Array([21, 31])").getTypedArray()
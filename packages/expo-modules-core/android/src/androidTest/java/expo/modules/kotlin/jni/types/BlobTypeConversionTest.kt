@@ -10,6 +10,7 @@ import expo.modules.kotlin.jni.withJSIInterop
 import expo.modules.kotlin.typedarray.Uint8Array
 import kotlinx.coroutines.ExperimentalCoroutinesApi
 import org.junit.Test
+import java.nio.ByteBuffer
 
 class BlobTypeConversionTest {
   @Test
@@ -85,4 +86,112 @@ class BlobTypeConversionTest {
     Truth.assertThat(typedArray[0]).isEqualTo(0x00.toUByte())
     Truth.assertThat(typedArray[1]).isEqualTo(0xff.toUByte())
   }
+
+  @Test
+  fun byteBuffer_should_point_to_js_memory() = withJSIInterop(
+    inlineModule {
+      Name("TestModule")
+      Function("fill") { buffer: ByteBuffer ->
+        Truth.assertThat(buffer.isDirect).isTrue()
+        for (i in 0 until buffer.capacity()) {
+          buffer.put(i, 0x7f)
+        }
+        return@Function buffer.capacity()
+      }
+    }
+  ) {
+    val result = evaluateScript(
+      """
+      const array = new Uint8Array(new ArrayBuffer(8), 2, 4);
+      const size = expo.modules.TestModule.fill(array);
+      [size, ...new Uint8Array(array.buffer)]
+      """.trimIndent()
+    ).getArray().map { it.getInt() }
+    Truth.assertThat(result).containsExactly(4, 0, 0, 0x7f, 0x7f, 0x7f, 0x7f, 0, 0).inOrder()
+  }
+
+  @Test
+  fun byteBuffer_should_be_returned_as_uint8Array() = withJSIInterop(
+    inlineModule {
+      Name("TestModule")
+      Function("create") {
+        ByteBuffer.allocateDirect(2).apply {
+          put(0x00)
+          put(0xff.toByte())
+          rewind()
+        }
+      }
+    }
+  ) {
+    val jsValue = evaluateScript("expo.modules.TestModule.create()")
+    Truth.assertThat(jsValue.isTypedArray()).isTrue()
+    val typedArray = Uint8Array(jsValue.getTypedArray())
+    Truth.assertThat(typedArray.length).isEqualTo(2)
+    Truth.assertThat(typedArray[0]).isEqualTo(0x00.toUByte())
+    Truth.assertThat(typedArray[1]).isEqualTo(0xff.toUByte())
+  }
+
+  @Test
+  fun byteBuffer_should_be_copied_for_async_functions() = withJSIInterop(
+    inlineModule {
+      Name("TestModule")
+      AsyncFunction("echoAsync") { buffer: ByteBuffer ->
+        Truth.assertThat(buffer.isDirect).isTrue()
+        Truth.assertThat(buffer.get(1)).isEqualTo(0xff.toByte())
+        return@AsyncFunction buffer
+      }
+    }
+  ) { methodQueue ->
+    val jsValue = waitForAsyncFunction(methodQueue, "expo.modules.TestModule.echoAsync(new Uint8Array([0x00, 0xff]).buffer)")
+    Truth.assertThat(jsValue.isTypedArray()).isTrue()
+    val typedArray = Uint8Array(jsValue.getTypedArray())
+    Truth.assertThat(typedArray[0]).isEqualTo(0x00.toUByte())
+    Truth.assertThat(typedArray[1]).isEqualTo(0xff.toUByte())
+  }
+
+  @Test
+  fun nested_byteBuffers_should_be_copied_for_async_functions() = withJSIInterop(
+    inlineModule {
+      Name("TestModule")
+      AsyncFunction("sumAsync") { buffers: List<ByteBuffer>, named: Map<String, ByteBuffer> ->
+        (buffers + named.values).sumOf { buffer -> (0 until buffer.capacity()).sumOf { buffer.get(it).toInt() } }
+      }
+    }
+  ) { methodQueue ->
+    // The JS arrays are modified right after the call, so the async body would see zeros if it got the JS memory.
+    val jsValue = waitForAsyncFunction(
+      methodQueue,
+      """
+      (() => {
+        const first = new Uint8Array([1, 2]);
+        const second = new Uint8Array([3]);
+        const promise = expo.modules.TestModule.sumAsync([first], { second });
+        first.fill(0);
+        second.fill(0);
+        return promise;
+      })()
+      """.trimIndent()
+    )
+    Truth.assertThat(jsValue.getInt()).isEqualTo(6)
+  }
+
+  @Test
+  fun returned_byteBuffer_argument_should_be_copied() = withJSIInterop(
+    inlineModule {
+      Name("TestModule")
+      Function("echo") { buffer: ByteBuffer ->
+        buffer
+      }
+    }
+  ) {
+    val result = evaluateScript(
+      """
+      const array = new Uint8Array([1, 2]);
+      const echoed = expo.modules.TestModule.echo(array);
+      array.fill(0);
+      [echoed.buffer === array.buffer ? 1 : 0, ...echoed]
+      """.trimIndent()
+    ).getArray().map { it.getInt() }
+    Truth.assertThat(result).containsExactly(0, 1, 2).inOrder()
+  }
 }
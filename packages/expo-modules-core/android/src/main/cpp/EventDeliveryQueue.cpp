@@ -0,0 +1,160 @@
+// Copyright © 2021-present 650 Industries, Inc. (aka Expo)
+
+#include "EventDeliveryQueue.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace expo {
+
+EventDeliveryQueue::Clock::time_point EventDeliveryQueue::Entry::dueAt() const {
+  if (policy != Policy::MAX_RATE || !lastDeliveredAt.has_value()) {
+    return Clock::time_point::min();
+  }
+  return *lastDeliveredAt + minInterval;
+}
+
+EventDeliveryQueue::EventDeliveryQueue(
+  jsi::Runtime &runtime,
+  std::weak_ptr<react::CallInvoker> jsInvoker,
+  DeliveryScheduler deliveryScheduler
+) : runtime(runtime),
+    jsInvoker(std::move(jsInvoker)),
+    deliveryScheduler(std::move(deliveryScheduler)) {}
+
+void EventDeliveryQueue::enqueue(
+  std::weak_ptr<jsi::Object> target,
+  EventEmitter::EventId eventId,
+  Policy policy,
+  std::chrono::milliseconds minInterval,
+  ArgsProvider argsProvider
+) {
+  std::optional<std::chrono::milliseconds> delay;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto [it, _] = entries.try_emplace(
+      Key{std::move(target), eventId},
+      Entry{policy, minInterval, {}, std::nullopt}
+    );
+    Entry &entry = it->second;
+    entry.policy = policy;
+    entry.minInterval = minInterval;
+
+    if (policy != Policy::BATCHED) {
+      // The replaced event is dropped before its arguments were converted.
+      entry.pending.clear();
+    }
+    entry.pending.push_back(std::move(argsProvider));
+
+    delay = requestDeliveryLocked(entry.dueAt(), Clock::now());
+  }
+
+  if (delay.has_value()) {
+    deliveryScheduler(*delay);
+  }
+}
+
+std::optional<std::chrono::milliseconds> EventDeliveryQueue::requestDeliveryLocked(
+  Clock::time_point at,
+  Clock::time_point now
+) {
+  at = std::max(at, now);
+  if (requestedAt.has_value() && *requestedAt <= at) {
+    // The events will be delivered together with the ones already requested.
+    return std::nullopt;
+  }
+  requestedAt = at;
+  return std::chrono::ceil<std::chrono::milliseconds>(at - now);
+}
+
+void EventDeliveryQueue::deliverPendingEvents() {
+  const auto invoker = jsInvoker.lock();
+  if (invoker == nullptr) {
+    return;
+  }
+
+  invoker->invokeAsync([weakThis = weak_from_this()]() -> void {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->deliver();
+    }
+  });
+}
+
+void EventDeliveryQueue::deliver() {
+  std::vector<Delivery> deliveries;
+  std::optional<std::chrono::milliseconds> delay;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto now = Clock::now();
+    std::optional<Clock::time_point> nextDueAt;
+    requestedAt.reset();
+
+    for (auto it = entries.begin(); it != entries.end();) {
+      Entry &entry = it->second;
+      const auto dueAt = entry.dueAt();
+
+      if (it->first.target.expired() || (entry.pending.empty() && dueAt <= now)) {
+        // The entry doesn't limit the rate of the next events anymore.
+        it = entries.erase(it);
+        continue;
+      }
+      if (!entry.pending.empty()) {
+        if (dueAt > now) {
+          nextDueAt = std::min(nextDueAt.value_or(dueAt), dueAt);
+        } else {
+          deliveries.push_back({it->first.target, it->first.eventId, entry.policy, std::move(entry.pending)});
+          entry.pending.clear();
+          entry.lastDeliveredAt = now;
+        }
+      }
+      ++it;
+    }
+
+    if (nextDueAt.has_value()) {
+      delay = requestDeliveryLocked(*nextDueAt, now);
+    }
+  }
+
+  if (delay.has_value()) {
+    deliveryScheduler(*delay);
+  }
+
+  std::exception_ptr firstError = nullptr;
+  for (auto &delivery: deliveries) {
+    const auto target = delivery.target.lock();
+    if (target == nullptr) {
+      continue;
+    }
+
+    try {
+      std::vector<jsi::Value> args;
+      if (delivery.policy == Policy::BATCHED) {
+        jsi::Array payloads(runtime, delivery.pending.size());
+        for (size_t i = 0; i < delivery.pending.size(); i++) {
+          auto eventArgs = delivery.pending[i](runtime);
+          payloads.setValueAtIndex(
+            runtime,
+            i,
+            eventArgs.empty() ? jsi::Value::undefined() : std::move(eventArgs.front())
+          );
+        }
+        args.emplace_back(std::move(payloads));
+      } else {
+        args = delivery.pending.back()(runtime);
+      }
+
+      EventEmitter::emitEvent(runtime, *target, delivery.eventId, args);
+    } catch (...) {
+      // Other events are still delivered. The first error is rethrown at the end.
+      if (firstError == nullptr) {
+        firstError = std::current_exception();
+      }
+    }
+  }
+
+  if (firstError != nullptr) {
+    std::rethrow_exception(firstError);
+  }
+}
+
+} // namespace expo
@@ -0,0 +1,138 @@
+// Copyright © 2021-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "EventEmitter.h"
+
+#include <ReactCommon/CallInvoker.h>
+#include <jsi/jsi.h>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace jsi = facebook::jsi;
+namespace react = facebook::react;
+
+namespace expo {
+
+/**
+ * Holds native events sent with a delivery policy other than immediate, and delivers them to JS in batches.
+ * Events are kept per target object and event name. All due events are delivered in a single JS task,
+ * which the `DeliveryScheduler` runs at most once per frame. The arguments are converted only when
+ * the event is delivered, so replaced events are never converted.
+ *
+ * `enqueue` can be called from any thread. The queue has to be managed by a shared pointer.
+ */
+class EventDeliveryQueue : public std::enable_shared_from_this<EventDeliveryQueue> {
+public:
+  /**
+   * A cpp version of the `expo.modules.kotlin.events.EventDeliveryPolicy` kinds.
+   */
+  enum class Policy : int {
+    /**
+     * Every event is delivered in its own JS task. Such events don't go through the queue.
+     */
+    IMMEDIATE = 0,
+    /**
+     * Only the latest event is delivered.
+     */
+    LATEST_VALUE = 1,
+    /**
+     * Only the latest event is delivered, and not more often than the minimal interval.
+     */
+    MAX_RATE = 2,
+    /**
+     * All events are delivered at once, with an array of their payloads as the only argument.
+     */
+    BATCHED = 3
+  };
+
+  using ArgsProvider = std::function<std::vector<jsi::Value>(jsi::Runtime &rt)>;
+
+  /**
+   * Asks for `deliverPendingEvents` to be called on the next frame, but not earlier than after the given delay.
+   */
+  using DeliveryScheduler = std::function<void(std::chrono::milliseconds delay)>;
+
+  EventDeliveryQueue(
+    jsi::Runtime &runtime,
+    std::weak_ptr<react::CallInvoker> jsInvoker,
+    DeliveryScheduler deliveryScheduler
+  );
+
+  EventDeliveryQueue(const EventDeliveryQueue &) = delete;
+
+  EventDeliveryQueue &operator=(const EventDeliveryQueue &) = delete;
+
+  void enqueue(
+    std::weak_ptr<jsi::Object> target,
+    EventEmitter::EventId eventId,
+    Policy policy,
+    std::chrono::milliseconds minInterval,
+    ArgsProvider argsProvider
+  );
+
+  /**
+   * Schedules a JS task delivering the due events.
+   */
+  void deliverPendingEvents();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Key {
+    std::weak_ptr<jsi::Object> target;
+    EventEmitter::EventId eventId;
+  };
+
+  struct KeyLess {
+    bool operator()(const Key &lhs, const Key &rhs) const {
+      if (lhs.eventId != rhs.eventId) {
+        return lhs.eventId < rhs.eventId;
+      }
+      return lhs.target.owner_before(rhs.target);
+    }
+  };
+
+  struct Entry {
+    Policy policy;
+    std::chrono::milliseconds minInterval;
+    std::vector<ArgsProvider> pending;
+    std::optional<Clock::time_point> lastDeliveredAt;
+
+    Clock::time_point dueAt() const;
+  };
+
+  struct Delivery {
+    std::weak_ptr<jsi::Object> target;
+    EventEmitter::EventId eventId;
+    Policy policy;
+    std::vector<ArgsProvider> pending;
+  };
+
+  jsi::Runtime &runtime;
+  std::weak_ptr<react::CallInvoker> jsInvoker;
+  DeliveryScheduler deliveryScheduler;
+
+  std::mutex mutex;
+  std::map<Key, Entry, KeyLess> entries;
+  /**
+   * The earliest time the scheduler was asked to deliver the events at.
+   */
+  std::optional<Clock::time_point> requestedAt;
+
+  /**
+   * Asks the scheduler for a delivery at the given time, unless an earlier one was already requested.
+   * Has to be called with the mutex locked. Returns the delay to pass to the scheduler.
+   */
+  std::optional<std::chrono::milliseconds> requestDeliveryLocked(Clock::time_point at, Clock::time_point now);
+
+  void deliver();
+};
+
+} // namespace expo
@@ -30,7 +30,7 @@ ExpoModulesHostObject::~ExpoModulesHostObject() {
 jsi::Value ExpoModulesHostObject::get(jsi::Runtime &runtime, const jsi::PropNameID &name) {
   auto cName = name.utf8(runtime);
 
-  if (!installer->hasModule(cName)) {
+  if (!installer->getModulesIndex()->contains(cName)) {
     modulesCache.erase(cName);
     return jsi::Value::undefined();
   }
@@ -38,9 +38,12 @@ jsi::Value ExpoModulesHostObject::get(jsi::Runtime &runtime, const jsi::PropName
     return jsi::Value(runtime, *cachedObject);
   }
 
+  // Members of the module object are defined on their first access through the lazy object.
+  auto pendingMembers = std::make_shared<std::weak_ptr<JavaScriptModuleObject::PendingMembers>>();
+
   // Create a lazy object for the specific module. It defers initialization of the final module object.
   LazyObject::Shared moduleLazyObject = std::make_shared<LazyObject>(
-    [this, cName](jsi::Runtime &rt) {
+    [this, cName, pendingMembers](jsi::Runtime &rt) {
       // Check if the installer has been deallocated.
       // If so, return nullptr to avoid a "field operation on NULL object" crash.
       // As it's probably the best we can do in this case.
@@ -49,7 +52,17 @@ jsi::Value ExpoModulesHostObject::get(jsi::Runtime &runtime, const jsi::PropName
       }
 
       auto module = installer->getModule(cName);
-      return module->cthis()->getJSIObject(rt);
+      // The module was removed from the registry after the index was created.
+      if (module == nullptr) {
+        return std::shared_ptr<jsi::Object>(nullptr);
+      }
+      auto moduleObject = module->cthis()->getLazilyDecoratedJSIObject(rt);
+      *pendingMembers = module->cthis()->getPendingMembers();
+      return moduleObject;
+    },
+    [pendingMembers](jsi::Runtime &rt, const jsi::PropNameID *name) {
+      auto members = pendingMembers->lock();
+      return members != nullptr && members->decorate(rt, name);
     });
 
   // Save the module's lazy host object for later use.
@@ -68,13 +81,12 @@ void ExpoModulesHostObject::set(jsi::Runtime &runtime, const jsi::PropNameID &na
 }
 
 std::vector<jsi::PropNameID> ExpoModulesHostObject::getPropertyNames(jsi::Runtime &rt) {
-  auto names = installer->getModulesName();
-  size_t size = names->size();
+  auto modulesIndex = installer->getModulesIndex();
   std::vector<jsi::PropNameID> result;
-  result.reserve(size);
-  for (int i = 0; i < size; i++) {
+  result.reserve(modulesIndex->names.size());
+  for (const auto &name: modulesIndex->names) {
     result.push_back(
-      jsi::PropNameID::forUtf8(rt, names->getElement(i)->toStdString())
+      jsi::PropNameID::forUtf8(rt, name)
     );
   }
   return result;
@@ -14,4 +14,58 @@ void JNIDeallocator::addReference(
   method(self(), std::move(jniObject));
 }
 
+void JNIDeallocator::addReferences(
+  jni::alias_ref<jni::JArrayClass<Destructible::javaobject>> jniObjects
+) noexcept {
+  const static auto method = JNIDeallocator::javaClassLocal()
+    ->getMethod<void(jni::alias_ref<jni::JArrayClass<Destructible::javaobject>>)>(
+      "addReferences"
+    );
+  method(self(), jniObjects);
+}
+
+BatchedJNIDeallocator::BatchedJNIDeallocator(
+  jni::alias_ref<JNIDeallocator::javaobject> deallocator
+) : deallocator(jni::make_global(deallocator)) {
+  pendingReferences.reserve(kBatchSize);
+}
+
+void BatchedJNIDeallocator::addReference(
+  jni::alias_ref<Destructible::javaobject> jniObject
+) noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pendingReferences.push_back(jni::make_weak(jniObject));
+    if (pendingReferences.size() < kBatchSize) {
+      return;
+    }
+  }
+  flush();
+}
+
+void BatchedJNIDeallocator::flush() noexcept {
+  std::vector<jni::weak_ref<Destructible::javaobject>> references;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    references.swap(pendingReferences);
+    pendingReferences.reserve(kBatchSize);
+  }
+  if (references.empty()) {
+    return;
+  }
+
+  // Kotlin is called without holding the lock, so other threads can keep adding references in the meantime.
+  auto jniObjects = jni::JArrayClass<Destructible::javaobject>::newArray(references.size());
+  size_t index = 0;
+  for (const auto &reference: references) {
+    auto jniObject = reference.lockLocal();
+    if (jniObject != nullptr) {
+      jniObjects->setElement(index++, jniObject.get());
+    }
+  }
+  if (index > 0) {
+    deallocator->addReferences(jniObjects);
+  }
+}
+
 } // namespace expo
@@ -4,6 +4,9 @@
 
 #include <fbjni/fbjni.h>
 
+#include <mutex>
+#include <vector>
+
 namespace jni = facebook::jni;
 
 namespace expo {
@@ -20,6 +23,35 @@ public:
   void addReference(
     jni::local_ref<Destructible::javaobject> jniObject
   ) noexcept;
+
+  void addReferences(
+    jni::alias_ref<jni::JArrayClass<Destructible::javaobject>> jniObjects
+  ) noexcept;
+};
+
+/**
+ * Passes objects created by the cpp part to the `JNIDeallocator` in batches, instead of calling Kotlin for each of them.
+ * Objects are held weakly until they are flushed, so the ones that were already collected never reach the Kotlin registry.
+ */
+class BatchedJNIDeallocator {
+public:
+  explicit BatchedJNIDeallocator(jni::alias_ref<JNIDeallocator::javaobject> deallocator);
+
+  void addReference(jni::alias_ref<Destructible::javaobject> jniObject) noexcept;
+
+  /**
+   * Passes all pending objects to the `JNIDeallocator`.
+   * Kotlin calls it before the registry is inspected or deallocated.
+   */
+  void flush() noexcept;
+
+private:
+  static constexpr size_t kBatchSize = 64;
+
+  jni::global_ref<JNIDeallocator::javaobject> deallocator;
+
+  std::mutex mutex;
+  std::vector<jni::weak_ref<Destructible::javaobject>> pendingReferences;
 };
 
 } // namespace expo
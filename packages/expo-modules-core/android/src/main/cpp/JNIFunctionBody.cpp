@@ -52,4 +52,67 @@ void JNIAsyncFunctionBody::invoke(
   throwPendingJniExceptionAsCppException();
 }
 
+void JNIPrimitiveFunctionBody::invokeVoid(
+  jobject self,
+  jlongArray primitives,
+  jobjectArray strings
+) {
+  static const auto method = JNIPrimitiveFunctionBody::javaClassLocal()
+    ->getMethod<void(jlongArray, jobjectArray)>(
+      "invokeVoid",
+      "([J[Ljava/lang/String;)V"
+    );
+
+  jni::Environment::current()->CallVoidMethod(self, method.getId(), primitives, strings);
+  throwPendingJniExceptionAsCppException();
+}
+
+jdouble JNIPrimitiveFunctionBody::invokeDouble(
+  jobject self,
+  jlongArray primitives,
+  jobjectArray strings
+) {
+  static const auto method = JNIPrimitiveFunctionBody::javaClassLocal()
+    ->getMethod<jdouble(jlongArray, jobjectArray)>(
+      "invokeDouble",
+      "([J[Ljava/lang/String;)D"
+    );
+
+  auto result = jni::Environment::current()->CallDoubleMethod(self, method.getId(), primitives, strings);
+  throwPendingJniExceptionAsCppException();
+  return result;
+}
+
+jboolean JNIPrimitiveFunctionBody::invokeBoolean(
+  jobject self,
+  jlongArray primitives,
+  jobjectArray strings
+) {
+  static const auto method = JNIPrimitiveFunctionBody::javaClassLocal()
+    ->getMethod<jboolean(jlongArray, jobjectArray)>(
+      "invokeBoolean",
+      "([J[Ljava/lang/String;)Z"
+    );
+
+  auto result = jni::Environment::current()->CallBooleanMethod(self, method.getId(), primitives, strings);
+  throwPendingJniExceptionAsCppException();
+  return result;
+}
+
+jni::local_ref<jni::JString> JNIPrimitiveFunctionBody::invokeString(
+  jobject self,
+  jlongArray primitives,
+  jobjectArray strings
+) {
+  static const auto method = JNIPrimitiveFunctionBody::javaClassLocal()
+    ->getMethod<jni::local_ref<jni::JString>(jlongArray, jobjectArray)>(
+      "invokeString",
+      "([J[Ljava/lang/String;)Ljava/lang/String;"
+    );
+
+  auto result = jni::Environment::current()->CallObjectMethod(self, method.getId(), primitives, strings);
+  throwPendingJniExceptionAsCppException();
+  return jni::adopt_local(static_cast<jni::JniType<jni::JString>>(result));
+}
+
 } // namespace expo
@@ -49,4 +49,41 @@ public:
     jobject promise
   );
 };
+
+/**
+ * A CPP part of the expo.modules.kotlin.jni.JNIPrimitiveFunctionBody class.
+ * It represents the Kotlin's promise-less function whose arguments and result are primitives or strings.
+ * Such a function can be invoked without boxing its arguments into an object array.
+ *
+ * Numbers are passed as raw bits of doubles and booleans as 0 or 1 in the `primitives` array,
+ * strings are passed in the `strings` array. Each argument uses the slot of its index.
+ */
+class JNIPrimitiveFunctionBody : public jni::JavaClass<JNIPrimitiveFunctionBody> {
+public:
+  static auto constexpr kJavaDescriptor = "Lexpo/modules/kotlin/jni/JNIPrimitiveFunctionBody;";
+
+  static void invokeVoid(
+    jobject self,
+    jlongArray primitives,
+    jobjectArray strings
+  );
+
+  static jdouble invokeDouble(
+    jobject self,
+    jlongArray primitives,
+    jobjectArray strings
+  );
+
+  static jboolean invokeBoolean(
+    jobject self,
+    jlongArray primitives,
+    jobjectArray strings
+  );
+
+  static jni::local_ref<jni::JString> invokeString(
+    jobject self,
+    jlongArray primitives,
+    jobjectArray strings
+  );
+};
 } // namespace expo
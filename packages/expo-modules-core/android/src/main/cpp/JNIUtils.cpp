@@ -5,10 +5,36 @@
 #include "JSIUtils.h"
 #include "types/JNIToJSIConverter.h"
 #include <jsi/JSIDynamic.h>
+
+#include <optional>
+#include <string>
 #include "JSIContext.h"
 
 namespace expo {
 
+namespace {
+
+/**
+ Resolves the id of the event name on the calling thread. The name is kept only if nothing has listened to it yet,
+ so the JS thread can look it up again in case a listener was added in the meantime.
+ */
+struct PendingEventName {
+  std::optional<EventEmitter::EventId> eventId;
+  std::string eventName;
+
+  explicit PendingEventName(const std::string &name) : eventId(EventEmitter::findEventName(name)) {
+    if (!eventId) {
+      eventName = name;
+    }
+  }
+
+  std::optional<EventEmitter::EventId> resolve() const {
+    return eventId ? eventId : EventEmitter::findEventName(eventName);
+  }
+};
+
+} // namespace
+
 jsi::Value convertSharedObject(
   jni::local_ref<JSharedObject::javaobject> sharedObject,
   jsi::Runtime &rt,
@@ -16,11 +42,20 @@ jsi::Value convertSharedObject(
 ) {
   int id = sharedObject->getId();
   if (id != 0) {
-    return jsi::Value(rt, *jsiContext->getSharedObject(id)->cthis()->get());
+    auto jsObject = jsiContext->sharedObjectTable->get(rt, id);
+    if (jsObject.has_value()) {
+      return jsi::Value(rt, *jsObject);
+    }
+    auto jsObjectRef = jsiContext->getSharedObject(id);
+    if (jsObjectRef != nullptr) {
+      return jsi::Value(rt, *jsObjectRef->cthis()->get());
+    }
+    // The JavaScript object was already collected, but its release hasn't reached the registry yet.
+    // The native object is treated as released and gets a new JavaScript object below.
   }
 
-  auto jsClass = jsiContext->getJavascriptClass(sharedObject->getClass());
-  if (jsClass == nullptr) {
+  auto prototype = jsiContext->getJavascriptPrototype(rt, sharedObject->getClass());
+  if (prototype == nullptr) {
     // If the shared object is an instance of `ShareRef` and the class was not found,
     // we can create a new JavaScript object with the empty prototype.
     // User didn't register SharedRef using Class component.
@@ -42,14 +77,8 @@ jsi::Value convertSharedObject(
     );
 
   }
-  auto prototype = jsClass
-    ->cthis()
-    ->get()
-    ->getProperty(rt, "prototype")
-    .asObject(rt);
-
   auto objSharedPtr = std::make_shared<jsi::Object>(
-    expo::common::createObjectWithPrototype(rt, &prototype)
+    expo::common::createObjectWithPrototype(rt, prototype.get())
   );
   auto jsObjectInstance = JavaScriptObject::newInstance(
     jsiContext,
@@ -144,22 +173,41 @@ void JNIUtils::emitEventOnJavaScriptModule(
   jni::alias_ref<JavaScriptModuleObject::javaobject> jsiThis,
   jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
   jni::alias_ref<jstring> eventName,
-  jni::alias_ref<jni::JMap<jstring, jobject>> eventBody
+  jni::alias_ref<jni::JMap<jstring, jobject>> eventBody,
+  jint deliveryPolicy,
+  jlong minIntervalMs
 ) {
   auto globalEventBody = jni::make_global(eventBody);
+  ArgsProvider argsProvider = [args = std::move(globalEventBody)](jsi::Runtime &rt) -> std::vector<jsi::Value> {
+    JNIEnv *env = jni::Environment::current();
+
+    auto localArgs = jni::static_ref_cast<jni::JMap<jstring, jobject>>(args);
+    std::vector<jsi::Value> result;
+    result.push_back(convertToJS(env, rt, localArgs));
+    return result;
+  };
+
+  const auto policy = static_cast<EventDeliveryQueue::Policy>(deliveryPolicy);
+  const auto eventDeliveryQueue = std::atomic_load(&jsiContextRef->cthis()->eventDeliveryQueue);
+  // Events that were never listened to aren't interned and go through the immediate path, which looks them up again on the JS thread.
+  const std::optional<EventEmitter::EventId> eventId = EventEmitter::findEventName(eventName->toStdString());
+  if (policy == EventDeliveryQueue::Policy::IMMEDIATE || eventDeliveryQueue == nullptr || !eventId) {
+    JNIUtils::emitEventOnJSIObject(
+      jsiThis->cthis()->getCachedJSIObject(),
+      jsiContextRef,
+      eventName,
+      std::move(argsProvider)
+    );
+    return;
+  }
 
-  JNIUtils::emitEventOnJSIObject(
+  // The body is converted on the JS thread only if the event wasn't replaced by a newer one in the meantime.
+  eventDeliveryQueue->enqueue(
     jsiThis->cthis()->getCachedJSIObject(),
-    jsiContextRef,
-    eventName,
-    [args = std::move(globalEventBody)](jsi::Runtime &rt) -> std::vector<jsi::Value> {
-      JNIEnv *env = jni::Environment::current();
-
-      auto localArgs = jni::static_ref_cast<jni::JMap<jstring, jobject>>(args);
-      std::vector<jsi::Value> result;
-      result.push_back(convertToJS(env, rt, localArgs));
-      return result;
-    }
+    *eventId,
+    policy,
+    std::chrono::milliseconds(minIntervalMs),
+    std::move(argsProvider)
   );
 }
 
@@ -169,18 +217,20 @@ void JNIUtils::emitEventOnJSIObject(
   jni::alias_ref<jstring> eventName,
   ArgsProvider argsProvider
 ) {
-  const std::string name = eventName->toStdString();
+  // The name is looked up on the calling thread, so the JS thread usually only needs to look up the listeners by its id.
+  PendingEventName pendingEventName(eventName->toStdString());
 
   const JSIContext *jsiContext = jsiContextRef->cthis();
 
   jsiContext->runtimeHolder->jsInvoker->invokeAsync([
                                                       jsiContext,
-                                                      name = std::move(name),
+                                                      pendingEventName = std::move(pendingEventName),
                                                       argsProvider = std::move(argsProvider),
                                                       weakThis = std::move(jsiThis)
                                                     ]() {
     std::shared_ptr<jsi::WeakObject> jsWeakThis = weakThis.lock();
-    if (!jsWeakThis) {
+    std::optional<EventEmitter::EventId> eventId = pendingEventName.resolve();
+    if (!jsWeakThis || !eventId) {
       return;
     }
 
@@ -188,7 +238,7 @@ void JNIUtils::emitEventOnJSIObject(
     jsi::Runtime &rt = jsiContext->runtimeHolder->get();
 
     jsi::Object jsThis = jsWeakThis->lock(rt).asObject(rt);
-    EventEmitter::emitEvent(rt, jsThis, name, argsProvider(rt));
+    EventEmitter::emitEvent(rt, jsThis, *eventId, argsProvider(rt));
   });
 }
 
@@ -198,25 +248,26 @@ void JNIUtils::emitEventOnJSIObject(
   jni::alias_ref<jstring> eventName,
   ArgsProvider argsProvider
 ) {
-  const std::string name = eventName->toStdString();
+  PendingEventName pendingEventName(eventName->toStdString());
 
   const JSIContext *jsiContext = jsiContextRef->cthis();
 
   jsiContext->runtimeHolder->jsInvoker->invokeAsync([
                                                       jsiContext,
-                                                      name = std::move(name),
+                                                      pendingEventName = std::move(pendingEventName),
                                                       weakThis = std::move(jsiThis),
                                                       argsProvider = std::move(argsProvider)
                                                     ]() {
     std::shared_ptr<jsi::Object> jsThis = weakThis.lock();
-    if (!jsThis) {
+    std::optional<EventEmitter::EventId> eventId = pendingEventName.resolve();
+    if (!jsThis || !eventId) {
       return;
     }
 
     // TODO(@lukmccall): refactor when jsInvoker receives a runtime as a parameter
     jsi::Runtime &rt = jsiContext->runtimeHolder->get();
 
-    EventEmitter::emitEvent(rt, *jsThis, name, argsProvider(rt));
+    EventEmitter::emitEvent(rt, *jsThis, *eventId, argsProvider(rt));
   });
 }
 } // namespace expo
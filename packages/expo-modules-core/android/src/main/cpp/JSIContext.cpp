@@ -47,8 +47,12 @@ void JSIContext::registerNatives() {
                    makeNativeMethod("global", JSIContext::global),
                    makeNativeMethod("createObject", JSIContext::createObject),
                    makeNativeMethod("drainJSEventLoop", JSIContext::drainJSEventLoop),
+                   makeNativeMethod("invalidateModulesIndex", JSIContext::invalidateModulesIndex),
                    makeNativeMethod("setNativeStateForSharedObject",
                                     JSIContext::jniSetNativeStateForSharedObject),
+                   makeNativeMethod("deliverPendingEvents", JSIContext::deliverPendingEvents),
+                   makeNativeMethod("flushDeallocatorReferences",
+                                    JSIContext::flushDeallocatorReferences),
                  });
 }
 
@@ -95,10 +99,31 @@ void JSIContext::prepareJSIContext(
   jni::alias_ref<JNIDeallocator::javaobject> jniDeallocator,
   std::shared_ptr<react::CallInvoker> callInvoker
 ) noexcept {
-  this->jniDeallocator = jni::make_global(jniDeallocator);
+  this->jniDeallocator = std::make_shared<BatchedJNIDeallocator>(jniDeallocator);
   auto runtime = reinterpret_cast<jsi::Runtime *>(jsRuntimePointer);
   jsRegistry = std::make_unique<JSReferencesCache>(*runtime);
 
+  promiseSettlementQueue = std::make_shared<PromiseSettlementQueue>(callInvoker);
+  sharedObjectTable = std::make_shared<SharedObjectTable>(
+    callInvoker,
+    // We can't predict the order of deallocation of the JSIContext and the SharedObject.
+    // So we need to pass a new ref to retain the JSIContext to make sure it's not deallocated before the SharedObject.
+    [threadSafeRef = threadSafeJThis](const std::vector<SharedObjectTable::ObjectId> &objectIds) {
+      threadSafeRef->use([&objectIds](jni::alias_ref<JSIContext::javaobject> globalRef) {
+        JSIContext::deleteSharedObjects(globalRef, objectIds);
+      });
+    }
+  );
+  std::atomic_store(&eventDeliveryQueue, std::make_shared<EventDeliveryQueue>(
+    *runtime,
+    callInvoker,
+    [threadSafeRef = threadSafeJThis](std::chrono::milliseconds delay) {
+      threadSafeRef->use([delay](jni::alias_ref<JSIContext::javaobject> globalRef) {
+        JSIContext::scheduleEventDelivery(globalRef, delay);
+      });
+    }
+  ));
+
   runtimeHolder = std::make_shared<JavaScriptRuntime>(
     runtime,
     std::move(callInvoker)
@@ -114,12 +139,8 @@ void JSIContext::prepareRuntime() noexcept {
   EventEmitter::installClass(runtime);
   SharedObject::installBaseClass(
     runtime,
-    // We can't predict the order of deallocation of the JSIContext and the SharedObject.
-    // So we need to pass a new ref to retain the JSIContext to make sure it's not deallocated before the SharedObject.
-    [threadSafeRef = threadSafeJThis](const SharedObject::ObjectId objectId) {
-      threadSafeRef->use([objectId](jni::alias_ref<JSIContext::javaobject> globalRef) {
-        JSIContext::deleteSharedObject(globalRef, objectId);
-      });
+    [table = sharedObjectTable](const SharedObject::ObjectId objectId) {
+      table->release(static_cast<SharedObjectTable::ObjectId>(objectId));
     }
   );
   SharedRef::installBaseClass(runtime);
@@ -183,18 +204,6 @@ JSIContext::callGetJavaScriptModulesNames() const {
   return method(javaPart_);
 }
 
-bool JSIContext::callHasModule(const std::string &moduleName) const {
-  if (javaPart_ == nullptr) {
-    throw std::runtime_error("hasModule: JSIContext was prepared to be deallocated.");
-  }
-
-  const static auto method = expo::JSIContext::javaClassLocal()
-    ->getMethod<jboolean(std::string)>(
-      "hasModule"
-    );
-  return (bool) method(javaPart_, moduleName);
-}
-
 jni::local_ref<JavaScriptModuleObject::javaobject>
 JSIContext::getModule(const std::string &moduleName) const {
   return callGetJavaScriptModuleObjectMethod(moduleName);
@@ -204,14 +213,36 @@ jni::local_ref<JavaScriptModuleObject::javaobject> JSIContext::getCoreModule() c
   return callGetCoreModuleObject();
 }
 
-bool JSIContext::hasModule(const std::string &moduleName) const {
-  return callHasModule(moduleName);
-}
-
 jni::local_ref<jni::JArrayClass<jni::JString>> JSIContext::getModulesName() const {
   return callGetJavaScriptModulesNames();
 }
 
+std::shared_ptr<const ModulesIndex> JSIContext::getModulesIndex() {
+  std::lock_guard<std::mutex> lock(modulesIndexMutex);
+  if (modulesIndex != nullptr) {
+    return modulesIndex;
+  }
+
+  auto names = callGetJavaScriptModulesNames();
+  size_t size = names->size();
+  auto index = std::make_shared<ModulesIndex>();
+  index->names.reserve(size);
+  index->lookup.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    auto name = names->getElement(i)->toStdString();
+    index->lookup.insert(name);
+    index->names.push_back(std::move(name));
+  }
+
+  modulesIndex = std::move(index);
+  return modulesIndex;
+}
+
+void JSIContext::invalidateModulesIndex() {
+  std::lock_guard<std::mutex> lock(modulesIndexMutex);
+  modulesIndex.reset();
+}
+
 jni::local_ref<JavaScriptValue::javaobject> JSIContext::evaluateScript(
   jni::JString script
 ) {
@@ -260,19 +291,48 @@ jni::local_ref<JavaScriptObject::javaobject> JSIContext::getSharedObject(
   return method(javaPart_, objectId);
 }
 
-void JSIContext::deleteSharedObject(
+void JSIContext::deleteSharedObjects(
   jni::alias_ref<JSIContext::javaobject> javaObject,
-  int objectId
+  const std::vector<int> &objectIds
 ) {
   if (javaObject == nullptr) {
-    throw std::runtime_error("deleteSharedObject: JSIContext is invalid.");
+    throw std::runtime_error("deleteSharedObjects: JSIContext is invalid.");
   }
 
   const static auto method = expo::JSIContext::javaClassLocal()
-    ->getMethod<void(int)>(
-      "deleteSharedObject"
+    ->getMethod<void(jni::alias_ref<jni::JArrayInt>)>(
+      "deleteSharedObjects"
     );
-  method(javaObject, objectId);
+  auto ids = jni::JArrayInt::newArray(objectIds.size());
+  ids->setRegion(0, (jsize) objectIds.size(), objectIds.data());
+  method(javaObject, ids);
+}
+
+void JSIContext::scheduleEventDelivery(
+  jni::alias_ref<JSIContext::javaobject> javaObject,
+  std::chrono::milliseconds delay
+) {
+  if (javaObject == nullptr) {
+    throw std::runtime_error("scheduleEventDelivery: JSIContext is invalid.");
+  }
+
+  const static auto method = expo::JSIContext::javaClassLocal()
+    ->getMethod<void(jlong)>(
+      "scheduleEventDelivery"
+    );
+  method(javaObject, static_cast<jlong>(delay.count()));
+}
+
+void JSIContext::deliverPendingEvents() {
+  if (auto queue = std::atomic_load(&eventDeliveryQueue)) {
+    queue->deliverPendingEvents();
+  }
+}
+
+void JSIContext::flushDeallocatorReferences() {
+  if (jniDeallocator) {
+    jniDeallocator->flush();
+  }
 }
 
 void JSIContext::registerClass(
@@ -304,13 +364,58 @@ jni::local_ref<JavaScriptObject::javaobject> JSIContext::getJavascriptClass(
   return method(javaPart_, std::move(native));
 }
 
+std::shared_ptr<jsi::Object> JSIContext::getJavascriptPrototype(
+  jsi::Runtime &rt,
+  jni::local_ref<jclass> native
+) {
+  static const auto systemClass = jni::findClassStatic("java/lang/System");
+  static const auto identityHashCode = systemClass
+    ->getStaticMethod<jint(jni::alias_ref<jobject>)>("identityHashCode");
+
+  // Classes can't be hashed by their references, so the identity hash code narrows
+  // the lookup down to a bucket that almost always holds a single class.
+  jint hash = identityHashCode(systemClass, native);
+  auto &bucket = javascriptPrototypes[hash];
+  JNIEnv *env = jni::Environment::current();
+  for (const auto &entry: bucket) {
+    if (env->IsSameObject(entry.native.get(), native.get())) {
+      return entry.prototype;
+    }
+  }
+
+  auto jsClass = getJavascriptClass(native);
+  if (jsClass == nullptr) {
+    return nullptr;
+  }
+
+  auto prototype = std::make_shared<jsi::Object>(
+    jsClass
+      ->cthis()
+      ->get()
+      ->getProperty(rt, "prototype")
+      .asObject(rt)
+  );
+  bucket.push_back({jni::make_global(native), prototype});
+  return prototype;
+}
+
 void JSIContext::prepareForDeallocation() noexcept {
   jsRegistry.reset();
+  promiseSettlementQueue.reset();
+  std::atomic_store(&eventDeliveryQueue, std::shared_ptr<EventDeliveryQueue>());
+  javascriptPrototypes.clear();
+  if (sharedObjectTable) {
+    sharedObjectTable->clear();
+  }
   if (runtimeHolder) {
     unbindJSIContext(runtimeHolder->get());
     runtimeHolder.reset();
   }
-  jniDeallocator.reset();
+  if (jniDeallocator) {
+    // References from an incomplete batch have to reach Kotlin, so `JNIDeallocator.deallocate` can release them.
+    jniDeallocator->flush();
+    jniDeallocator.reset();
+  }
   wasDeallocated_ = true;
 }
 
@@ -320,19 +425,15 @@ void JSIContext::jniSetNativeStateForSharedObject(
 ) noexcept {
   auto nativeState = std::make_shared<expo::SharedObject::NativeState>(
     id,
-    // We can't predict the order of deallocation of the JSIContext and the SharedObject.
-    // So we need to pass a new ref to retain the JSIContext to make sure it's not deallocated before the SharedObject.
-    [threadSafeRef = threadSafeJThis](const SharedObject::ObjectId objectId) {
-      threadSafeRef->use([objectId](jni::alias_ref<JSIContext::javaobject> globalRef) {
-        JSIContext::deleteSharedObject(globalRef, objectId);
-      });
+    [table = sharedObjectTable](const SharedObject::ObjectId objectId) {
+      table->release(static_cast<SharedObjectTable::ObjectId>(objectId));
     }
   );
 
-  jsObject
-    ->cthis()
-    ->get()
-    ->setNativeState(runtimeHolder->get(), std::move(nativeState));
+  jsi::Runtime &rt = runtimeHolder->get();
+  auto jsiObject = jsObject->cthis()->get();
+  jsiObject->setNativeState(rt, std::move(nativeState));
+  sharedObjectTable->add(rt, id, *jsiObject);
 }
 
 bool JSIContext::wasDeallocated() const noexcept {
@@ -10,6 +10,9 @@
 #include "JSReferencesCache.h"
 #include "JNIDeallocator.h"
 #include "ThreadSafeJNIGlobalRef.h"
+#include "PromiseSettlementQueue.h"
+#include "SharedObjectTable.h"
+#include "EventDeliveryQueue.h"
 
 #include <fbjni/fbjni.h>
 #include <jsi/jsi.h>
@@ -30,6 +33,11 @@
 #endif
 
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
@@ -37,6 +45,18 @@ namespace react = facebook::react;
 
 namespace expo {
 
+/**
+ * An immutable snapshot of the modules available in the registry.
+ */
+struct ModulesIndex {
+  std::vector<std::string> names;
+  std::unordered_set<std::string> lookup;
+
+  inline bool contains(const std::string &moduleName) const {
+    return lookup.find(moduleName) != lookup.end();
+  }
+};
+
 /**
  * A JNI wrapper to initialize CPP part of modules and access all data from the module registry.
  */
@@ -79,13 +99,23 @@ public:
    */
   jni::local_ref<JavaScriptModuleObject::javaobject> getModule(const std::string &moduleName) const;
 
-  bool hasModule(const std::string &moduleName) const;
-
   /**
    * Gets names of all available modules.
    */
   jni::local_ref<jni::JArrayClass<jni::JString>> getModulesName() const;
 
+  /**
+   * Gets a snapshot of available modules. It's fetched from Kotlin once
+   * and reused until `invalidateModulesIndex` is called, so lookups of missing modules don't cross JNI.
+   */
+  std::shared_ptr<const ModulesIndex> getModulesIndex();
+
+  /**
+   * Drops the modules snapshot, so it will be fetched again on the next access.
+   * Called from Kotlin when the module registry changes.
+   */
+  void invalidateModulesIndex();
+
   /**
    * Exposes a `JavaScriptRuntime::evaluateScript` function to Kotlin
    */
@@ -125,11 +155,32 @@ public:
     int objectId
   );
 
-  static void deleteSharedObject(
+  /**
+   * Notifies Kotlin that the shared objects were released by JavaScript.
+   */
+  static void deleteSharedObjects(
     jni::alias_ref<JSIContext::javaobject> javaObject,
-    int objectId
+    const std::vector<int> &objectIds
   );
 
+  /**
+   * Asks Kotlin to call `deliverPendingEvents` on the next frame, after the given delay.
+   */
+  static void scheduleEventDelivery(
+    jni::alias_ref<JSIContext::javaobject> javaObject,
+    std::chrono::milliseconds delay
+  );
+
+  /**
+   * Delivers events held by the `eventDeliveryQueue`. Called from Kotlin on the next frame, or after a timeout if no frames are produced.
+   */
+  void deliverPendingEvents();
+
+  /**
+   * Passes objects buffered by the `jniDeallocator` to Kotlin.
+   */
+  void flushDeallocatorReferences();
+
   /**
    * Exposes a `JavaScriptRuntime::drainJSEventLoop` function to Kotlin
    */
@@ -137,13 +188,39 @@ public:
 
   std::shared_ptr<JavaScriptRuntime> runtimeHolder;
   std::unique_ptr<JSReferencesCache> jsRegistry;
-  jni::global_ref<JNIDeallocator::javaobject> jniDeallocator;
+  /**
+   * Registers objects passed to Kotlin in the `JNIDeallocator`, so they are deallocated together with the runtime.
+   */
+  std::shared_ptr<BatchedJNIDeallocator> jniDeallocator;
+  /**
+   * Queue used to settle promises returned from async functions in batches.
+   */
+  std::shared_ptr<PromiseSettlementQueue> promiseSettlementQueue;
+  /**
+   * JavaScript parts of the shared objects, so they can be found without calling Kotlin.
+   */
+  std::shared_ptr<SharedObjectTable> sharedObjectTable;
+  /**
+   * Events that are coalesced, rate-limited or batched before they are delivered to JavaScript.
+   * Events are emitted from any thread, so the pointer has to be accessed with `std::atomic_load` and `std::atomic_store`.
+   */
+  std::shared_ptr<EventDeliveryQueue> eventDeliveryQueue;
 
   void registerClass(jni::local_ref<jclass> native,
                      jni::local_ref<JavaScriptObject::javaobject> jsClass);
 
   jni::local_ref<JavaScriptObject::javaobject> getJavascriptClass(jni::local_ref<jclass> native);
 
+  /**
+   * Gets the prototype of the JavaScript class registered for the given native class.
+   * Prototypes are cached natively after the first lookup.
+   * Returns `nullptr` if the class wasn't registered.
+   */
+  std::shared_ptr<jsi::Object> getJavascriptPrototype(
+    jsi::Runtime &rt,
+    jni::local_ref<jclass> native
+  );
+
   void prepareForDeallocation() noexcept;
 
   bool wasDeallocated() const noexcept;
@@ -163,6 +240,20 @@ private:
 
   bool wasDeallocated_ = false;
 
+  std::mutex modulesIndexMutex;
+  std::shared_ptr<const ModulesIndex> modulesIndex;
+
+  struct JavascriptPrototypeEntry {
+    jni::global_ref<jclass> native;
+    std::shared_ptr<jsi::Object> prototype;
+  };
+
+  /**
+   * Prototypes of registered classes, bucketed by the identity hash code of the native class.
+   * Accessed only from the JS thread.
+   */
+  std::unordered_map<jint, std::vector<JavascriptPrototypeEntry>> javascriptPrototypes;
+
 
   explicit JSIContext(jni::alias_ref<jhybridobject> jThis);
 
@@ -173,8 +264,6 @@ private:
 
   inline jni::local_ref<JavaScriptModuleObject::javaobject> callGetCoreModuleObject() const;
 
-  inline bool callHasModule(const std::string &moduleName) const;
-
   void prepareJSIContext(
     jlong jsRuntimePointer,
     jni::alias_ref<JNIDeallocator::javaobject> jniDeallocator,
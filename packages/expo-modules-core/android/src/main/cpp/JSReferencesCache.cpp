@@ -8,6 +8,12 @@ JSReferencesCache::JSReferencesCache(jsi::Runtime &runtime) {
       runtime.global().getPropertyAsFunction(runtime, "Promise")
     )
   );
+  jsObjectRegistry.emplace(
+    JSKeys::UINT8_ARRAY,
+    std::make_unique<jsi::Object>(
+      runtime.global().getPropertyAsFunction(runtime, "Uint8Array")
+    )
+  );
 }
 
 jsi::PropNameID &JSReferencesCache::getPropNameID(
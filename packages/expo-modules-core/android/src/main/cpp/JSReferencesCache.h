@@ -21,7 +21,8 @@ namespace expo {
 class JSReferencesCache {
 public:
   enum class JSKeys {
-    PROMISE
+    PROMISE,
+    UINT8_ARRAY
   };
 
   explicit JSReferencesCache(jsi::Runtime &runtime);
@@ -21,12 +21,12 @@ namespace expo {
 
 JavaCallback::CallbackContext::CallbackContext(
   jsi::Runtime &rt,
-  std::weak_ptr<react::CallInvoker> jsCallInvokerHolder,
+  std::weak_ptr<PromiseSettlementQueue> settlementQueue,
   std::optional<jsi::Function> resolveHolder,
   std::optional<jsi::Function> rejectHolder
 ) : react::LongLivedObject(rt),
     rt(rt),
-    jsCallInvokerHolder(std::move(jsCallInvokerHolder)),
+    settlementQueue(std::move(settlementQueue)),
     resolveHolder(std::move(resolveHolder)),
     rejectHolder(std::move(rejectHolder)) {}
 
@@ -34,11 +34,11 @@ JavaCallback::CallbackContext::CallbackContext(
 
 JavaCallback::CallbackContext::CallbackContext(
   jsi::Runtime &rt,
-  std::weak_ptr<react::CallInvoker> jsCallInvokerHolder,
+  std::weak_ptr<PromiseSettlementQueue> settlementQueue,
   std::optional<jsi::Function> resolveHolder,
   std::optional<jsi::Function> rejectHolder
 ) : rt(rt),
-    jsCallInvokerHolder(std::move(jsCallInvokerHolder)),
+    settlementQueue(std::move(settlementQueue)),
     resolveHolder(std::move(resolveHolder)),
     rejectHolder(std::move(rejectHolder)) {}
 
@@ -71,6 +71,8 @@ void JavaCallback::registerNatives() {
                    makeNativeMethod("invokeLongArray", JavaCallback::invokeLongArray),
                    makeNativeMethod("invokeFloatArray", JavaCallback::invokeFloatArray),
                    makeNativeMethod("invokeDoubleArray", JavaCallback::invokeDoubleArray),
+                   makeNativeMethod("invokeByteArray", JavaCallback::invokeByteArray),
+                   makeNativeMethod("invokeByteBuffer", JavaCallback::invokeByteBuffer),
                  });
 }
 
@@ -95,13 +97,13 @@ void JavaCallback::invokeJSFunction(
     return;
   }
 
-  const auto jsInvoker = strongCallbackContext->jsCallInvokerHolder.lock();
-  // Call invoker is already released, so we cannot invoke the callback.
-  if (jsInvoker == nullptr) {
+  const auto settlementQueue = strongCallbackContext->settlementQueue.lock();
+  // The JS context is already released, so we cannot invoke the callback.
+  if (settlementQueue == nullptr) {
     return;
   }
 
-  jsInvoker->invokeAsync(
+  settlementQueue->enqueue(
     [
       context = callbackContext,
       argsConverter = std::move(argsConverter),
@@ -228,6 +230,33 @@ void JavaCallback::invokeFloatArray(jni::alias_ref<jni::JArrayFloat> result) {
   invokeJSFunctionForArray(result);
 }
 
+void JavaCallback::invokeByteArray(jni::alias_ref<jni::JArrayByte> result) {
+  // The bytes are copied only once, on the JS thread, straight into the new ArrayBuffer.
+  invokeJSFunction<jni::global_ref<jni::JArrayByte>>(
+    [](
+      jsi::Runtime &rt,
+      jsi::Function &jsFunction,
+      jni::global_ref<jni::JArrayByte> arg
+    ) {
+      jsFunction.call(rt, createUint8Array(rt, arg));
+    },
+    jni::make_global(result)
+  );
+}
+
+void JavaCallback::invokeByteBuffer(jni::alias_ref<jni::JByteBuffer> result) {
+  invokeJSFunction<jni::global_ref<jni::JByteBuffer>>(
+    [](
+      jsi::Runtime &rt,
+      jsi::Function &jsFunction,
+      jni::global_ref<jni::JByteBuffer> arg
+    ) {
+      jsFunction.call(rt, createUint8Array(rt, arg));
+    },
+    jni::make_global(result)
+  );
+}
+
 void JavaCallback::invokeError(jni::alias_ref<jstring> code, jni::alias_ref<jstring> errorMessage) {
   const auto strongCallbackContext = this->callbackContext.lock();
   // The context were deallocated before the callback was invoked.
@@ -235,13 +264,13 @@ void JavaCallback::invokeError(jni::alias_ref<jstring> code, jni::alias_ref<jstr
     return;
   }
 
-  const auto jsInvoker = strongCallbackContext->jsCallInvokerHolder.lock();
-  // Call invoker is already released, so we cannot invoke the callback.
-  if (jsInvoker == nullptr) {
+  const auto settlementQueue = strongCallbackContext->settlementQueue.lock();
+  // The JS context is already released, so we cannot invoke the callback.
+  if (settlementQueue == nullptr) {
     return;
   }
 
-  jsInvoker->invokeAsync(
+  settlementQueue->enqueue(
     [
       context = callbackContext,
       code = code->toStdString(),
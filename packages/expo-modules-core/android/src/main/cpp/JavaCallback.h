@@ -4,9 +4,11 @@
 
 #include "JNIDeallocator.h"
 #include "JSharedObject.h"
+#include "PromiseSettlementQueue.h"
 
 #include <jsi/jsi.h>
 #include <fbjni/fbjni.h>
+#include <fbjni/ByteBuffer.h>
 #include <folly/dynamic.h>
 #include <variant>
 
@@ -34,13 +36,13 @@ public:
   public:
     CallbackContext(
       jsi::Runtime &rt,
-      std::weak_ptr<react::CallInvoker> jsCallInvokerHolder,
+      std::weak_ptr<PromiseSettlementQueue> settlementQueue,
       std::optional<jsi::Function> resolveHolder,
       std::optional<jsi::Function> rejectHolder
     );
 
     jsi::Runtime &rt;
-    std::weak_ptr<react::CallInvoker> jsCallInvokerHolder;
+    std::weak_ptr<PromiseSettlementQueue> settlementQueue;
     std::optional<jsi::Function> resolveHolder;
     std::optional<jsi::Function> rejectHolder;
 
@@ -90,6 +92,9 @@ private:
   void invokeDoubleArray(jni::alias_ref<jni::JArrayDouble> result);
   void invokeFloatArray(jni::alias_ref<jni::JArrayFloat> result);
 
+  void invokeByteArray(jni::alias_ref<jni::JArrayByte> result);
+  void invokeByteBuffer(jni::alias_ref<jni::JByteBuffer> result);
+
   template<class T>
   using ArgsConverter = std::function<void(jsi::Runtime &rt, jsi::Function &jsFunction, T arg)>;
 
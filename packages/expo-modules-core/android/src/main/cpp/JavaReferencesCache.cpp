@@ -34,6 +34,8 @@ JCache::JCache(JNIEnv *env) {
   jIntegerArray = REGISTER_CLASS("[I");
   jLongArray = REGISTER_CLASS("[J");
   jFloatArray = REGISTER_CLASS("[F");
+  jByteArray = REGISTER_CLASS("[B");
+  jByteBuffer = REGISTER_CLASS("java/nio/ByteBuffer");
 
   jCollection = REGISTER_CLASS("java/util/Collection");
   jMap = REGISTER_CLASS("java/util/Map");
@@ -91,6 +93,8 @@ void JCache::unLoad(JNIEnv *env) {
   env->DeleteGlobalRef(jIntegerArray);
   env->DeleteGlobalRef(jLongArray);
   env->DeleteGlobalRef(jFloatArray);
+  env->DeleteGlobalRef(jByteArray);
+  env->DeleteGlobalRef(jByteBuffer);
   env->DeleteGlobalRef(jCollection);
   env->DeleteGlobalRef(jMap);
   env->DeleteGlobalRef(jObject);
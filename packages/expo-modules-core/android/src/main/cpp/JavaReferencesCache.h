@@ -38,6 +38,8 @@ public:
   jclass jIntegerArray;
   jclass jLongArray;
   jclass jFloatArray;
+  jclass jByteArray;
+  jclass jByteBuffer;
 
   jclass jCollection;
   jclass jMap;
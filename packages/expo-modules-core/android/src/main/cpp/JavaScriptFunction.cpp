@@ -11,6 +11,9 @@ namespace expo {
 void JavaScriptFunction::registerNatives() {
   registerHybrid({
                    makeNativeMethod("invoke", JavaScriptFunction::invoke),
+                   makeNativeMethod("invokeWithDoubles", JavaScriptFunction::invokeWithDoubles),
+                   makeNativeMethod("invokeWithBoolean", JavaScriptFunction::invokeWithBoolean),
+                   makeNativeMethod("invokeWithString", JavaScriptFunction::invokeWithString),
                  });
 }
 
@@ -49,23 +52,76 @@ jobject JavaScriptFunction::invoke(
     convertedArgs.push_back(convert(env, rt, std::move(arg)));
   }
 
+  return callAndConvert(rt, jsThis, convertedArgs.data(), size, expectedReturnType);
+}
+
+jobject JavaScriptFunction::invokeWithDoubles(
+  jni::alias_ref<JavaScriptObject::javaobject> jsThis,
+  jni::alias_ref<jni::JArrayDouble> args,
+  jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+) {
+  auto &rt = runtimeHolder.getJSRuntime();
+
+  size_t size = args->size();
+  auto region = args->getRegion(0, static_cast<jsize>(size));
+  std::vector<jsi::Value> convertedArgs;
+  convertedArgs.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    convertedArgs.emplace_back(region[i]);
+  }
+
+  return callAndConvert(rt, jsThis, convertedArgs.data(), size, expectedReturnType);
+}
+
+jobject JavaScriptFunction::invokeWithBoolean(
+  jni::alias_ref<JavaScriptObject::javaobject> jsThis,
+  jboolean arg,
+  jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+) {
+  auto &rt = runtimeHolder.getJSRuntime();
+  const jsi::Value convertedArg(static_cast<bool>(arg));
+  return callAndConvert(rt, jsThis, &convertedArg, 1, expectedReturnType);
+}
+
+jobject JavaScriptFunction::invokeWithString(
+  jni::alias_ref<JavaScriptObject::javaobject> jsThis,
+  jni::alias_ref<jstring> arg,
+  jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+) {
+  auto &rt = runtimeHolder.getJSRuntime();
+  const jsi::Value convertedArg = jsi::String::createFromUtf8(rt, arg->toStdString());
+  return callAndConvert(rt, jsThis, &convertedArg, 1, expectedReturnType);
+}
+
+jobject JavaScriptFunction::callAndConvert(
+  jsi::Runtime &rt,
+  jni::alias_ref<JavaScriptObject::javaobject> jsThis,
+  const jsi::Value *args,
+  size_t count,
+  jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+) {
+  JNIEnv *env = jni::Environment::current();
+  // A copy is kept, because the function may call back into Kotlin and replace the cached converter.
+  const auto converter = getReturnConverter(env, expectedReturnType);
+
   // TODO(@lukmccall): add better error handling
   jsi::Value result = jsThis == nullptr ?
-    jsFunction->call(
-      rt,
-      (const jsi::Value *) convertedArgs.data(),
-      size
-    ) :
-    jsFunction->callWithThis(
-      rt,
-      *(jsThis->cthis()->get()),
-      (const jsi::Value *) convertedArgs.data(),
-      size
-    );
-
-  auto converter = AnyType(jni::make_local(expectedReturnType)).converter;
-  auto convertedResult = converter->convert(rt, env, result);
-  return convertedResult;
+    jsFunction->call(rt, args, count) :
+    jsFunction->callWithThis(rt, *(jsThis->cthis()->get()), args, count);
+
+  // The result is owned by Kotlin and can outlive the JS value, so it can't point to the JS memory.
+  return converter->convertDetached(rt, env, result);
+}
+
+std::shared_ptr<FrontendConverter> JavaScriptFunction::getReturnConverter(
+  JNIEnv *env,
+  jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+) {
+  if (cachedReturnConverter == nullptr || !env->IsSameObject(cachedReturnType.get(), expectedReturnType.get())) {
+    cachedReturnConverter = AnyType(jni::make_local(expectedReturnType)).converter;
+    cachedReturnType = jni::make_global(expectedReturnType);
+  }
+  return cachedReturnConverter;
 }
 
 jni::local_ref<JavaScriptFunction::javaobject> JavaScriptFunction::newInstance(
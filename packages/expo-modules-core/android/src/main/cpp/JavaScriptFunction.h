@@ -6,6 +6,7 @@
 #include "JavaScriptRuntime.h"
 #include "WeakRuntimeHolder.h"
 #include "types/ExpectedType.h"
+#include "types/FrontendConverter.h"
 
 #include <fbjni/fbjni.h>
 #include <jsi/jsi.h>
@@ -53,11 +54,52 @@ private:
   WeakRuntimeHolder runtimeHolder;
   std::shared_ptr<jsi::Function> jsFunction;
 
+  /**
+   * The Kotlin side passes the same `ExpectedType` on every call,
+   * so the converter is resolved only once and reused as long as the type doesn't change.
+   */
+  jni::global_ref<ExpectedType::javaobject> cachedReturnType;
+  std::shared_ptr<FrontendConverter> cachedReturnConverter;
+
   jobject invoke(
     jni::alias_ref<jni::HybridClass<JavaScriptObject, Destructible>::javaobject> jsThis,
     jni::alias_ref<jni::JArrayClass<jni::JObject>> args,
     jni::alias_ref<ExpectedType::javaobject> expectedReturnType
   );
+
+  jobject invokeWithDoubles(
+    jni::alias_ref<jni::HybridClass<JavaScriptObject, Destructible>::javaobject> jsThis,
+    jni::alias_ref<jni::JArrayDouble> args,
+    jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+  );
+
+  jobject invokeWithBoolean(
+    jni::alias_ref<jni::HybridClass<JavaScriptObject, Destructible>::javaobject> jsThis,
+    jboolean arg,
+    jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+  );
+
+  jobject invokeWithString(
+    jni::alias_ref<jni::HybridClass<JavaScriptObject, Destructible>::javaobject> jsThis,
+    jni::alias_ref<jstring> arg,
+    jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+  );
+
+  /**
+   * Calls the function with already converted arguments and converts the result to the expected Kotlin type.
+   */
+  jobject callAndConvert(
+    jsi::Runtime &rt,
+    jni::alias_ref<jni::HybridClass<JavaScriptObject, Destructible>::javaobject> jsThis,
+    const jsi::Value *args,
+    size_t count,
+    jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+  );
+
+  std::shared_ptr<FrontendConverter> getReturnConverter(
+    JNIEnv *env,
+    jni::alias_ref<ExpectedType::javaobject> expectedReturnType
+  );
 };
 
 } // namespace expo
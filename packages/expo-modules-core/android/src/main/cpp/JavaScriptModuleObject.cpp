@@ -19,23 +19,82 @@ void JavaScriptModuleObject::registerNatives() {
                  });
 }
 
+JavaScriptModuleObject::PendingMembers::PendingMembers(std::weak_ptr<jsi::Object> jsObject)
+  : jsObject(std::move(jsObject)) {}
+
+void JavaScriptModuleObject::PendingMembers::add(
+  JSDecorator *decorator,
+  const std::vector<std::string> &names
+) {
+  for (const auto &name: names) {
+    decorators.insert_or_assign(name, decorator);
+  }
+}
+
+bool JavaScriptModuleObject::PendingMembers::decorate(
+  jsi::Runtime &runtime,
+  const jsi::PropNameID *name
+) {
+  auto object = jsObject.lock();
+  if (object == nullptr) {
+    decorators.clear();
+    return false;
+  }
+
+  if (name == nullptr) {
+    auto allDecorators = std::move(decorators);
+    decorators.clear();
+    for (const auto &[memberName, decorator]: allDecorators) {
+      decorator->decorateMember(runtime, *object, memberName);
+    }
+    return false;
+  }
+
+  auto entry = decorators.find(name->utf8(runtime));
+  if (entry != decorators.end()) {
+    // The entry is removed first, so accessing the member while it's being defined doesn't define it again.
+    auto [memberName, decorator] = std::move(*entry);
+    decorators.erase(entry);
+    decorator->decorateMember(runtime, *object, memberName);
+  }
+  return !decorators.empty();
+}
+
 std::shared_ptr<jsi::Object> JavaScriptModuleObject::getJSIObject(jsi::Runtime &runtime) {
+  auto moduleObject = getLazilyDecoratedJSIObject(runtime);
+
+  // The object is used directly, so there is no way to know when its members are accessed.
+  if (pendingMembers) {
+    pendingMembers->decorate(runtime, nullptr);
+  }
+
+  return moduleObject;
+}
+
+std::shared_ptr<jsi::Object> JavaScriptModuleObject::getLazilyDecoratedJSIObject(jsi::Runtime &runtime) {
   if (auto object = jsiObject.lock()) {
     return object;
   }
 
   auto moduleObject = std::make_shared<jsi::Object>(NativeModule::createInstance(runtime));
+  auto members = std::make_shared<PendingMembers>(moduleObject);
 
   for (const auto& decorator : this->decorators) {
-    decorator->decorate(runtime, *moduleObject);
+    members->add(decorator.get(), decorator->decorateLazily(runtime, *moduleObject));
   }
 
+  pendingMembers = std::move(members);
   jsiObject = moduleObject;
   return moduleObject;
 }
 
+std::weak_ptr<JavaScriptModuleObject::PendingMembers> JavaScriptModuleObject::getPendingMembers() {
+  return pendingMembers;
+}
+
 void JavaScriptModuleObject::decorate(jni::alias_ref<JSDecoratorsBridgingObject::javaobject> jsDecoratorsBridgingObject) noexcept {
   this->decorators = jsDecoratorsBridgingObject->cthis()->bridge();
+  pendingMembers.reset();
 }
 
 std::weak_ptr<jsi::Object> JavaScriptModuleObject::getCachedJSIObject() {
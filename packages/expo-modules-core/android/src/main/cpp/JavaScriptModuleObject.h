@@ -7,6 +7,8 @@
 
 #include <vector>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include "decorators/JSDecorator.h"
 
@@ -39,12 +41,40 @@ public:
   static void registerNatives();
 
   /**
-   * Returns a cached instance of jsi::Object representing this module.
+   * Members of the module object that will be defined on their first access, with decorators defining them.
+   */
+  class PendingMembers {
+  public:
+    explicit PendingMembers(std::weak_ptr<jsi::Object> jsObject);
+
+    void add(JSDecorator *decorator, const std::vector<std::string> &names);
+
+    /**
+     * Defines the member with the given name if it's pending, or all pending members if the name is a null pointer.
+     * Returns whether any members are still pending.
+     */
+    bool decorate(jsi::Runtime &runtime, const jsi::PropNameID *name);
+
+  private:
+    std::weak_ptr<jsi::Object> jsObject;
+    std::unordered_map<std::string, JSDecorator *> decorators;
+  };
+
+  /**
+   * Returns a cached instance of jsi::Object representing this module, with all members defined.
    * @param runtime
    * @return Wrapped instance of JavaScriptModuleObject::HostObject
    */
   std::shared_ptr<jsi::Object> getJSIObject(jsi::Runtime &runtime);
 
+  /**
+   * Returns a cached instance of jsi::Object representing this module.
+   * Its members may not be defined yet. They are defined by `PendingMembers` on their first access.
+   */
+  std::shared_ptr<jsi::Object> getLazilyDecoratedJSIObject(jsi::Runtime &runtime);
+
+  std::weak_ptr<PendingMembers> getPendingMembers();
+
   std::weak_ptr<jsi::Object> getCachedJSIObject();
 
   /**
@@ -65,5 +95,10 @@ private:
   std::weak_ptr<jsi::Object> jsiObject;
 
   std::vector<std::unique_ptr<JSDecorator>> decorators;
+
+  /**
+   * Members of the `jsiObject` that aren't defined yet. Refers to the `decorators`, so it's reset when they change.
+   */
+  std::shared_ptr<PendingMembers> pendingMembers;
 };
 } // namespace expo
@@ -56,12 +56,10 @@ int JavaScriptTypedArray::getRawKind() {
 jni::local_ref<jni::JByteBuffer> JavaScriptTypedArray::toDirectBuffer() {
   jsi::Runtime &jsRuntime = runtimeHolder.getJSRuntime();
 
-  auto byteLength = typedArrayWrapper->byteLength(jsRuntime);
-  auto byteOffset = typedArrayWrapper->byteOffset(jsRuntime);
-
+  // `byteLength` doesn't include `byteOffset` - the raw pointer is already shifted by it.
   auto byteBuffer = jni::JByteBuffer::wrapBytes(
     static_cast<uint8_t *>(typedArrayWrapper->getRawPointer(jsRuntime)),
-    byteLength - byteOffset
+    typedArrayWrapper->byteLength(jsRuntime)
   );
 
   byteBuffer->order(jni::JByteOrder::nativeOrder());
@@ -9,6 +9,8 @@
 #include "types/JNIToJSIConverter.h"
 #include "JSReferencesCache.h"
 
+#include <array>
+#include <cstring>
 #include <utility>
 #include <functional>
 #include <unistd.h>
@@ -28,11 +30,10 @@ jni::local_ref<JavaCallback::JavaPart> createJavaCallback(
   jsi::Runtime &rt
 ) {
   JSIContext *jsiContext = getJSIContext(rt);
-  std::shared_ptr<react::CallInvoker> jsInvoker = jsiContext->runtimeHolder->jsInvoker;
 
   std::shared_ptr<JavaCallback::CallbackContext> callbackContext = std::make_shared<JavaCallback::CallbackContext>(
     rt,
-    std::move(jsInvoker),
+    jsiContext->promiseSettlementQueue,
     std::move(resolveFunction),
     std::move(rejectFunction)
   );
@@ -93,7 +94,11 @@ jobjectArray MethodMetadata::convertJSIArgsToJNI(
     auto &type = info.argTypes[argIndex];
 
     if (type->converter->canConvert(rt, arg)) {
-      auto converterValue = type->converter->convert(rt, env, arg);
+      // Async bodies run after the JS call returns, when the JS memory may be already mutated or freed.
+      // That's why they get their own copy instead of buffers pointing to the JS memory, also in nested collections.
+      auto converterValue = info.isAsync
+        ? type->converter->convertDetached(rt, env, arg)
+        : type->converter->convert(rt, env, arg);
       env->SetObjectArrayElement(argumentArray, argIndex, converterValue);
       env->DeleteLocalRef(converterValue);
     } else if (arg.isNull() || arg.isUndefined()) {
@@ -187,6 +192,155 @@ jni::local_ref<jobject> MethodMetadata::callJNISync(
   return result;
 }
 
+void MethodMetadata::setPrimitiveBody(
+  CppType returnType,
+  jni::global_ref<JNIPrimitiveFunctionBody::javaobject> &&primitiveBody
+) {
+  if (info.isAsync || info.takesOwner || info.argTypes.size() > kMaxPrimitiveArgs) {
+    return;
+  }
+  for (const auto &argType: info.argTypes) {
+    switch (argType->combinedTypes) {
+      case CppType::DOUBLE:
+      case CppType::INT:
+      case CppType::LONG:
+      case CppType::FLOAT:
+      case CppType::BOOLEAN:
+      case CppType::STRING:
+        break;
+      default:
+        return;
+    }
+  }
+
+  size_t argsCount = info.argTypes.size();
+  primitiveTrampoline = std::make_unique<PrimitiveTrampoline>();
+  primitiveTrampoline->returnType = returnType;
+  primitiveTrampoline->body = std::move(primitiveBody);
+  primitiveTrampoline->primitives = jni::make_global(jni::JArrayLong::newArray(argsCount));
+  primitiveTrampoline->strings = jni::make_global(
+    jni::JArrayClass<jni::JString>::newArray(argsCount)
+  );
+}
+
+void MethodMetadata::setReturnType(jni::alias_ref<ExpectedType::javaobject> returnType) {
+  if (returnType == nullptr || returnType->getCombinedTypes() == CppType::ANY) {
+    returnTypeConverter = nullptr;
+    return;
+  }
+  returnTypeConverter = std::make_unique<ReturnTypeConverter>(returnType);
+}
+
+std::optional<jsi::Value> MethodMetadata::callPrimitiveSync(
+  JNIEnv *env,
+  jsi::Runtime &rt,
+  const jsi::Value *args,
+  size_t count
+) {
+  // Missing, null or mismatched arguments are handled by the regular path,
+  // which knows how to deal with optional arguments and how to report errors.
+  if (count != info.argTypes.size()) {
+    return std::nullopt;
+  }
+
+  std::array<jlong, kMaxPrimitiveArgs> primitives{};
+  bool hasStrings = false;
+  for (size_t i = 0; i < count; i++) {
+    const jsi::Value &arg = args[i];
+    switch (info.argTypes[i]->combinedTypes) {
+      case CppType::BOOLEAN:
+        if (!arg.isBool()) {
+          return std::nullopt;
+        }
+        primitives[i] = arg.getBool() ? 1 : 0;
+        break;
+      case CppType::STRING:
+        if (!arg.isString()) {
+          return std::nullopt;
+        }
+        hasStrings = true;
+        break;
+      default: {
+        if (!arg.isNumber()) {
+          return std::nullopt;
+        }
+        double number = arg.getNumber();
+        std::memcpy(&primitives[i], &number, sizeof(number));
+        break;
+      }
+    }
+  }
+
+  auto &trampoline = *primitiveTrampoline;
+  bool ownsBuffers = !trampoline.buffersInUse.exchange(true, std::memory_order_acquire);
+  jlongArray primitivesArray = ownsBuffers
+                               ? trampoline.primitives.get()
+                               : jni::JArrayLong::newArray(count).release();
+  jobjectArray stringsArray = ownsBuffers
+                              ? trampoline.strings.get()
+                              : jni::JArrayClass<jni::JString>::newArray(count).release();
+
+  const auto releaseBuffers = [&]() {
+    if (!ownsBuffers) {
+      env->DeleteLocalRef(primitivesArray);
+      env->DeleteLocalRef(stringsArray);
+      return;
+    }
+    // Doesn't keep the last arguments alive until the next call.
+    if (hasStrings) {
+      for (size_t i = 0; i < count; i++) {
+        if (info.argTypes[i]->combinedTypes == CppType::STRING) {
+          env->SetObjectArrayElement(stringsArray, (jsize) i, nullptr);
+        }
+      }
+    }
+    trampoline.buffersInUse.store(false, std::memory_order_release);
+  };
+
+  try {
+    if (count > 0) {
+      env->SetLongArrayRegion(primitivesArray, 0, (jsize) count, primitives.data());
+    }
+    if (hasStrings) {
+      for (size_t i = 0; i < count; i++) {
+        if (info.argTypes[i]->combinedTypes != CppType::STRING) {
+          continue;
+        }
+        jstring string = env->NewStringUTF(args[i].getString(rt).utf8(rt).c_str());
+        env->SetObjectArrayElement(stringsArray, (jsize) i, string);
+        env->DeleteLocalRef(string);
+      }
+    }
+
+    jobject self = trampoline.body.get();
+    std::optional<jsi::Value> result;
+    switch (trampoline.returnType) {
+      case CppType::NONE:
+        JNIPrimitiveFunctionBody::invokeVoid(self, primitivesArray, stringsArray);
+        result = jsi::Value::undefined();
+        break;
+      case CppType::BOOLEAN:
+        result = jsi::Value(
+          static_cast<bool>(JNIPrimitiveFunctionBody::invokeBoolean(self, primitivesArray, stringsArray))
+        );
+        break;
+      case CppType::STRING: {
+        auto string = JNIPrimitiveFunctionBody::invokeString(self, primitivesArray, stringsArray);
+        result = string == nullptr ? jsi::Value::null() : convertToJS(env, rt, string);
+        break;
+      }
+      default:
+        result = jsi::Value(JNIPrimitiveFunctionBody::invokeDouble(self, primitivesArray, stringsArray));
+        break;
+    }
+    releaseBuffers();
+    return result;
+  } catch (...) {
+    releaseBuffers();
+    throw;
+  }
+}
+
 jsi::Value MethodMetadata::callSync(
   jsi::Runtime &rt,
   const jsi::Value &thisValue,
@@ -194,14 +348,27 @@ jsi::Value MethodMetadata::callSync(
   size_t count
 ) {
   JNIEnv *env = jni::Environment::current();
+
+  if (primitiveTrampoline != nullptr) {
+    auto result = callPrimitiveSync(env, rt, args, count);
+    if (result.has_value()) {
+      return std::move(*result);
+    }
+  }
+
   /**
   * This will push a new JNI stack frame for the LocalReferences in this
   * function call. When the stack frame for this lambda is popped,
   * all LocalReferences are deleted.
   */
   jni::JniLocalScope scope(env, (int) count);
+  // Buffers wrapping the arguments are copied if the function returns them.
+  WrappedByteBuffersScope wrappedByteBuffersScope;
 
   auto result = this->callJNISync(env, rt, thisValue, args, count);
+  if (returnTypeConverter != nullptr) {
+    return returnTypeConverter->convert(env, rt, result);
+  }
   return convert(env, rt, result);
 }
 
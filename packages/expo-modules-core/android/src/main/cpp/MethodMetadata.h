@@ -5,12 +5,16 @@
 #include "types/CppType.h"
 #include "types/ExpectedType.h"
 #include "types/AnyType.h"
+#include "JNIFunctionBody.h"
+#include "types/JNIToJSIConverter.h"
 
 #include <jsi/jsi.h>
 #include <fbjni/fbjni.h>
 #include <ReactCommon/TurboModuleUtils.h>
 #include <react/jni/ReadableNativeArray.h>
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <folly/dynamic.h>
 #include <jsi/JSIDynamic.h>
@@ -90,7 +94,54 @@ public:
     size_t count
   );
 
+  /**
+   * Enables the primitive trampoline for this function. When all arguments match the expected
+   * primitive types, the function is invoked through the typed entry point of `primitiveBody`
+   * instead of boxing the arguments and the result.
+   *
+   * Does nothing if the function signature doesn't consist only of primitives and strings.
+   *
+   * @param returnType the cpp type of the result or `CppType::NONE` if the function returns nothing.
+   */
+  void setPrimitiveBody(
+    CppType returnType,
+    jni::global_ref<JNIPrimitiveFunctionBody::javaobject> &&primitiveBody
+  );
+
+  /**
+   * Sets the type of the value returned from the Kotlin body.
+   * Results are then converted without checking the class of each object.
+   */
+  void setReturnType(jni::alias_ref<ExpectedType::javaobject> returnType);
+
 private:
+  /**
+   * The maximum number of arguments supported by the primitive trampoline.
+   */
+  static constexpr size_t kMaxPrimitiveArgs = 16;
+
+  /**
+   * State of the primitive trampoline. See `setPrimitiveBody`.
+   */
+  struct PrimitiveTrampoline {
+    CppType returnType;
+    jni::global_ref<JNIPrimitiveFunctionBody::javaobject> body;
+    /**
+     * Argument arrays allocated once and reused for each call.
+     * A nested or concurrent call that finds them in use allocates its own.
+     */
+    jni::global_ref<jni::JArrayLong::javaobject> primitives;
+    jni::global_ref<jni::JArrayClass<jni::JString>::javaobject> strings;
+    std::atomic<bool> buffersInUse = false;
+  };
+
+  std::unique_ptr<PrimitiveTrampoline> primitiveTrampoline = nullptr;
+
+  /**
+   * Converter for the declared return type or `nullptr` if the result type isn't known.
+   */
+  std::unique_ptr<ReturnTypeConverter> returnTypeConverter = nullptr;
+
   /**
    * Reference to one of two java objects - `JNIFunctionBody` or `JNIAsyncFunctionBody`.
    *
@@ -106,6 +157,17 @@ private:
 
   jsi::Function toSyncFunction(jsi::Runtime &runtime);
 
+  /**
+   * Calls the function through the primitive trampoline.
+   * Returns `std::nullopt` if the arguments don't match the expected primitive types.
+   */
+  std::optional<jsi::Value> callPrimitiveSync(
+    JNIEnv *env,
+    jsi::Runtime &rt,
+    const jsi::Value *args,
+    size_t count
+  );
+
   jsi::Function toAsyncFunction(jsi::Runtime &runtime);
 
   jsi::Function createPromiseBody(
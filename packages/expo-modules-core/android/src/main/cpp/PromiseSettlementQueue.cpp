@@ -0,0 +1,118 @@
+// Copyright © 2021-present 650 Industries, Inc. (aka Expo)
+
+#include "PromiseSettlementQueue.h"
+
+#include <exception>
+
+namespace expo {
+
+PromiseSettlementQueue::PromiseSettlementQueue(
+  std::weak_ptr<react::CallInvoker> jsInvoker
+) : jsInvoker(std::move(jsInvoker)) {}
+
+PromiseSettlementQueue::~PromiseSettlementQueue() {
+  Node *node = incoming.exchange(nullptr, std::memory_order_acquire);
+  while (node != nullptr) {
+    Node *next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+void PromiseSettlementQueue::enqueue(Settlement &&settlement) {
+  Node *node = new Node{std::move(settlement), incoming.load(std::memory_order_relaxed)};
+  // Pushing the node and checking the flag have to be sequentially consistent,
+  // to pair with the store-then-load of `drain`. Otherwise both sides could miss each other.
+  while (!incoming.compare_exchange_weak(
+    node->next,
+    node,
+    std::memory_order_seq_cst,
+    std::memory_order_relaxed
+  )) {}
+
+  if (!isDrainScheduled.exchange(true, std::memory_order_seq_cst)) {
+    if (!scheduleDrain()) {
+      isDrainScheduled.store(false, std::memory_order_seq_cst);
+    }
+  }
+}
+
+bool PromiseSettlementQueue::scheduleDrain() {
+  const auto invoker = jsInvoker.lock();
+  // Call invoker is already released, so the promises can't be settled anymore.
+  if (invoker == nullptr) {
+    return false;
+  }
+
+  invoker->invokeAsync([weakThis = weak_from_this()]() -> void {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->drain();
+    }
+  });
+  return true;
+}
+
+void PromiseSettlementQueue::takeIncoming() {
+  Node *node = incoming.exchange(nullptr, std::memory_order_acquire);
+  if (node == nullptr) {
+    return;
+  }
+
+  // The stack holds the most recent settlement first, so it has to be reversed.
+  Node *reversed = nullptr;
+  while (node != nullptr) {
+    Node *next = node->next;
+    node->next = reversed;
+    reversed = node;
+    node = next;
+  }
+
+  while (reversed != nullptr) {
+    Node *next = reversed->next;
+    pending.push_back(std::move(reversed->settlement));
+    delete reversed;
+    reversed = next;
+  }
+}
+
+void PromiseSettlementQueue::drain() {
+  takeIncoming();
+
+  // A failing settlement shouldn't prevent others from being settled.
+  // The first error is rethrown once the batch is done.
+  std::exception_ptr error = nullptr;
+  for (size_t i = 0; i < kMaxBatchSize && !pending.empty(); i++) {
+    Settlement settlement = std::move(pending.front());
+    pending.pop_front();
+    try {
+      settlement();
+    } catch (...) {
+      if (error == nullptr) {
+        error = std::current_exception();
+      }
+    }
+  }
+
+  if (!pending.empty()) {
+    // Continues in the next task - `isDrainScheduled` stays set.
+    if (!scheduleDrain()) {
+      pending.clear();
+      isDrainScheduled.store(false, std::memory_order_seq_cst);
+    }
+  } else {
+    isDrainScheduled.store(false, std::memory_order_seq_cst);
+    // Settlements added after `takeIncoming` might have seen the flag set and skipped scheduling.
+    if (incoming.load(std::memory_order_seq_cst) != nullptr &&
+        !isDrainScheduled.exchange(true, std::memory_order_seq_cst)) {
+      if (!scheduleDrain()) {
+        isDrainScheduled.store(false, std::memory_order_seq_cst);
+      }
+    }
+  }
+
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace expo
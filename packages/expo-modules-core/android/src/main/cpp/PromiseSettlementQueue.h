@@ -0,0 +1,79 @@
+// Copyright © 2021-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include <ReactCommon/CallInvoker.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+
+namespace react = facebook::react;
+
+namespace expo {
+
+/**
+ * Collects promise settlements coming from native threads and runs them on the JS thread in batches.
+ * Instead of scheduling a separate `invokeAsync` for every resolved or rejected promise,
+ * only one drain is scheduled at a time and it settles up to `kMaxBatchSize` promises per tick.
+ *
+ * `enqueue` is lock-free and can be called from any thread.
+ * The queue has to be managed by a shared pointer.
+ */
+class PromiseSettlementQueue : public std::enable_shared_from_this<PromiseSettlementQueue> {
+public:
+  using Settlement = std::function<void()>;
+
+  /**
+   * The maximum number of settlements run in a single JS task.
+   * The remaining ones are moved to the next task, so other work can be interleaved.
+   */
+  static constexpr size_t kMaxBatchSize = 64;
+
+  explicit PromiseSettlementQueue(std::weak_ptr<react::CallInvoker> jsInvoker);
+
+  ~PromiseSettlementQueue();
+
+  PromiseSettlementQueue(const PromiseSettlementQueue &) = delete;
+
+  PromiseSettlementQueue &operator=(const PromiseSettlementQueue &) = delete;
+
+  /**
+   * Adds a settlement to the queue and schedules a drain if none is pending.
+   * Does nothing if the call invoker was already released.
+   */
+  void enqueue(Settlement &&settlement);
+
+private:
+  struct Node {
+    Settlement settlement;
+    Node *next;
+  };
+
+  std::weak_ptr<react::CallInvoker> jsInvoker;
+
+  /**
+   * A lock-free stack of settlements added since the last drain, the most recent first.
+   */
+  std::atomic<Node *> incoming = nullptr;
+
+  /**
+   * Whether a drain task was scheduled and hasn't finished yet.
+   */
+  std::atomic<bool> isDrainScheduled = false;
+
+  /**
+   * Settlements taken from `incoming` in the order they were added.
+   * Accessed only from the JS thread.
+   */
+  std::deque<Settlement> pending;
+
+  bool scheduleDrain();
+
+  void drain();
+
+  void takeIncoming();
+};
+
+} // namespace expo
@@ -0,0 +1,91 @@
+// Copyright © 2021-present 650 Industries, Inc. (aka Expo)
+
+#include "SharedObjectTable.h"
+
+namespace expo {
+
+SharedObjectTable::SharedObjectTable(
+  std::weak_ptr<react::CallInvoker> jsInvoker,
+  ReleaseHandler releaseHandler
+) : jsInvoker(std::move(jsInvoker)),
+    releaseHandler(std::move(releaseHandler)) {}
+
+void SharedObjectTable::add(jsi::Runtime &rt, ObjectId id, const jsi::Object &jsObject) {
+  auto &shard = shardFor(id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.objects.insert_or_assign(id, jsi::WeakObject(rt, jsObject));
+}
+
+std::optional<jsi::Object> SharedObjectTable::get(jsi::Runtime &rt, ObjectId id) {
+  auto &shard = shardFor(id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.objects.find(id);
+  if (it == shard.objects.end()) {
+    return std::nullopt;
+  }
+  jsi::Value value = it->second.lock(rt);
+  if (!value.isObject()) {
+    return std::nullopt;
+  }
+  return value.getObject(rt);
+}
+
+void SharedObjectTable::release(ObjectId id) {
+  bool canSchedule;
+  {
+    std::lock_guard<std::mutex> lock(releasedMutex);
+    released.push_back(id);
+    if (isFlushScheduled) {
+      return;
+    }
+    isFlushScheduled = true;
+    canSchedule = !wasCleared;
+  }
+
+  const auto invoker = canSchedule ? jsInvoker.lock() : nullptr;
+  // Without the call invoker, the release has to be handled right away.
+  if (invoker == nullptr) {
+    flushReleased();
+    return;
+  }
+
+  invoker->invokeAsync([weakThis = weak_from_this()]() -> void {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->flushReleased();
+    }
+  });
+}
+
+void SharedObjectTable::clear() {
+  {
+    std::lock_guard<std::mutex> lock(releasedMutex);
+    wasCleared = true;
+  }
+  for (auto &shard: shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.objects.clear();
+  }
+  flushReleased();
+}
+
+void SharedObjectTable::flushReleased() {
+  std::vector<ObjectId> ids;
+  {
+    std::lock_guard<std::mutex> lock(releasedMutex);
+    ids.swap(released);
+    isFlushScheduled = false;
+  }
+  if (ids.empty()) {
+    return;
+  }
+
+  for (ObjectId id: ids) {
+    auto &shard = shardFor(id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.objects.erase(id);
+  }
+
+  releaseHandler(ids);
+}
+
+} // namespace expo
@@ -0,0 +1,91 @@
+// Copyright © 2021-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <ReactCommon/CallInvoker.h>
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace jsi = facebook::jsi;
+namespace react = facebook::react;
+
+namespace expo {
+
+/**
+ * A native map from shared object ids to their JavaScript objects.
+ * Lets the cpp code find the JavaScript part of a shared object without asking Kotlin.
+ *
+ * Releases of shared objects are collected and passed to the `ReleaseHandler` in batches,
+ * on the JS thread if the call invoker is still alive.
+ * The table has to be managed by a shared pointer.
+ */
+class SharedObjectTable : public std::enable_shared_from_this<SharedObjectTable> {
+public:
+  using ObjectId = int;
+  using ReleaseHandler = std::function<void(const std::vector<ObjectId> &)>;
+
+  SharedObjectTable(
+    std::weak_ptr<react::CallInvoker> jsInvoker,
+    ReleaseHandler releaseHandler
+  );
+
+  SharedObjectTable(const SharedObjectTable &) = delete;
+
+  SharedObjectTable &operator=(const SharedObjectTable &) = delete;
+
+  /**
+   * Stores a weak reference to the JavaScript part of the shared object.
+   */
+  void add(jsi::Runtime &rt, ObjectId id, const jsi::Object &jsObject);
+
+  /**
+   * Returns the JavaScript part of the shared object or `std::nullopt`
+   * if the object isn't known or was already garbage collected.
+   */
+  std::optional<jsi::Object> get(jsi::Runtime &rt, ObjectId id);
+
+  /**
+   * Marks the shared object as released. Can be called from any thread.
+   */
+  void release(ObjectId id);
+
+  /**
+   * Drops all JavaScript references and passes pending releases to the handler.
+   * Releases reported afterwards are handled right away.
+   * Has to be called before the runtime is destroyed.
+   */
+  void clear();
+
+private:
+  static constexpr size_t kShardsCount = 16;
+
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<ObjectId, jsi::WeakObject> objects;
+  };
+
+  std::array<Shard, kShardsCount> shards;
+
+  std::weak_ptr<react::CallInvoker> jsInvoker;
+  ReleaseHandler releaseHandler;
+
+  std::mutex releasedMutex;
+  std::vector<ObjectId> released;
+  bool isFlushScheduled = false;
+  bool wasCleared = false;
+
+  inline Shard &shardFor(ObjectId id) {
+    return shards[static_cast<size_t>(id) % kShardsCount];
+  }
+
+  void flushReleased();
+};
+
+} // namespace expo
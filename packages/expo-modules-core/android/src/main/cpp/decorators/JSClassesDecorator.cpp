@@ -54,96 +54,133 @@ void JSClassesDecorator::decorate(
   jsi::Object &jsObject
 ) {
   for (auto &[name, classInfo]: classes) {
-    auto &[prototypeDecorators, constructor, ownerClass, isSharedRef] = classInfo;
-
-    auto weakConstructor = std::weak_ptr<decltype(constructor)::element_type>(constructor);
-    expo::common::ClassConstructor jsConstructor = [weakConstructor = std::move(weakConstructor)](
-      jsi::Runtime &runtime,
-      const jsi::Value &thisValue,
-      const jsi::Value *args,
-      size_t count
-    ) -> jsi::Value {
-      // We need to check if the constructor is still alive.
-      // If not we can just ignore the call. We're destroying the module.
-      auto ctr = weakConstructor.lock();
-      if (ctr == nullptr) {
-        return jsi::Value::undefined();
-      }
+    decorateClass(runtime, jsObject, name, classInfo);
+  }
+}
 
-      auto thisObject = std::make_shared<jsi::Object>(thisValue.asObject(runtime));
-
-      try {
-        JNIEnv *env = jni::Environment::current();
-        /**
-        * This will push a new JNI stack frame for the LocalReferences in this
-        * function call. When the stack frame for this lambda is popped,
-        * all LocalReferences are deleted.
-        */
-        jni::JniLocalScope scope(env, (int) count);
-        auto result = ctr->callJNISync(
-          env,
-          runtime,
-          thisValue,
-          args,
-          count
-        );
-        if (result == nullptr) {
-          return {runtime, thisValue};
-        }
-        jobject unpackedResult = result.get();
-        jclass resultClass = env->GetObjectClass(unpackedResult);
-        if (env->IsAssignableFrom(
-          resultClass,
-          JCacheHolder::get().jSharedObject
-        )) {
-          JSIContext *jsiContext = getJSIContext(runtime);
-          auto jsThisObject = JavaScriptObject::newInstance(
-            jsiContext,
-            jsiContext->runtimeHolder,
-            thisObject
-          );
-          jsiContext->registerSharedObject(result, jsThisObject);
-        }
+std::vector<std::string> JSClassesDecorator::decorateLazily(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject
+) {
+  std::vector<std::string> names;
+  for (auto &[name, classInfo]: classes) {
+    if (classInfo.ownerClass != nullptr) {
+      // Classes of shared objects have to be registered right away,
+      // as native code may return their instances before JS accesses the class.
+      decorateClass(runtime, jsObject, name, classInfo);
+    } else {
+      names.push_back(name);
+    }
+  }
+  return names;
+}
+
+void JSClassesDecorator::decorateMember(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name
+) {
+  auto classInfo = classes.find(name);
+  if (classInfo != classes.end()) {
+    decorateClass(runtime, jsObject, name, classInfo->second);
+  }
+}
+
+void JSClassesDecorator::decorateClass(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name,
+  ClassEntry &classInfo
+) {
+  auto &[prototypeDecorators, constructor, ownerClass, isSharedRef] = classInfo;
+
+  auto weakConstructor = std::weak_ptr<decltype(constructor)::element_type>(constructor);
+  expo::common::ClassConstructor jsConstructor = [weakConstructor = std::move(weakConstructor)](
+    jsi::Runtime &runtime,
+    const jsi::Value &thisValue,
+    const jsi::Value *args,
+    size_t count
+  ) -> jsi::Value {
+    // We need to check if the constructor is still alive.
+    // If not we can just ignore the call. We're destroying the module.
+    auto ctr = weakConstructor.lock();
+    if (ctr == nullptr) {
+      return jsi::Value::undefined();
+    }
+
+    auto thisObject = std::make_shared<jsi::Object>(thisValue.asObject(runtime));
+
+    try {
+      JNIEnv *env = jni::Environment::current();
+      /**
+      * This will push a new JNI stack frame for the LocalReferences in this
+      * function call. When the stack frame for this lambda is popped,
+      * all LocalReferences are deleted.
+      */
+      jni::JniLocalScope scope(env, (int) count);
+      auto result = ctr->callJNISync(
+        env,
+        runtime,
+        thisValue,
+        args,
+        count
+      );
+      if (result == nullptr) {
         return {runtime, thisValue};
-      } catch (jni::JniException &jniException) {
-        rethrowAsCodedError(runtime, jniException);
       }
-    };
+      jobject unpackedResult = result.get();
+      jclass resultClass = env->GetObjectClass(unpackedResult);
+      if (env->IsAssignableFrom(
+        resultClass,
+        JCacheHolder::get().jSharedObject
+      )) {
+        JSIContext *jsiContext = getJSIContext(runtime);
+        auto jsThisObject = JavaScriptObject::newInstance(
+          jsiContext,
+          jsiContext->runtimeHolder,
+          thisObject
+        );
+        jsiContext->registerSharedObject(result, jsThisObject);
+      }
+      return {runtime, thisValue};
+    } catch (jni::JniException &jniException) {
+      rethrowAsCodedError(runtime, jniException);
+    }
+  };
 
-    auto klass = createClass(
-      runtime,
-      name,
-      isSharedRef,
-      std::move(jsConstructor)
-    );
-    auto klassSharedPtr = std::make_shared<jsi::Function>(std::move(klass));
+  auto klass = createClass(
+    runtime,
+    name,
+    isSharedRef,
+    std::move(jsConstructor)
+  );
+  auto klassSharedPtr = std::make_shared<jsi::Function>(std::move(klass));
 
-    JSIContext *jsiContext = getJSIContext(runtime);
+  JSIContext *jsiContext = getJSIContext(runtime);
 
-    auto jsThisObject = JavaScriptObject::newInstance(
-      jsiContext,
-      jsiContext->runtimeHolder,
-      klassSharedPtr
-    );
+  auto jsThisObject = JavaScriptObject::newInstance(
+    jsiContext,
+    jsiContext->runtimeHolder,
+    klassSharedPtr
+  );
 
-    if (ownerClass != nullptr) {
-      jsiContext->registerClass(jni::make_local(ownerClass), jsThisObject);
-    }
+  if (ownerClass != nullptr) {
+    jsiContext->registerClass(jni::make_local(ownerClass), jsThisObject);
+  }
 
-    jsObject.setProperty(
-      runtime,
-      jsi::String::createFromUtf8(runtime, name),
-      jsi::Value(runtime, *klassSharedPtr)
-    );
+  jsObject.setProperty(
+    runtime,
+    jsi::String::createFromUtf8(runtime, name),
+    jsi::Value(runtime, *klassSharedPtr)
+  );
 
-    jsi::PropNameID prototypePropNameId = jsi::PropNameID::forAscii(runtime, "prototype", 9);
-    jsi::Object klassPrototype = klassSharedPtr
-      ->getProperty(runtime, prototypePropNameId)
-      .asObject(runtime);
+  jsi::PropNameID prototypePropNameId = jsi::PropNameID::forAscii(runtime, "prototype", 9);
+  jsi::Object klassPrototype = klassSharedPtr
+    ->getProperty(runtime, prototypePropNameId)
+    .asObject(runtime);
 
-    for (const auto &decorator: prototypeDecorators) {
-      decorator->decorate(runtime, klassPrototype);
-    }
+  for (const auto &decorator: prototypeDecorators) {
+    decorator->decorate(runtime, klassPrototype);
   }
 }
 
@@ -34,6 +34,17 @@ public:
     jsi::Object &jsObject
   ) override;
 
+  std::vector<std::string> decorateLazily(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject
+  ) override;
+
+  void decorateMember(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name
+  ) override;
+
 private:
   struct ClassEntry {
     std::vector<std::unique_ptr<JSDecorator>> prototypeDecorators;
@@ -42,6 +53,13 @@ private:
     bool isSharedRef;
   };
 
+  void decorateClass(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name,
+    ClassEntry &classInfo
+  );
+
   static jsi::Function createClass(
     jsi::Runtime &runtime,
     const std::string &className,
@@ -33,4 +33,32 @@ void JSConstantsDecorator::decorate(
   }
 }
 
+std::vector<std::string> JSConstantsDecorator::decorateLazily(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject
+) {
+  std::vector<std::string> names;
+  names.reserve(constants.size());
+  for (const auto &[name, _]: constants) {
+    names.push_back(name);
+  }
+  return names;
+}
+
+void JSConstantsDecorator::decorateMember(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name
+) {
+  auto constant = constants.find(name);
+  if (constant != constants.end()) {
+    // The dynamic is converted only when the constant is accessed for the first time.
+    jsObject.setProperty(
+      runtime,
+      jsi::String::createFromUtf8(runtime, name),
+      jsi::valueFromDynamic(runtime, constant->second)
+    );
+  }
+}
+
 } // namespace expo
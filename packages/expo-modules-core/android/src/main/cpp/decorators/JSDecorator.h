@@ -5,6 +5,9 @@
 #include <fbjni/fbjni.h>
 #include <jsi/jsi.h>
 
+#include <string>
+#include <vector>
+
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
 
@@ -23,6 +26,28 @@ public:
     jsi::Runtime &runtime,
     jsi::Object &jsObject
   ) = 0;
+
+  /**
+   * Defines only the members that have to be available right away and returns names of the remaining ones.
+   * They have to be defined with `decorateMember`, on their first access.
+   * The default implementation defines all members at once.
+   */
+  virtual std::vector<std::string> decorateLazily(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject
+  ) {
+    decorate(runtime, jsObject);
+    return {};
+  }
+
+  /**
+   * Defines a single member returned by `decorateLazily`.
+   */
+  virtual void decorateMember(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name
+  ) {}
 };
 
 } // namespace expo
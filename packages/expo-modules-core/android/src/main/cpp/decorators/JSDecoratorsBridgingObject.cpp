@@ -18,6 +18,8 @@ void JSDecoratorsBridgingObject::registerNatives() {
                                     JSDecoratorsBridgingObject::registerConstants),
                    makeNativeMethod("registerSyncFunction",
                                     JSDecoratorsBridgingObject::registerSyncFunction),
+                   makeNativeMethod("registerFunctions",
+                                    JSDecoratorsBridgingObject::registerFunctions),
                    makeNativeMethod("registerAsyncFunction",
                                     JSDecoratorsBridgingObject::registerAsyncFunction),
                    makeNativeMethod("registerProperty",
@@ -34,13 +36,47 @@ void JSDecoratorsBridgingObject::registerSyncFunction(
   jboolean takesOwner,
   jboolean enumerable,
   jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes,
-  jni::alias_ref<JNIFunctionBody::javaobject> body
+  jni::alias_ref<ExpectedType::javaobject> returnType,
+  jni::alias_ref<JNIFunctionBody::javaobject> body,
+  jint primitiveReturnType,
+  jni::alias_ref<JNIPrimitiveFunctionBody::javaobject> primitiveBody
 ) {
   if (!functionDecorator) {
     functionDecorator = std::make_unique<JSFunctionsDecorator>();
   }
 
-  functionDecorator->registerSyncFunction(name, takesOwner, enumerable, expectedArgTypes, body);
+  functionDecorator->registerSyncFunction(
+    name,
+    takesOwner,
+    enumerable,
+    expectedArgTypes,
+    returnType,
+    body,
+    primitiveReturnType,
+    primitiveBody
+  );
+}
+
+void JSDecoratorsBridgingObject::registerFunctions(
+  jni::alias_ref<jstring> names,
+  jni::alias_ref<jni::JArrayInt> descriptor,
+  jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes,
+  jni::alias_ref<jni::JArrayClass<jobject>> bodies,
+  jni::alias_ref<jni::JArrayClass<ExpectedType::javaobject>> returnTypes,
+  jni::alias_ref<jni::JArrayClass<JNIPrimitiveFunctionBody::javaobject>> primitiveBodies
+) {
+  if (!functionDecorator) {
+    functionDecorator = std::make_unique<JSFunctionsDecorator>();
+  }
+
+  functionDecorator->registerFunctions(
+    names,
+    descriptor,
+    expectedArgTypes,
+    bodies,
+    returnTypes,
+    primitiveBodies
+  );
 }
 
 void JSDecoratorsBridgingObject::registerAsyncFunction(
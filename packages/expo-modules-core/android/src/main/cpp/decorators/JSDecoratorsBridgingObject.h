@@ -46,7 +46,19 @@ public:
     jboolean takesOwner,
     jboolean enumerable,
     jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes,
-    jni::alias_ref<JNIFunctionBody::javaobject> body
+    jni::alias_ref<ExpectedType::javaobject> returnType,
+    jni::alias_ref<JNIFunctionBody::javaobject> body,
+    jint primitiveReturnType,
+    jni::alias_ref<JNIPrimitiveFunctionBody::javaobject> primitiveBody
+  );
+
+  void registerFunctions(
+    jni::alias_ref<jstring> names,
+    jni::alias_ref<jni::JArrayInt> descriptor,
+    jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes,
+    jni::alias_ref<jni::JArrayClass<jobject>> bodies,
+    jni::alias_ref<jni::JArrayClass<ExpectedType::javaobject>> returnTypes,
+    jni::alias_ref<jni::JArrayClass<JNIPrimitiveFunctionBody::javaobject>> primitiveBodies
   );
 
   void registerAsyncFunction(
@@ -2,6 +2,7 @@
 
 #include "JSFunctionsDecorator.h"
 #include "JSIUtils.h"
+#include "../types/FrontendConverterProvider.h"
 
 #include <jsi/jsi.h>
 
@@ -9,6 +10,48 @@ namespace jsi = facebook::jsi;
 
 namespace expo {
 
+namespace {
+
+// Flags have to be kept in sync with `JSFunctionsBatch.kt`.
+constexpr jint TAKES_OWNER = 1 << 0;
+constexpr jint ENUMERABLE = 1 << 1;
+constexpr jint IS_ASYNC = 1 << 2;
+constexpr jint HAS_PRIMITIVE_BODY = 1 << 3;
+
+void defineFunction(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name,
+  MethodMetadata &method
+) {
+  if (method.info.enumerable) {
+    jsObject.setProperty(
+      runtime,
+      jsi::String::createFromUtf8(runtime, name),
+      jsi::Value(runtime, *method.toJSFunction(runtime))
+    );
+  } else {
+    common::PropertyDescriptor descriptor{
+      .enumerable = false,
+      .value = jsi::Value(runtime, *method.toJSFunction(runtime))
+    };
+
+    defineProperty(runtime, &jsObject, name.c_str(), descriptor);
+  }
+}
+
+/**
+ * Whether the function is called by the `EventEmitter` when the first listener is added or the last one is removed.
+ */
+bool isObservingFunction(const std::string &name) {
+  return name == "startObserving"
+    || name == "stopObserving"
+    || name == "__expo_onStartListeningToEvent"
+    || name == "__expo_onStopListeningToEvent";
+}
+
+} // namespace
+
 std::vector<std::unique_ptr<AnyType>> JSFunctionsDecorator::mapConverters(
   jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes
 ) {
@@ -24,7 +67,7 @@ std::vector<std::unique_ptr<AnyType>> JSFunctionsDecorator::mapConverters(
   return argTypes;
 }
 
-void JSFunctionsDecorator::registerFunction(
+std::shared_ptr<MethodMetadata> JSFunctionsDecorator::registerFunction(
   const std::string &name,
   bool takesOwner,
   bool enumerable,
@@ -43,7 +86,8 @@ void JSFunctionsDecorator::registerFunction(
     std::move(info),
     std::move(body)
   );
-  methodsMetadata.insert_or_assign(name, std::move(methodMetadata));
+  methodsMetadata.insert_or_assign(name, methodMetadata);
+  return methodMetadata;
 }
 
 void JSFunctionsDecorator::registerSyncFunction(
@@ -51,9 +95,12 @@ void JSFunctionsDecorator::registerSyncFunction(
   jboolean takesOwner,
   jboolean enumerable,
   jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes,
-  jni::alias_ref<JNIFunctionBody::javaobject> body
+  jni::alias_ref<ExpectedType::javaobject> returnType,
+  jni::alias_ref<JNIFunctionBody::javaobject> body,
+  jint primitiveReturnType,
+  jni::alias_ref<JNIPrimitiveFunctionBody::javaobject> primitiveBody
 ) {
-  registerFunction(
+  auto methodMetadata = registerFunction(
     name->toStdString(),
     static_cast<bool>(
       takesOwner & 0x1
@@ -63,6 +110,15 @@ void JSFunctionsDecorator::registerSyncFunction(
     mapConverters(expectedArgTypes),
     jni::make_global(body)
   );
+
+  methodMetadata->setReturnType(returnType);
+
+  if (primitiveBody != nullptr) {
+    methodMetadata->setPrimitiveBody(
+      static_cast<CppType>(primitiveReturnType),
+      jni::make_global(primitiveBody)
+    );
+  }
 }
 
 void JSFunctionsDecorator::registerAsyncFunction(
@@ -84,26 +140,110 @@ void JSFunctionsDecorator::registerAsyncFunction(
   );
 }
 
+void JSFunctionsDecorator::registerFunctions(
+  jni::alias_ref<jstring> names,
+  jni::alias_ref<jni::JArrayInt> descriptor,
+  jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes,
+  jni::alias_ref<jni::JArrayClass<jobject>> bodies,
+  jni::alias_ref<jni::JArrayClass<ExpectedType::javaobject>> returnTypes,
+  jni::alias_ref<jni::JArrayClass<JNIPrimitiveFunctionBody::javaobject>> primitiveBodies
+) {
+  // Names are separated by '\0', so all of them are copied with a single call.
+  const std::string joinedNames = names->toStdString();
+  const size_t descriptorSize = descriptor->size();
+  const auto values = descriptor->getRegion(0, static_cast<jsize>(descriptorSize));
+  const auto converterProvider = FrontendConverterProvider::instance();
+
+  size_t position = 0;
+  size_t nameStart = 0;
+  size_t argIndex = 0;
+  for (size_t functionIndex = 0; position < descriptorSize; functionIndex++) {
+    const size_t nameEnd = joinedNames.find('\0', nameStart);
+    std::string name = joinedNames.substr(nameStart, nameEnd - nameStart);
+    nameStart = nameEnd + 1;
+
+    const jint flags = values[position++];
+    const auto primitiveReturnType = static_cast<CppType>(values[position++]);
+    const auto returnCombinedTypes = static_cast<CppType>(values[position++]);
+    const size_t arity = values[position++];
+
+    std::vector<std::unique_ptr<AnyType>> argTypes;
+    argTypes.reserve(arity);
+    for (size_t i = 0; i < arity; i++, argIndex++) {
+      const auto combinedTypes = static_cast<CppType>(values[position++]);
+      // Only lists, maps, primitive arrays and unions that aren't known upfront need the Kotlin type.
+      auto converter = converterProvider->obtainSimpleConverter(combinedTypes);
+      if (converter != nullptr) {
+        argTypes.push_back(std::make_unique<AnyType>(combinedTypes, std::move(converter)));
+      } else {
+        argTypes.push_back(std::make_unique<AnyType>(expectedArgTypes->getElement(argIndex)));
+      }
+    }
+
+    const bool isAsync = (flags & IS_ASYNC) != 0;
+    auto methodMetadata = registerFunction(
+      name,
+      (flags & TAKES_OWNER) != 0,
+      (flags & ENUMERABLE) != 0,
+      isAsync,
+      std::move(argTypes),
+      jni::make_global(bodies->getElement(functionIndex))
+    );
+
+    if (isAsync) {
+      continue;
+    }
+
+    // Values of type `Any` are converted without a dedicated converter, so the return type doesn't need to be read.
+    if (returnCombinedTypes != CppType::ANY) {
+      methodMetadata->setReturnType(returnTypes->getElement(functionIndex));
+    }
+
+    if ((flags & HAS_PRIMITIVE_BODY) != 0) {
+      methodMetadata->setPrimitiveBody(
+        primitiveReturnType,
+        jni::make_global(primitiveBodies->getElement(functionIndex))
+      );
+    }
+  }
+}
+
 void JSFunctionsDecorator::decorate(
   jsi::Runtime &runtime,
   jsi::Object &jsObject
 ) {
   for (auto &[name, method]: this->methodsMetadata) {
-    if (method->info.enumerable) {
-      jsObject.setProperty(
-        runtime,
-        jsi::String::createFromUtf8(runtime, name),
-        jsi::Value(runtime, *method->toJSFunction(runtime))
-      );
-    } else {
-      common::PropertyDescriptor descriptor{
-        .enumerable = false,
-        .value = jsi::Value(runtime, *method->toJSFunction(runtime))
-      };
+    defineFunction(runtime, jsObject, name, *method);
+  }
+}
 
-      defineProperty(runtime, &jsObject, name.c_str(), descriptor);
+std::vector<std::string> JSFunctionsDecorator::decorateLazily(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject
+) {
+  std::vector<std::string> names;
+  names.reserve(methodsMetadata.size());
+  for (const auto &[name, method]: methodsMetadata) {
+    // The event emitter reads the observing functions from the unwrapped object, bypassing the lazy object,
+    // so they have to be defined right away.
+    if (isObservingFunction(name)) {
+      defineFunction(runtime, jsObject, name, *method);
+    } else {
+      names.push_back(name);
     }
   }
+  return names;
+}
+
+void JSFunctionsDecorator::decorateMember(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name
+) {
+  auto method = methodsMetadata.find(name);
+  if (method != methodsMetadata.end()) {
+    defineFunction(runtime, jsObject, name, *method->second);
+  }
 }
 
 } // namespace expo
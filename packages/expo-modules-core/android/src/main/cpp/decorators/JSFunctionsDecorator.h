@@ -26,7 +26,10 @@ public:
     jboolean takesOwner,
     jboolean enumerable,
     jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes,
-    jni::alias_ref<JNIFunctionBody::javaobject> body
+    jni::alias_ref<ExpectedType::javaobject> returnType,
+    jni::alias_ref<JNIFunctionBody::javaobject> body,
+    jint primitiveReturnType,
+    jni::alias_ref<JNIPrimitiveFunctionBody::javaobject> primitiveBody
   );
 
   void registerAsyncFunction(
@@ -37,11 +40,34 @@ public:
     jni::alias_ref<JNIAsyncFunctionBody::javaobject> body
   );
 
+  /**
+   * Registers many functions at once from the descriptor built by `JSFunctionsBatch.kt`.
+   */
+  void registerFunctions(
+    jni::alias_ref<jstring> names,
+    jni::alias_ref<jni::JArrayInt> descriptor,
+    jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes,
+    jni::alias_ref<jni::JArrayClass<jobject>> bodies,
+    jni::alias_ref<jni::JArrayClass<ExpectedType::javaobject>> returnTypes,
+    jni::alias_ref<jni::JArrayClass<JNIPrimitiveFunctionBody::javaobject>> primitiveBodies
+  );
+
   void decorate(
     jsi::Runtime &runtime,
     jsi::Object &jsObject
   ) override;
 
+  std::vector<std::string> decorateLazily(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject
+  ) override;
+
+  void decorateMember(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name
+  ) override;
+
   static std::vector<std::unique_ptr<AnyType>> mapConverters(jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes);
 
 private:
@@ -50,7 +76,7 @@ private:
   */
   std::unordered_map<std::string, std::shared_ptr<MethodMetadata>> methodsMetadata;
 
-  void registerFunction(
+  std::shared_ptr<MethodMetadata> registerFunction(
     const std::string &name,
     bool takesOwner,
     bool enumerable,
@@ -17,18 +17,43 @@ void JSObjectDecorator::decorate(
   jsi::Runtime &runtime,
   jsi::Object &jsObject
 ) {
-  for (const auto &[name, decorators]: this->objects) {
-    auto object = jsi::Object(runtime);
-    for (const auto &decorator: decorators) {
-      decorator->decorate(runtime, object);
-    }
-
-    jsObject.setProperty(
-      runtime,
-      name.c_str(),
-      jsi::Value(runtime, object)
-    );
+  for (const auto &[name, _]: this->objects) {
+    decorateMember(runtime, jsObject, name);
   }
 }
 
+std::vector<std::string> JSObjectDecorator::decorateLazily(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject
+) {
+  std::vector<std::string> names;
+  names.reserve(objects.size());
+  for (const auto &[name, _]: objects) {
+    names.push_back(name);
+  }
+  return names;
+}
+
+void JSObjectDecorator::decorateMember(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name
+) {
+  auto entry = objects.find(name);
+  if (entry == objects.end()) {
+    return;
+  }
+
+  auto object = jsi::Object(runtime);
+  for (const auto &decorator: entry->second) {
+    decorator->decorate(runtime, object);
+  }
+
+  jsObject.setProperty(
+    runtime,
+    name.c_str(),
+    jsi::Value(runtime, object)
+  );
+}
+
 } // namespace expo
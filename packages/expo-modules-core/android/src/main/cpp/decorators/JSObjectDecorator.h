@@ -24,6 +24,17 @@ public:
     jsi::Object &jsObject
   ) override;
 
+  std::vector<std::string> decorateLazily(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject
+  ) override;
+
+  void decorateMember(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name
+  ) override;
+
 private:
   std::unordered_map<std::string, std::vector<std::unique_ptr<JSDecorator>>> objects;
 };
@@ -55,33 +55,70 @@ void JSPropertiesDecorator::registerProperty(
   properties.insert_or_assign(cName, std::move(functions));
 }
 
+namespace {
+
+void defineAccessorProperty(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name,
+  MethodMetadata &getter,
+  MethodMetadata &setter
+) {
+  auto descriptor = JavaScriptObject::preparePropertyDescriptor(runtime,
+                                                                  1 << 1 /* enumerable */);
+  auto jsGetter = getter.toJSFunction(runtime);
+  if (jsGetter != nullptr) {
+    descriptor.setProperty(
+      runtime,
+      "get",
+      jsi::Value(runtime, *jsGetter)
+    );
+  }
+
+  auto jsSetter = setter.toJSFunction(runtime);
+  if (jsSetter != nullptr) {
+    descriptor.setProperty(
+      runtime,
+      "set",
+      jsi::Value(runtime, *jsSetter)
+    );
+  }
+  common::defineProperty(runtime, &jsObject, name.c_str(), std::move(descriptor));
+}
+
+} // namespace
+
 void JSPropertiesDecorator::decorate(
   jsi::Runtime &runtime,
   jsi::Object &jsObject
 ) {
   for (auto &[name, property]: this->properties) {
     auto &[getter, setter] = property;
+    defineAccessorProperty(runtime, jsObject, name, *getter, *setter);
+  }
+}
 
-    auto descriptor = JavaScriptObject::preparePropertyDescriptor(runtime,
-                                                                  1 << 1 /* enumerable */);
-    auto jsGetter = getter->toJSFunction(runtime);
-    if (jsGetter != nullptr) {
-      descriptor.setProperty(
-        runtime,
-        "get",
-        jsi::Value(runtime, *jsGetter)
-      );
-    }
-
-    auto jsSetter = setter->toJSFunction(runtime);
-    if (jsSetter != nullptr) {
-      descriptor.setProperty(
-        runtime,
-        "set",
-        jsi::Value(runtime, *jsSetter)
-      );
-    }
-    common::defineProperty(runtime, &jsObject, name.c_str(), std::move(descriptor));
+std::vector<std::string> JSPropertiesDecorator::decorateLazily(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject
+) {
+  std::vector<std::string> names;
+  names.reserve(properties.size());
+  for (const auto &[name, _]: properties) {
+    names.push_back(name);
+  }
+  return names;
+}
+
+void JSPropertiesDecorator::decorateMember(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name
+) {
+  auto property = properties.find(name);
+  if (property != properties.end()) {
+    auto &[getter, setter] = property->second;
+    defineAccessorProperty(runtime, jsObject, name, *getter, *setter);
   }
 }
 
@@ -30,6 +30,17 @@ public:
     jsi::Object &jsObject
   ) override;
 
+  std::vector<std::string> decorateLazily(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject
+  ) override;
+
+  void decorateMember(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name
+  ) override;
+
 private:
   /**
   * A registry of properties
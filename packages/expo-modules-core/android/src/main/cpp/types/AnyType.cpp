@@ -7,5 +7,12 @@
 namespace expo {
 AnyType::AnyType(
   jni::local_ref<expo::ExpectedType> expectedType
-) : converter(FrontendConverterProvider::instance()->obtainConverter(std::move(expectedType))) {}
+) : combinedTypes(expectedType->getCombinedTypes()),
+    converter(FrontendConverterProvider::instance()->obtainConverter(std::move(expectedType))) {}
+
+AnyType::AnyType(
+  CppType combinedTypes,
+  std::shared_ptr<FrontendConverter> converter
+) : combinedTypes(combinedTypes),
+    converter(std::move(converter)) {}
 } // namespace expo
@@ -19,6 +19,16 @@ class AnyType {
 public:
   AnyType(jni::local_ref<ExpectedType> expectedType);
 
+  /**
+   * Creates a type that is fully described by its cpp types, without reading the Kotlin object.
+   */
+  AnyType(CppType combinedTypes, std::shared_ptr<FrontendConverter> converter);
+
+  /**
+   * All cpp types that the Kotlin type can be created from.
+   */
+  CppType combinedTypes;
+
   /*
    * An instance of convert that should be used to convert from the jsi to the expected JNI type.
    */
@@ -76,6 +76,9 @@ std::string ExpectedType::getJClassString(bool allowsPrimitives) {
   if (type == CppType::TYPED_ARRAY) {
     return "expo/modules/kotlin/jni/JavaScriptTypedArray";
   }
+  if (type == CppType::BYTE_BUFFER) {
+    return "java/nio/ByteBuffer";
+  }
   if (type == CppType::PRIMITIVE_ARRAY) {
     auto innerType = this->getFirstType()->getFirstParameterType()->getJClassString(true);
     if (innerType.size() == 1) {
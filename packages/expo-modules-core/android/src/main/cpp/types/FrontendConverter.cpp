@@ -16,8 +16,10 @@
 #include "react/jni/ReadableNativeArray.h"
 #include <jsi/JSIDynamic.h>
 
+#include <cstring>
 #include <utility>
 #include <algorithm>
+#include <vector>
 
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
@@ -161,6 +163,102 @@ bool ByteArrayFrontendConverter::canConvert(
   return false;
 }
 
+namespace {
+
+/**
+ * JS memory wrapped during the sync calls in progress on this thread.
+ */
+thread_local std::vector<std::pair<const uint8_t *, size_t>> wrappedByteBuffers;
+thread_local size_t wrappedByteBuffersScopes = 0;
+
+/**
+ * Returns the memory of a JS ArrayBuffer or of the part of the ArrayBuffer seen by a view.
+ */
+std::pair<uint8_t *, size_t> getArrayBufferBytes(jsi::Runtime &rt, const jsi::Object &object) {
+  if (object.isArrayBuffer(rt)) {
+    auto arrayBuffer = object.getArrayBuffer(rt);
+    return {arrayBuffer.data(rt), arrayBuffer.size(rt)};
+  }
+
+  auto view = TypedArray(rt, object);
+  return {static_cast<uint8_t *>(view.getRawPointer(rt)), view.byteLength(rt)};
+}
+
+/**
+ * Converts the value with `convertDetached` if the result has to outlive the JS call.
+ */
+inline jobject convertWith(
+  const FrontendConverter &converter,
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  bool detached
+) {
+  return detached ? converter.convertDetached(rt, env, value) : converter.convert(rt, env, value);
+}
+
+} // namespace
+
+WrappedByteBuffersScope::WrappedByteBuffersScope() : start(wrappedByteBuffers.size()) {
+  wrappedByteBuffersScopes++;
+}
+
+WrappedByteBuffersScope::~WrappedByteBuffersScope() {
+  wrappedByteBuffersScopes--;
+  wrappedByteBuffers.resize(start);
+}
+
+void WrappedByteBuffersScope::add(const uint8_t *data, size_t size) {
+  if (wrappedByteBuffersScopes > 0) {
+    wrappedByteBuffers.emplace_back(data, size);
+  }
+}
+
+bool WrappedByteBuffersScope::contains(const uint8_t *data, size_t size) {
+  return std::any_of(
+    wrappedByteBuffers.begin(),
+    wrappedByteBuffers.end(),
+    [data, size](const std::pair<const uint8_t *, size_t> &buffer) {
+      return data < buffer.first + buffer.second && buffer.first < data + size;
+    }
+  );
+}
+
+jobject ByteBufferFrontendConverter::convert(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value
+) const {
+  auto [data, size] = getArrayBufferBytes(rt, value.asObject(rt));
+  WrappedByteBuffersScope::add(data, size);
+  auto byteBuffer = jni::JByteBuffer::wrapBytes(data, size);
+  byteBuffer->order(jni::JByteOrder::nativeOrder());
+  return byteBuffer.release();
+}
+
+jobject ByteBufferFrontendConverter::convertDetached(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value
+) const {
+  auto [data, size] = getArrayBufferBytes(rt, value.asObject(rt));
+  auto byteBuffer = jni::JByteBuffer::allocateDirect(static_cast<jint>(size));
+  std::memcpy(byteBuffer->getDirectAddress(), data, size);
+  byteBuffer->order(jni::JByteOrder::nativeOrder());
+  return byteBuffer.release();
+}
+
+bool ByteBufferFrontendConverter::canConvert(
+  jsi::Runtime &rt,
+  const jsi::Value &value
+) const {
+  if (!value.isObject()) {
+    return false;
+  }
+  auto object = value.getObject(rt);
+  return object.isArrayBuffer(rt) || isTypedArray(rt, object);
+}
+
 jobject TypedArrayFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
@@ -278,10 +376,25 @@ jobject PolyFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
   const jsi::Value &value
+) const {
+  return findConverter(rt, value).convert(rt, env, value);
+}
+
+jobject PolyFrontendConverter::convertDetached(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value
+) const {
+  return findConverter(rt, value).convertDetached(rt, env, value);
+}
+
+const FrontendConverter &PolyFrontendConverter::findConverter(
+  jsi::Runtime &rt,
+  const jsi::Value &value
 ) const {
   for (auto &converter: converters) {
     if (converter->canConvert(rt, value)) {
-      return converter->convert(rt, env, value);
+      return *converter;
     }
   }
   // That shouldn't happen.
@@ -325,6 +438,23 @@ jobject PrimitiveArrayFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
   const jsi::Value &value
+) const {
+  return convertElements(rt, env, value, false);
+}
+
+jobject PrimitiveArrayFrontendConverter::convertDetached(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value
+) const {
+  return convertElements(rt, env, value, true);
+}
+
+jobject PrimitiveArrayFrontendConverter::convertElements(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  bool detached
 ) const {
   auto jsArray = value.asObject(rt).asArray(rt);
   auto _createPrimitiveArray = [&rt, env, &jsArray](
@@ -371,8 +501,8 @@ jobject PrimitiveArrayFrontendConverter::convert(
     nullptr
   );
   for (size_t i = 0; i < size; i++) {
-    auto convertedElement = parameterConverter->convert(
-      rt, env, jsArray.getValueAtIndex(rt, i)
+    auto convertedElement = convertWith(
+      *parameterConverter, rt, env, jsArray.getValueAtIndex(rt, i), detached
     );
     env->SetObjectArrayElement(result, i, convertedElement);
     env->DeleteLocalRef(convertedElement);
@@ -396,14 +526,31 @@ jobject ListFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
   const jsi::Value &value
+) const {
+  return convertElements(rt, env, value, false);
+}
+
+jobject ListFrontendConverter::convertDetached(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value
+) const {
+  return convertElements(rt, env, value, true);
+}
+
+jobject ListFrontendConverter::convertElements(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  bool detached
 ) const {
   if (!value.isObject()) {
-    return convertSingleValue(rt, env, value);
+    return convertSingleValue(rt, env, value, detached);
   }
 
   auto valueObject = value.asObject(rt);
   if (!valueObject.isArray(rt)) {
-    return convertSingleValue(rt, env, value);
+    return convertSingleValue(rt, env, value, detached);
   }
 
   auto jsArray = valueObject.asArray(rt);
@@ -419,8 +566,8 @@ jobject ListFrontendConverter::convert(
       continue;
     }
 
-    auto convertedElement = parameterConverter->convert(
-      rt, env, jsValue
+    auto convertedElement = convertWith(
+      *parameterConverter, rt, env, jsValue, detached
     );
     arrayList->add(convertedElement);
     env->DeleteLocalRef(convertedElement);
@@ -432,10 +579,11 @@ jobject ListFrontendConverter::convert(
 jobject ListFrontendConverter::convertSingleValue(
   jsi::Runtime &rt,
   JNIEnv *env,
-  const jsi::Value &value
+  const jsi::Value &value,
+  bool detached
 ) const {
   auto result = java::ArrayList<jobject>::create(1);
-  result->add(parameterConverter->convert(rt, env, value));
+  result->add(convertWith(*parameterConverter, rt, env, value, detached));
   return result.release();
 }
 
@@ -456,6 +604,23 @@ jobject MapFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
   const jsi::Value &value
+) const {
+  return convertValues(rt, env, value, false);
+}
+
+jobject MapFrontendConverter::convertDetached(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value
+) const {
+  return convertValues(rt, env, value, true);
+}
+
+jobject MapFrontendConverter::convertValues(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  bool detached
 ) const {
   auto jsObject = value.asObject(rt);
   auto propertyNames = jsObject.getPropertyNames(rt);
@@ -474,8 +639,8 @@ jobject MapFrontendConverter::convert(
       continue;
     }
 
-    auto convertedValue = valueConverter->convert(
-      rt, env, jsValue
+    auto convertedValue = convertWith(
+      *valueConverter, rt, env, jsValue, detached
     );
 
     map->put(convertedKey, convertedValue);
@@ -37,6 +37,45 @@ public:
     JNIEnv *env,
     const jsi::Value &value
   ) const = 0;
+
+  /**
+   * Converts the provided value into an object that doesn't point to the JS memory,
+   * so it stays valid after the JS call returns, e.g. arguments of async functions.
+   */
+  virtual jobject convertDetached(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value
+  ) const {
+    return convert(rt, env, value);
+  }
+};
+
+/**
+ * Keeps track of the JS memory wrapped by `ByteBufferFrontendConverter::convert` while a sync call is in progress,
+ * so a buffer returned from the call is copied instead of being exposed to JS as a new ArrayBuffer.
+ * Sync calls are made on the JS thread, so the tracked memory is thread-local.
+ */
+class WrappedByteBuffersScope {
+public:
+  WrappedByteBuffersScope();
+  ~WrappedByteBuffersScope();
+
+  WrappedByteBuffersScope(const WrappedByteBuffersScope &) = delete;
+  WrappedByteBuffersScope &operator=(const WrappedByteBuffersScope &) = delete;
+
+  /**
+   * Records wrapped JS memory. Does nothing if no sync call is in progress.
+   */
+  static void add(const uint8_t *data, size_t size);
+
+  /**
+   * Checks if the given memory overlaps with any JS memory wrapped during the sync calls in progress.
+   */
+  static bool contains(const uint8_t *data, size_t size);
+
+private:
+  size_t start;
 };
 
 /**
@@ -165,6 +204,29 @@ public:
   bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
 };
 
+/**
+ * Converter from js ArrayBuffer or ArrayBuffer view to a direct [java.nio.ByteBuffer].
+ * `convert` returns a buffer pointing to the JS memory, so arguments of sync functions
+ * must not outlive the call - they can't be stored and are copied when returned.
+ * `convertDetached` copies the bytes into a new direct buffer that doesn't depend on the JS value.
+ */
+class ByteBufferFrontendConverter : public FrontendConverter {
+public:
+  jobject convert(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value
+  ) const override;
+
+  jobject convertDetached(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value
+  ) const override;
+
+  bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
+};
+
 /**
  * Converter from js type array to [expo.modules.kotlin.jni.JavaScriptTypedArray].
  */
@@ -283,8 +345,16 @@ public:
     const jsi::Value &value
   ) const override;
 
+  jobject convertDetached(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value
+  ) const override;
+
 private:
   std::vector<std::shared_ptr<FrontendConverter>> converters;
+
+  const FrontendConverter &findConverter(jsi::Runtime &rt, const jsi::Value &value) const;
 };
 
 /**
@@ -302,6 +372,12 @@ public:
     const jsi::Value &value
   ) const override;
 
+  jobject convertDetached(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value
+  ) const override;
+
   bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
 
 private:
@@ -317,6 +393,13 @@ private:
    * Converter used to convert array elements.
    */
   std::shared_ptr<FrontendConverter> parameterConverter;
+
+  jobject convertElements(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value,
+    bool detached
+  ) const;
 };
 
 /**
@@ -334,6 +417,12 @@ public:
     const jsi::Value &value
   ) const override;
 
+  jobject convertDetached(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value
+  ) const override;
+
   bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
 private:
   /**
@@ -341,10 +430,18 @@ private:
    */
   std::shared_ptr<FrontendConverter> parameterConverter;
 
+  jobject convertElements(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value,
+    bool detached
+  ) const;
+
   jobject convertSingleValue(
     jsi::Runtime &rt,
     JNIEnv *env,
-    const jsi::Value &value
+    const jsi::Value &value,
+    bool detached
   ) const;
 };
 
@@ -363,12 +460,25 @@ public:
     const jsi::Value &value
   ) const override;
 
+  jobject convertDetached(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value
+  ) const override;
+
   bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
 private:
   /**
    * Converter used to convert values.
    */
   std::shared_ptr<FrontendConverter> valueConverter;
+
+  jobject convertValues(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value,
+    bool detached
+  ) const;
 };
 
 /**
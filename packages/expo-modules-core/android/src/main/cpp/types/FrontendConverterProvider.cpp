@@ -18,6 +18,7 @@ void FrontendConverterProvider::createConverters() {
   RegisterConverter(CppType::BOOLEAN, BooleanFrontendConverter);
   RegisterConverter(CppType::UINT8_TYPED_ARRAY, ByteArrayFrontendConverter);
   RegisterConverter(CppType::TYPED_ARRAY, TypedArrayFrontendConverter);
+  RegisterConverter(CppType::BYTE_BUFFER, ByteBufferFrontendConverter);
   RegisterConverter(CppType::JS_OBJECT, JavaScriptObjectFrontendConverter);
   RegisterConverter(CppType::JS_VALUE, JavaScriptValueFrontendConverter);
   RegisterConverter(CppType::JS_FUNCTION, JavaScriptFunctionFrontendConverter);
@@ -82,6 +83,16 @@ std::shared_ptr<FrontendConverter> FrontendConverterProvider::obtainConverter(
   return std::make_shared<PolyFrontendConverter>(converters);
 }
 
+std::shared_ptr<FrontendConverter> FrontendConverterProvider::obtainSimpleConverter(
+  CppType combinedType
+) const {
+  auto result = simpleConverters.find(combinedType);
+  if (result != simpleConverters.end()) {
+    return result->second;
+  }
+  return nullptr;
+}
+
 std::shared_ptr<FrontendConverter> FrontendConverterProvider::obtainConverterForSingleType(
   jni::local_ref<SingleType::javaobject> expectedType
 ) {
@@ -35,6 +35,12 @@ public:
   std::shared_ptr<FrontendConverter> obtainConverter(
     jni::local_ref<jni::JavaClass<ExpectedType>::javaobject> expectedType
   );
+
+  /**
+   * Obtains a converter that doesn't need any other information than the combined cpp types.
+   * @return the converter or nullptr if the type has to be read from the `ExpectedType`.
+   */
+  std::shared_ptr<FrontendConverter> obtainSimpleConverter(CppType combinedType) const;
 private:
   FrontendConverterProvider() = default;
 
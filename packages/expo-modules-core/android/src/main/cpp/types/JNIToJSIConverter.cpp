@@ -1,8 +1,13 @@
 // Copyright © 2021-present 650 Industries, Inc. (aka Expo)
 
 #include "JNIToJSIConverter.h"
+#include "FrontendConverter.h"
 #include "../JavaReferencesCache.h"
 
+#include <fbjni/ByteBuffer.h>
+
+#include <cstring>
+
 namespace react = facebook::react;
 
 namespace expo {
@@ -10,18 +15,113 @@ namespace expo {
 // This value should be synced with the value in **FollyDynamicExtensionConverter.kt**
 constexpr char DYNAMIC_EXTENSION_PREFIX[] = "__expo_dynamic_extension__#";
 
+namespace {
+
+#if REACT_NATIVE_TARGET_VERSION >= 75
+
 /**
- * Create an JavaScript Uint8Array instance from Java ByteArray.
+ * Bytes copied out of a Java byte array or buffer. They are owned by the ArrayBuffer created over them.
  */
-jsi::Value createUint8Array(jsi::Runtime &rt, jni::alias_ref<jni::JArrayByte> byteArray) {
+class ByteArrayMutableBuffer : public jsi::MutableBuffer {
+public:
+  explicit ByteArrayMutableBuffer(jni::alias_ref<jni::JArrayByte> byteArray)
+    : length(byteArray->size()),
+      bytes(std::make_unique<uint8_t[]>(length)) {
+    byteArray->getRegion(0, static_cast<jsize>(length), reinterpret_cast<jbyte *>(bytes.get()));
+  }
+
+  ByteArrayMutableBuffer(const uint8_t *data, size_t size)
+    : length(size),
+      bytes(std::make_unique<uint8_t[]>(length)) {
+    std::memcpy(bytes.get(), data, length);
+  }
+
+  size_t size() const override {
+    return length;
+  }
+
+  uint8_t *data() override {
+    return bytes.get();
+  }
+
+private:
+  size_t length;
+  std::unique_ptr<uint8_t[]> bytes;
+};
+
+/**
+ * Memory of a direct `java.nio.ByteBuffer`.
+ * The global reference keeps the Java buffer, and so its memory, alive as long as the ArrayBuffer.
+ */
+class DirectByteBufferMutableBuffer : public jsi::MutableBuffer {
+public:
+  explicit DirectByteBufferMutableBuffer(jni::alias_ref<jni::JByteBuffer> byteBuffer)
+    : byteBuffer(jni::make_global(byteBuffer)),
+      address(byteBuffer->getDirectAddress()),
+      length(byteBuffer->getDirectSize()) {}
+
+  size_t size() const override {
+    return length;
+  }
+
+  uint8_t *data() override {
+    return address;
+  }
+
+private:
+  jni::global_ref<jni::JByteBuffer> byteBuffer;
+  uint8_t *address;
+  size_t length;
+};
+
+#endif
+
+jsi::Value createUint8Array(jsi::Runtime &rt, const jsi::ArrayBuffer &arrayBuffer) {
+  auto &uint8ArrayCtor = getJSIContext(rt)->jsRegistry->getObject<jsi::Function>(
+    JSReferencesCache::JSKeys::UINT8_ARRAY
+  );
+  return uint8ArrayCtor.callAsConstructor(rt, arrayBuffer);
+}
+
+#if REACT_NATIVE_TARGET_VERSION < 75
+
+jsi::ArrayBuffer createArrayBuffer(jsi::Runtime &rt, size_t size) {
   auto arrayBufferCtor = rt.global().getPropertyAsFunction(rt, "ArrayBuffer");
-  auto arrayBufferObject = arrayBufferCtor.callAsConstructor(rt, static_cast<int>(byteArray->size())).getObject(rt);
-  auto arrayBuffer = arrayBufferObject.getArrayBuffer(rt);
-  byteArray->getRegion(0, byteArray->size(), reinterpret_cast<signed char *>(arrayBuffer.data(rt)));
+  return arrayBufferCtor
+    .callAsConstructor(rt, static_cast<double>(size))
+    .getObject(rt)
+    .getArrayBuffer(rt);
+}
+
+#endif
+
+} // namespace
+
+jsi::Value createUint8Array(jsi::Runtime &rt, jni::alias_ref<jni::JArrayByte> byteArray) {
+#if REACT_NATIVE_TARGET_VERSION >= 75
+  auto arrayBuffer = jsi::ArrayBuffer(rt, std::make_shared<ByteArrayMutableBuffer>(byteArray));
+#else
+  auto arrayBuffer = createArrayBuffer(rt, byteArray->size());
+  byteArray->getRegion(0, byteArray->size(), reinterpret_cast<jbyte *>(arrayBuffer.data(rt)));
+#endif
+  return createUint8Array(rt, arrayBuffer);
+}
 
-  auto uint8ArrayCtor = rt.global().getPropertyAsFunction(rt, "Uint8Array");
-  auto uint8Array = uint8ArrayCtor.callAsConstructor(rt, arrayBufferObject).getObject(rt);
-  return uint8Array;
+jsi::Value createUint8Array(jsi::Runtime &rt, jni::alias_ref<jni::JByteBuffer> byteBuffer) {
+#if REACT_NATIVE_TARGET_VERSION >= 75
+  uint8_t *address = byteBuffer->getDirectAddress();
+  size_t size = byteBuffer->getDirectSize();
+  // A buffer wrapping the JS memory of an argument would create a second ArrayBuffer over memory owned by the first one.
+  auto arrayBuffer = WrappedByteBuffersScope::contains(address, size)
+    ? jsi::ArrayBuffer(rt, std::make_shared<ByteArrayMutableBuffer>(address, size))
+    : jsi::ArrayBuffer(rt, std::make_shared<DirectByteBufferMutableBuffer>(byteBuffer));
+#else
+  // Runtimes without `jsi::MutableBuffer` support can't wrap foreign memory, so the bytes are copied.
+  size_t size = byteBuffer->getDirectSize();
+  auto arrayBuffer = createArrayBuffer(rt, size);
+  std::memcpy(arrayBuffer.data(rt), byteBuffer->getDirectAddress(), size);
+#endif
+  return createUint8Array(rt, arrayBuffer);
 }
 
 /**
@@ -41,6 +141,116 @@ std::optional<jsi::Value> convertStringToFollyDynamicIfNeeded(jsi::Runtime &rt,
   return std::nullopt;
 }
 
+ReturnTypeConverter::ReturnTypeConverter(
+  jni::alias_ref<ExpectedType::javaobject> returnType
+) {
+  CppType combinedTypes = returnType->getCombinedTypes();
+  switch (combinedTypes) {
+    case CppType::NONE:
+    case CppType::DOUBLE:
+    case CppType::INT:
+    case CppType::FLOAT:
+    case CppType::BOOLEAN:
+    case CppType::STRING:
+      type = combinedTypes;
+      break;
+    case CppType::LIST:
+    case CppType::MAP: {
+      auto parameterType = returnType->getFirstType()->getFirstParameterType();
+      if (parameterType != nullptr) {
+        type = combinedTypes;
+        parameterConverter = std::make_unique<ReturnTypeConverter>(parameterType);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+jsi::Value ReturnTypeConverter::convert(
+  JNIEnv *env,
+  jsi::Runtime &rt,
+  const jni::local_ref<jobject> &value
+) const {
+  if (value == nullptr) {
+    return jsi::Value::null();
+  }
+
+  auto &cache = JCacheHolder::get();
+  // The declared type isn't enforced at runtime, e.g. an unchecked cast can put integers into a `List<Double>`.
+  // That's why the class is checked before the reference is reinterpreted. Other values go through `expo::convert`.
+  const auto isInstanceOf = [env, &value](jclass clazz) {
+    return env->IsInstanceOf(value.get(), clazz);
+  };
+
+  // See the comment in `expo::convert` - the same trick is used to avoid creating new local references.
+#define CAST(type) *((jni::local_ref<type>*)((void*)&value))
+
+  switch (type) {
+    case CppType::NONE:
+      return jsi::Value::undefined();
+    case CppType::DOUBLE:
+      if (isInstanceOf(cache.jDouble.clazz)) {
+        return convertToJS(env, rt, CAST(jni::JDouble));
+      }
+      break;
+    case CppType::INT:
+      if (isInstanceOf(cache.jInteger.clazz)) {
+        return convertToJS(env, rt, CAST(jni::JInteger));
+      }
+      break;
+    case CppType::FLOAT:
+      if (isInstanceOf(cache.jFloat.clazz)) {
+        return convertToJS(env, rt, CAST(jni::JFloat));
+      }
+      break;
+    case CppType::BOOLEAN:
+      if (isInstanceOf(cache.jBoolean.clazz)) {
+        return convertToJS(env, rt, CAST(jni::JBoolean));
+      }
+      break;
+    case CppType::STRING:
+      if (isInstanceOf(cache.jString)) {
+        return convertToJS(env, rt, CAST(jni::JString));
+      }
+      break;
+    case CppType::LIST: {
+      if (!isInstanceOf(cache.jCollection)) {
+        break;
+      }
+      const auto &list = CAST(jni::JCollection<jobject>);
+      auto jsArray = jsi::Array(rt, list->size());
+      size_t index = 0;
+      for (const auto &item: *list) {
+        jsArray.setValueAtIndex(rt, index++, parameterConverter->convert(env, rt, item));
+      }
+      return jsArray;
+    }
+    case CppType::MAP: {
+      if (!isInstanceOf(cache.jMap)) {
+        break;
+      }
+      const auto &map = CAST(jni::JMap<jobject, jobject>);
+      jsi::Object jsObject(rt);
+      for (const auto &entry: *map) {
+        // Keys that aren't strings, e.g. numbers, are converted the same way as by `toString` in Kotlin.
+        auto key = env->IsInstanceOf(entry.first.get(), cache.jString)
+          ? jni::static_ref_cast<jni::JString>(entry.first)->toStdString()
+          : entry.first->toString();
+        jsObject.setProperty(rt, key.c_str(), parameterConverter->convert(env, rt, entry.second));
+      }
+      return jsObject;
+    }
+    default:
+      break;
+  }
+
+#undef CAST
+
+  return ::expo::convert(env, rt, value);
+}
+
 jsi::Value convert(
   JNIEnv *env,
   jsi::Runtime &rt,
@@ -72,6 +282,14 @@ jsi::Value convert(
   CAST_AND_RETURN(JSharedObject::javaobject, cache.jSharedObject)
   CAST_AND_RETURN(JavaScriptTypedArray::javaobject, cache.jJavaScriptTypedArray)
 
+  // Byte arrays and buffers become Uint8Arrays instead of arrays of numbers.
+  if (env->IsInstanceOf(unpackedValue, cache.jByteArray)) {
+    return createUint8Array(rt, *((jni::local_ref<jni::JArrayByte> *) ((void *) &value)));
+  }
+  if (env->IsInstanceOf(unpackedValue, cache.jByteBuffer)) {
+    return createUint8Array(rt, *((jni::local_ref<jni::JByteBuffer> *) ((void *) &value)));
+  }
+
   CAST_AND_RETURN(jni::JMap<jstring COMMA jobject>, cache.jMap)
   CAST_AND_RETURN(jni::JCollection<jobject>, cache.jCollection)
 
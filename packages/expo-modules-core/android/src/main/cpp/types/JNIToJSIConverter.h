@@ -6,9 +6,11 @@
 #include "../JSharedObject.h"
 #include "../JNIUtils.h"
 #include "ObjectDeallocator.h"
+#include "ExpectedType.h"
 #include "../javaclasses/Collections.h"
 
 #include <fbjni/fbjni.h>
+#include <fbjni/ByteBuffer.h>
 #include <jsi/jsi.h>
 #include <optional>
 
@@ -30,6 +32,42 @@ jsi::Value convert(
   const jni::local_ref<jobject> &value
 );
 
+/**
+ * Converts results of a function with a declared return type.
+ * The converter tree is built once from the type described by the Kotlin side,
+ * so only the parts typed as `Any` need to be probed by `convert`.
+ */
+class ReturnTypeConverter {
+public:
+  explicit ReturnTypeConverter(jni::alias_ref<ExpectedType::javaobject> returnType);
+
+  jsi::Value convert(
+    JNIEnv *env,
+    jsi::Runtime &rt,
+    const jni::local_ref<jobject> &value
+  ) const;
+
+private:
+  CppType type = CppType::ANY;
+  /**
+   * Converter for elements of a list or values of a map.
+   */
+  std::unique_ptr<ReturnTypeConverter> parameterConverter = nullptr;
+};
+
+/**
+ * Creates a Uint8Array holding a copy of the Java byte array.
+ * The bytes are copied once, straight into the memory backing the new ArrayBuffer.
+ */
+jsi::Value createUint8Array(jsi::Runtime &rt, jni::alias_ref<jni::JArrayByte> byteArray);
+
+/**
+ * Creates a Uint8Array over the memory of a direct `java.nio.ByteBuffer` without copying it.
+ * The Java buffer stays alive until the ArrayBuffer is garbage collected.
+ * Buffers wrapping the JS memory of arguments of the sync call in progress are copied instead.
+ */
+jsi::Value createUint8Array(jsi::Runtime &rt, jni::alias_ref<jni::JByteBuffer> byteBuffer);
+
 /**
  * Convert a string with FollyDynamicExtensionConverter support.
  */
@@ -52,9 +52,7 @@ class ModuleHolder<T : Module>(val module: T) {
       if (viewFunctions?.isNotEmpty() == true) {
         trace("Attaching view prototype") {
           val viewDecorator = JSDecoratorsBridgingObject(jniDeallocator)
-          viewFunctions.forEach { function ->
-            function.attachToJSObject(appContext, viewDecorator, "${name}_${definition.viewManagerDefinition?.viewType?.name}")
-          }
+          viewDecorator.registerFunctions(appContext, viewFunctions.iterator(), "${name}_${definition.viewManagerDefinition?.viewType?.name}")
 
           moduleDecorator.registerObject("ViewPrototype", viewDecorator)
         }
@@ -96,11 +94,7 @@ class ModuleHolder<T : Module>(val module: T) {
     }
 
     trace("Attaching functions") {
-      definition
-        .functions
-        .forEach { function ->
-          function.attachToJSObject(appContext, moduleDecorator, name)
-        }
+      moduleDecorator.registerFunctions(appContext, definition.functions, name)
     }
 
     trace("Attaching properties") {
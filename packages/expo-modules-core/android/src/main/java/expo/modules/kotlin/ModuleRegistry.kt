@@ -34,6 +34,7 @@ class ModuleRegistry(
     }
 
     registry[holder.name] = holder
+    runtimeContext.get()?.invalidateModulesIndex()
   }
 
   fun register(vararg modules: Module) {
@@ -117,6 +118,7 @@ class ModuleRegistry(
 
   fun cleanUp() {
     registry.clear()
+    runtimeContext.get()?.invalidateModulesIndex()
     logger.info("✅ ModuleRegistry was destroyed")
   }
 
@@ -36,6 +36,15 @@ class RuntimeContext(
     return this::jsiContext.isInitialized
   }
 
+  /**
+   * Notifies the JSI part that the list of registered modules has changed.
+   */
+  internal fun invalidateModulesIndex() {
+    if (isJSIContextInitialized()) {
+      jsiContext.invalidateModulesIndex()
+    }
+  }
+
   /**
    * Evaluates JavaScript code represented as a string.
    */
@@ -0,0 +1,38 @@
+package expo.modules.kotlin.events
+
+/**
+ * Describes how events sent from native code are delivered to JavaScript.
+ * Events with a policy other than [Immediate] are held by the cpp part and delivered
+ * at most once per frame. Their payloads are converted only when they are delivered.
+ * The [kind] value has to be synced with `EventDeliveryQueue::Policy` in cpp.
+ */
+sealed class EventDeliveryPolicy(
+  internal val kind: Int,
+  internal val minIntervalMs: Long = 0
+) {
+  /**
+   * Every event is delivered as soon as possible. The default policy.
+   */
+  data object Immediate : EventDeliveryPolicy(0)
+
+  /**
+   * Only the latest event sent before the next frame is delivered.
+   * Useful for events describing a state, like a position or a progress.
+   */
+  data object LatestValue : EventDeliveryPolicy(1)
+
+  /**
+   * Only the latest event is delivered, not more often than [hz] times per second.
+   */
+  class MaxRate(hz: Double) : EventDeliveryPolicy(2, (1000.0 / hz).toLong()) {
+    init {
+      require(hz > 0) { "The rate has to be positive." }
+    }
+  }
+
+  /**
+   * All events sent before the next frame are delivered at once.
+   * The listener receives an array of the event payloads.
+   */
+  data object Batched : EventDeliveryPolicy(3)
+}
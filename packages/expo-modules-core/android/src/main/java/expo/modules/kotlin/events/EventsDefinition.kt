@@ -1,3 +1,9 @@
 package expo.modules.kotlin.events
 
-class EventsDefinition(val names: Array<out String>)
+class EventsDefinition(
+  val names: Array<out String>,
+  val deliveryPolicies: Map<String, EventDeliveryPolicy> = emptyMap()
+) {
+  fun deliveryPolicy(eventName: String): EventDeliveryPolicy =
+    deliveryPolicies[eventName] ?: EventDeliveryPolicy.Immediate
+}
@@ -47,8 +47,17 @@ class KModuleEventEmitterWrapper(
   private fun emitNative(eventName: String, eventBody: Map<String, Any?>?) {
     val runtimeContext = moduleHolder.module.runtimeContext
     val jsObject = moduleHolder.safeJSObject ?: return
+    val deliveryPolicy = moduleHolder.definition.eventsDefinition?.deliveryPolicy(eventName)
+      ?: EventDeliveryPolicy.Immediate
     try {
-      JNIUtils.emitEvent(jsObject, runtimeContext.jsiContext, eventName, eventBody)
+      JNIUtils.emitEvent(
+        jsObject,
+        runtimeContext.jsiContext,
+        eventName,
+        eventBody,
+        deliveryPolicy.kind,
+        deliveryPolicy.minIntervalMs
+      )
     } catch (e: Exception) {
       // If the jsObject is valid, we should throw an exception.
       // Otherwise, we should ignore it.
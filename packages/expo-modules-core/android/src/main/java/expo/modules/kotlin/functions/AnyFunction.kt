@@ -10,6 +10,7 @@ import expo.modules.kotlin.iterator
 import expo.modules.kotlin.jni.ExpectedType
 import expo.modules.kotlin.jni.JavaScriptObject
 import expo.modules.kotlin.jni.decorators.JSDecoratorsBridgingObject
+import expo.modules.kotlin.jni.decorators.JSFunctionsBatch
 import expo.modules.kotlin.recycle
 import expo.modules.kotlin.types.AnyType
 import kotlin.reflect.KClass
@@ -116,8 +117,16 @@ abstract class AnyFunction(
 
   /**
    * Attaches current function to the provided js object.
+   * Prefer [JSDecoratorsBridgingObject.registerFunctions] when attaching more than one function.
    */
-  abstract fun attachToJSObject(appContext: AppContext, jsObject: JSDecoratorsBridgingObject, moduleName: String)
+  fun attachToJSObject(appContext: AppContext, jsObject: JSDecoratorsBridgingObject, moduleName: String) {
+    jsObject.registerFunctions(appContext, listOf(this).iterator(), moduleName)
+  }
+
+  /**
+   * Appends current function to the batch that will be attached to a js object in a single JNI call.
+   */
+  abstract fun appendTo(functions: JSFunctionsBatch, appContext: AppContext, moduleName: String)
 
   internal fun getCppRequiredTypes(): List<ExpectedType> {
     return desiredArgsTypes.map { it.getCppRequiredTypes() }
@@ -7,7 +7,7 @@ import expo.modules.kotlin.Promise
 import expo.modules.kotlin.exception.FunctionCallException
 import expo.modules.kotlin.exception.exceptionDecorator
 import expo.modules.kotlin.exception.toCodedException
-import expo.modules.kotlin.jni.decorators.JSDecoratorsBridgingObject
+import expo.modules.kotlin.jni.decorators.JSFunctionsBatch
 import expo.modules.kotlin.types.AnyType
 import expo.modules.kotlin.weak
 import kotlinx.coroutines.launch
@@ -21,13 +21,13 @@ abstract class AsyncFunction(
 ) : BaseAsyncFunctionComponent(name, desiredArgsTypes) {
   internal abstract fun callUserImplementation(args: Array<Any?>, promise: Promise, appContext: AppContext)
 
-  override fun attachToJSObject(appContext: AppContext, jsObject: JSDecoratorsBridgingObject, moduleName: String) {
+  override fun appendTo(functions: JSFunctionsBatch, appContext: AppContext, moduleName: String) {
     val appContextHolder = appContext.weak()
-    jsObject.registerAsyncFunction(
+    functions.addAsyncFunction(
       name,
       takesOwner,
       isEnumerable,
-      desiredArgsTypes.map { it.getCppRequiredTypes() }.toTypedArray()
+      getCppRequiredTypes()
     ) { args, promiseImpl ->
       if (BuildConfig.DEBUG) {
         promiseImpl.decorateWithDebugInformation(
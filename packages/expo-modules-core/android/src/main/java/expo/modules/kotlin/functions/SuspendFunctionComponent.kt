@@ -5,7 +5,7 @@ import expo.modules.kotlin.AppContext
 import expo.modules.kotlin.exception.FunctionCallException
 import expo.modules.kotlin.exception.exceptionDecorator
 import expo.modules.kotlin.exception.toCodedException
-import expo.modules.kotlin.jni.decorators.JSDecoratorsBridgingObject
+import expo.modules.kotlin.jni.decorators.JSFunctionsBatch
 import expo.modules.kotlin.types.AnyType
 import expo.modules.kotlin.weak
 import kotlinx.coroutines.CoroutineScope
@@ -17,13 +17,13 @@ class SuspendFunctionComponent(
   desiredArgsTypes: Array<AnyType>,
   private val body: suspend CoroutineScope.(args: Array<out Any?>) -> Any?
 ) : BaseAsyncFunctionComponent(name, desiredArgsTypes) {
-  override fun attachToJSObject(appContext: AppContext, jsObject: JSDecoratorsBridgingObject, moduleName: String) {
+  override fun appendTo(functions: JSFunctionsBatch, appContext: AppContext, moduleName: String) {
     val appContextHolder = appContext.weak()
-    jsObject.registerAsyncFunction(
+    functions.addAsyncFunction(
       name,
       takesOwner,
       isEnumerable,
-      desiredArgsTypes.map { it.getCppRequiredTypes() }.toTypedArray()
+      getCppRequiredTypes()
     ) { args, promiseImpl ->
       if (BuildConfig.DEBUG) {
         promiseImpl.decorateWithDebugInformation(
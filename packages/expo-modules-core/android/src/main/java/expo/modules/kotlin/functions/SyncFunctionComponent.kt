@@ -3,10 +3,13 @@ package expo.modules.kotlin.functions
 import expo.modules.kotlin.AppContext
 import expo.modules.kotlin.exception.FunctionCallException
 import expo.modules.kotlin.exception.exceptionDecorator
+import expo.modules.kotlin.jni.CppType
 import expo.modules.kotlin.jni.JNIFunctionBody
-import expo.modules.kotlin.jni.decorators.JSDecoratorsBridgingObject
+import expo.modules.kotlin.jni.JNIPrimitiveFunctionBody
+import expo.modules.kotlin.jni.decorators.JSFunctionsBatch
 import expo.modules.kotlin.types.AnyType
 import expo.modules.kotlin.types.ReturnType
+import kotlin.reflect.KClass
 
 class SyncFunctionComponent(
   name: String,
@@ -29,13 +32,51 @@ class SyncFunctionComponent(
     }
   }
 
-  override fun attachToJSObject(appContext: AppContext, jsObject: JSDecoratorsBridgingObject, moduleName: String) {
-    jsObject.registerSyncFunction(
+  /**
+   * Returns a body that receives arguments without boxing,
+   * or `null` if the signature contains something other than primitives and strings.
+   * The cpp side falls back to the regular body when the actual arguments don't match.
+   */
+  internal fun getJNIPrimitiveFunctionBody(moduleName: String): JNIPrimitiveFunctionBody? {
+    if (takesOwner || returnType.primitiveCppType == null) {
+      return null
+    }
+    val primitiveArgTypes = desiredArgsTypes.map { argType ->
+      val classifier = argType.kType.classifier as? KClass<*>
+      primitiveArgCppTypes.firstOrNull { it.clazz == classifier } ?: return null
+    }.toTypedArray()
+
+    return JNIPrimitiveFunctionBody(primitiveArgTypes) { args ->
+      exceptionDecorator({
+        FunctionCallException(name, moduleName, it)
+      }) {
+        body(args)
+      }
+    }
+  }
+
+  override fun appendTo(functions: JSFunctionsBatch, appContext: AppContext, moduleName: String) {
+    val primitiveBody = getJNIPrimitiveFunctionBody(moduleName)
+    functions.addSyncFunction(
       name,
       takesOwner,
       isEnumerable,
-      getCppRequiredTypes().toTypedArray(),
-      getJNIFunctionBody(moduleName, appContext)
+      getCppRequiredTypes(),
+      returnType.cppReturnType,
+      getJNIFunctionBody(moduleName, appContext),
+      returnType.primitiveCppType?.value ?: CppType.NONE.value,
+      primitiveBody
+    )
+  }
+
+  private companion object {
+    val primitiveArgCppTypes = arrayOf(
+      CppType.DOUBLE,
+      CppType.INT,
+      CppType.LONG,
+      CppType.FLOAT,
+      CppType.BOOLEAN,
+      CppType.STRING
     )
   }
 }
@@ -3,6 +3,7 @@ package expo.modules.kotlin.jni
 import com.facebook.react.bridge.ReadableArray
 import com.facebook.react.bridge.ReadableMap
 import expo.modules.kotlin.typedarray.TypedArray
+import java.nio.ByteBuffer
 import kotlin.reflect.KClass
 
 private var nextValue = 0
@@ -32,5 +33,6 @@ enum class CppType(val clazz: KClass<*>, val value: Int = nextValue()) {
   VIEW_TAG(Int::class),
   SHARED_OBJECT_ID(Int::class),
   JS_FUNCTION(JavaScriptFunction::class),
+  BYTE_BUFFER(ByteBuffer::class),
   ANY(Any::class)
 }
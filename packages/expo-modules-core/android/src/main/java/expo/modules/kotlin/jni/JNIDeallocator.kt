@@ -1,7 +1,6 @@
 package expo.modules.kotlin.jni
 
 import expo.modules.core.interfaces.DoNotStrip
-import java.lang.ref.PhantomReference
 import java.lang.ref.ReferenceQueue
 import java.lang.ref.WeakReference
 
@@ -13,14 +12,22 @@ interface Destructible {
 @DoNotStrip
 class JNIDeallocator(shouldCreateDestructorThread: Boolean = true) : AutoCloseable {
   /**
-   * A [PhantomReference] queue managed by JVM
+   * A [WeakReference] queue managed by JVM
    */
   private val referenceQueue = ReferenceQueue<Destructible>()
 
   /**
-   * A registry to keep all active [Destructible] objects and their [PhantomReference]s
+   * A registry to keep all active [Destructible] objects.
+   * A single [WeakReference] is used both to deallocate the object and to find out that it was garbage collected.
    */
-  private val destructorMap = mutableMapOf<PhantomReference<Destructible>, WeakReference<Destructible>>()
+  private val destructorSet = mutableSetOf<WeakReference<Destructible>>()
+
+  /**
+   * Passes references buffered by the cpp part to [addReferences].
+   * Set by the [JSIContext], which collects references created on the cpp side in batches.
+   */
+  @Volatile
+  internal var pendingReferencesFlusher: (() -> Unit)? = null
 
   /**
    * A thread that clears your registry when an object has been garbage collected
@@ -31,11 +38,11 @@ class JNIDeallocator(shouldCreateDestructorThread: Boolean = true) : AutoCloseab
       override fun run() {
         while (!isInterrupted) {
           try {
-            // Referent of PhantomReference were garbage collected so we can remove it from our registry.
+            // Referent of WeakReference were garbage collected so we can remove it from our registry.
             // Note that we don't have to call `deallocate` method - it was called [com.facebook.jni.HybridData].
             val current = referenceQueue.remove()
-            synchronized(this) {
-              destructorMap.remove(current)
+            synchronized(this@JNIDeallocator) {
+              destructorSet.remove(current)
             }
           } catch (e: InterruptedException) {
             return
@@ -56,19 +63,32 @@ class JNIDeallocator(shouldCreateDestructorThread: Boolean = true) : AutoCloseab
    */
   @DoNotStrip
   fun addReference(destructible: Destructible): Unit = synchronized(this) {
-    val weakRef = WeakReference(destructible)
-    val phantomRef = PhantomReference(destructible, referenceQueue)
-    destructorMap[phantomRef] = weakRef
+    destructorSet.add(WeakReference(destructible, referenceQueue))
+  }
+
+  /**
+   * Adds many references at once. Called from the cpp part with a batch of references.
+   */
+  @Suppress("unused")
+  @DoNotStrip
+  fun addReferences(destructibles: Array<Destructible?>): Unit = synchronized(this) {
+    destructibles.forEach { destructible ->
+      if (destructible != null) {
+        destructorSet.add(WeakReference(destructible, referenceQueue))
+      }
+    }
   }
 
   /**
    * Deallocates valid references and clears the internal registry.
    */
   internal fun deallocate() = synchronized(this) {
-    destructorMap.values.forEach {
+    pendingReferencesFlusher?.invoke()
+    pendingReferencesFlusher = null
+    destructorSet.forEach {
       it.get()?.deallocate()
     }
-    destructorMap.clear()
+    destructorSet.clear()
     destructorThread?.interrupt()
   }
 
@@ -77,7 +97,8 @@ class JNIDeallocator(shouldCreateDestructorThread: Boolean = true) : AutoCloseab
    * and are present in the memory.
    */
   fun inspectMemory() = synchronized(this) {
-    destructorMap.values.mapNotNull { it.get() }
+    pendingReferencesFlusher?.invoke()
+    destructorSet.mapNotNull { it.get() }
   }
 
   override fun close() {
@@ -16,6 +16,52 @@ fun interface JNIFunctionBody {
   fun invoke(args: Array<Any?>): Any?
 }
 
+/**
+ * It's a wrapper for a promise-less function which takes only primitives and strings.
+ * Numbers are passed as raw bits of doubles and booleans as 0 or 1 in `primitives`, strings in `strings`.
+ * Each argument uses the slot of its index.
+ * This class is intended to be passed to cpp code.
+ * If you want to modify it, please don't forget to change the corresponding jni::JavaClass.
+ */
+@DoNotStrip
+class JNIPrimitiveFunctionBody(
+  private val argTypes: Array<CppType>,
+  private val body: (args: Array<Any?>) -> Any?
+) {
+  private fun decodeArgs(primitives: LongArray, strings: Array<String?>): Array<Any?> {
+    return Array(argTypes.size) { index ->
+      when (argTypes[index]) {
+        CppType.DOUBLE -> Double.fromBits(primitives[index])
+        CppType.INT -> Double.fromBits(primitives[index]).toInt()
+        CppType.LONG -> Double.fromBits(primitives[index]).toLong()
+        CppType.FLOAT -> Double.fromBits(primitives[index]).toFloat()
+        CppType.BOOLEAN -> primitives[index] != 0L
+        else -> strings[index]
+      }
+    }
+  }
+
+  @DoNotStrip
+  fun invokeVoid(primitives: LongArray, strings: Array<String?>) {
+    body(decodeArgs(primitives, strings))
+  }
+
+  @DoNotStrip
+  fun invokeDouble(primitives: LongArray, strings: Array<String?>): Double {
+    return (body(decodeArgs(primitives, strings)) as Number).toDouble()
+  }
+
+  @DoNotStrip
+  fun invokeBoolean(primitives: LongArray, strings: Array<String?>): Boolean {
+    return body(decodeArgs(primitives, strings)) as Boolean
+  }
+
+  @DoNotStrip
+  fun invokeString(primitives: LongArray, strings: Array<String?>): String? {
+    return body(decodeArgs(primitives, strings)) as String?
+  }
+}
+
 /**
  * It's a wrapper for a promise function that will be invoked from JS.
  * This interface is intended to be passed to cpp code.
@@ -24,7 +24,9 @@ class JNIUtils {
       jsiThis: JavaScriptModuleObject,
       jsiContext: JSIContext,
       eventName: String,
-      eventBody: Map<String, Any?>?
+      eventBody: Map<String, Any?>?,
+      deliveryPolicy: Int,
+      minIntervalMs: Long
     )
   }
 }
@@ -1,5 +1,8 @@
 package expo.modules.kotlin.jni
 
+import android.os.Handler
+import android.os.Looper
+import android.view.Choreographer
 import com.facebook.jni.HybridData
 import com.facebook.react.bridge.RuntimeExecutor
 import com.facebook.react.common.annotations.FrameworkAPI
@@ -41,6 +44,7 @@ class JSIContext : Destructible, AutoCloseable {
       runtimeContext.jniDeallocator,
       jsInvokerHolder
     )
+    runtimeContext.jniDeallocator.pendingReferencesFlusher = ::flushDeallocatorReferencesIfValid
   }
 
   fun installJSIForBridgeless(
@@ -54,6 +58,7 @@ class JSIContext : Destructible, AutoCloseable {
       runtimeContext.jniDeallocator,
       runtimeExecutor
     )
+    runtimeContext.jniDeallocator.pendingReferencesFlusher = ::flushDeallocatorReferencesIfValid
   }
 
   /**
@@ -94,8 +99,63 @@ class JSIContext : Destructible, AutoCloseable {
    */
   external fun drainJSEventLoop()
 
+  /**
+   * Drops the snapshot of available modules kept by the cpp part.
+   * Has to be called whenever the module registry changes.
+   */
+  external fun invalidateModulesIndex()
+
   external fun setNativeStateForSharedObject(id: Int, js: JavaScriptObject)
 
+  /**
+   * Delivers events held by the cpp part, because of their [expo.modules.kotlin.events.EventDeliveryPolicy].
+   */
+  external fun deliverPendingEvents()
+
+  /**
+   * Passes objects created by the cpp part to the [JNIDeallocator]. The cpp part does it in batches on its own.
+   */
+  private external fun flushDeallocatorReferences()
+
+  private fun flushDeallocatorReferencesIfValid() {
+    if (mHybridData.isValid) {
+      flushDeallocatorReferences()
+    }
+  }
+
+  private val mainHandler by lazy { Handler(Looper.getMainLooper()) }
+
+  private val deliverEventsFrameCallback = Choreographer.FrameCallback {
+    deliverEventsOnMainThread()
+  }
+
+  /**
+   * Delivers the events when the choreographer doesn't produce frames, e.g. when nothing on the screen changes.
+   */
+  private val deliverEventsFallback = Runnable {
+    deliverEventsOnMainThread()
+  }
+
+  private fun deliverEventsOnMainThread() {
+    // Whichever of the frame callback and the fallback runs first delivers all due events.
+    mainHandler.removeCallbacks(deliverEventsFallback)
+    Choreographer.getInstance().removeFrameCallback(deliverEventsFrameCallback)
+    if (mHybridData.isValid) {
+      deliverPendingEvents()
+    }
+  }
+
+  /**
+   * Asks for [deliverPendingEvents] to be called after the given delay.
+   * Can be replaced in tests to deliver the events manually.
+   */
+  internal var eventDeliveryScheduler: (delayMs: Long) -> Unit = { delayMs ->
+    mainHandler.postDelayed({
+      Choreographer.getInstance().postFrameCallback(deliverEventsFrameCallback)
+      mainHandler.postDelayed(deliverEventsFallback, EVENT_DELIVERY_FALLBACK_DELAY_MS)
+    }, delayMs)
+  }
+
   /**
    * Returns a `JavaScriptModuleObject` that is a bridge between [expo.modules.kotlin.modules.Module]
    * and HostObject exported via JSI.
@@ -109,12 +169,6 @@ class JSIContext : Destructible, AutoCloseable {
     return runtimeContextHolder.get()?.registry?.getModuleHolder(name)?.jsObject
   }
 
-  @Suppress("unused")
-  @DoNotStrip
-  fun hasModule(name: String): Boolean {
-    return runtimeContextHolder.get()?.registry?.hasModule(name) ?: false
-  }
-
   /**
    * Returns an array that contains names of available modules.
    */
@@ -140,13 +194,25 @@ class JSIContext : Destructible, AutoCloseable {
     return SharedObjectId(id).toJavaScriptObjectNull(runtimeContext)
   }
 
+  /**
+   * Called from the CPP part with ids of shared objects released by JavaScript since the last call.
+   */
   @Suppress("unused")
   @DoNotStrip
-  fun deleteSharedObject(id: Int) {
-    runtimeContextHolder
-      .get()
-      ?.sharedObjectRegistry
-      ?.delete(SharedObjectId(id))
+  fun deleteSharedObjects(ids: IntArray) {
+    val sharedObjectRegistry = runtimeContextHolder.get()?.sharedObjectRegistry ?: return
+    ids.forEach { sharedObjectRegistry.delete(SharedObjectId(it)) }
+  }
+
+  /**
+   * Called from the CPP part when there are events waiting for the delivery.
+   * They are delivered on the first frame after the given delay,
+   * or after [EVENT_DELIVERY_FALLBACK_DELAY_MS] if no frame is produced in the meantime.
+   */
+  @Suppress("unused")
+  @DoNotStrip
+  fun scheduleEventDelivery(delayMs: Long) {
+    eventDeliveryScheduler(delayMs)
   }
 
   @Suppress("unused")
@@ -183,6 +249,12 @@ class JSIContext : Destructible, AutoCloseable {
   }
 
   companion object {
+    /**
+     * How long the delivery waits for a frame before the events are delivered without it.
+     * It's a few frames long, so the fallback doesn't run when the frames are produced.
+     */
+    internal const val EVENT_DELIVERY_FALLBACK_DELAY_MS = 100L
+
     init {
       SoLoader.loadLibrary("expo-modules-core")
     }
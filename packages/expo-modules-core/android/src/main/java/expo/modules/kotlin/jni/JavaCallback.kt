@@ -9,6 +9,7 @@ import expo.modules.kotlin.logger
 import expo.modules.kotlin.sharedobjects.SharedObject
 import expo.modules.kotlin.types.JSTypeConverter
 import expo.modules.kotlin.types.toJSValueExperimental
+import java.nio.ByteBuffer
 
 @Suppress("KotlinJniMissingFunction")
 @DoNotStrip
@@ -37,6 +38,8 @@ class JavaCallback @DoNotStrip internal constructor(@DoNotStrip private val mHyb
       is LongArray -> invokeLongArray(result)
       is FloatArray -> invokeFloatArray(result)
       is DoubleArray -> invokeDoubleArray(result)
+      is ByteArray -> invokeByteArray(result)
+      is ByteBuffer -> invokeByteBuffer(result)
       else -> throw UnexpectedException("Unknown type: ${result.javaClass}")
     }
   }
@@ -94,6 +97,12 @@ class JavaCallback @DoNotStrip internal constructor(@DoNotStrip private val mHyb
   private external fun invokeLongArray(result: LongArray)
   private external fun invokeFloatArray(result: FloatArray)
   private external fun invokeDoubleArray(result: DoubleArray)
+  private external fun invokeByteArray(result: ByteArray)
+
+  /**
+   * Passes a direct buffer - its memory backs the JS ArrayBuffer without being copied.
+   */
+  private external fun invokeByteBuffer(result: ByteBuffer)
 
   private inline fun checkIfValid(body: () -> Unit) {
     try {
@@ -5,6 +5,7 @@ import expo.modules.core.interfaces.DoNotStrip
 import expo.modules.kotlin.AppContext
 import expo.modules.kotlin.types.JSTypeConverter
 import expo.modules.kotlin.types.LazyKType
+import expo.modules.kotlin.types.TypeConverter
 import expo.modules.kotlin.types.TypeConverterProviderImpl
 import kotlin.reflect.KType
 import kotlin.reflect.typeOf
@@ -17,25 +18,86 @@ class JavaScriptFunction<ReturnType : Any?> @DoNotStrip private constructor(@DoN
 
   fun isValid() = mHybridData.isValid
 
+  /**
+   * The return type converter resolved for [cachedReturnType].
+   * The same [ExpectedType] instance is passed on every call, so the cpp side can reuse its converter as well.
+   */
+  private var cachedReturnType: KType? = null
+  private var cachedConverter: TypeConverter<*>? = null
+  private var cachedExpectedReturnType: ExpectedType? = null
+
   private external fun invoke(thisValue: JavaScriptObject?, args: Array<Any?>, expectedReturnType: ExpectedType): Any?
 
+  private external fun invokeWithDoubles(thisValue: JavaScriptObject?, args: DoubleArray, expectedReturnType: ExpectedType): Any?
+
+  private external fun invokeWithBoolean(thisValue: JavaScriptObject?, arg: Boolean, expectedReturnType: ExpectedType): Any?
+
+  private external fun invokeWithString(thisValue: JavaScriptObject?, arg: String, expectedReturnType: ExpectedType): Any?
+
   operator fun invoke(vararg args: Any?, thisValue: JavaScriptObject? = null, appContext: AppContext? = null): ReturnType {
     // TODO(@lukmccall): check current thread
     val convertedArgs = args
       .map { JSTypeConverter.convertToJSValue(it) }
       .toTypedArray()
 
-    val converter = TypeConverterProviderImpl
-      .obtainTypeConverter(
-        returnType ?: LazyKType(
-          classifier = Unit::class,
-          isMarkedNullable = false,
-          kTypeProvider = { typeOf<Unit>() }
+    return convertResult(appContext) { expectedReturnType ->
+      invoke(thisValue, convertedArgs, expectedReturnType)
+    }
+  }
+
+  // Overloads for the most common callback signatures. Their arguments are passed without boxing.
+  // They don't take `thisValue` or `appContext`, so a call with more positional arguments,
+  // like `fn(1.0, null)`, still resolves to the vararg overload and passes all of them to JS.
+  // Calls that need `thisValue` or `appContext` use the vararg overload with named arguments.
+
+  operator fun invoke(arg: Double): ReturnType {
+    return convertResult(null) { expectedReturnType ->
+      invokeWithDoubles(null, doubleArrayOf(arg), expectedReturnType)
+    }
+  }
+
+  operator fun invoke(arg1: Double, arg2: Double): ReturnType {
+    return convertResult(null) { expectedReturnType ->
+      invokeWithDoubles(null, doubleArrayOf(arg1, arg2), expectedReturnType)
+    }
+  }
+
+  operator fun invoke(arg: Int): ReturnType {
+    return invoke(arg.toDouble())
+  }
+
+  operator fun invoke(arg: Boolean): ReturnType {
+    return convertResult(null) { expectedReturnType ->
+      invokeWithBoolean(null, arg, expectedReturnType)
+    }
+  }
+
+  operator fun invoke(arg: String): ReturnType {
+    return convertResult(null) { expectedReturnType ->
+      invokeWithString(null, arg, expectedReturnType)
+    }
+  }
+
+  private inline fun convertResult(appContext: AppContext?, call: (expectedReturnType: ExpectedType) -> Any?): ReturnType {
+    val type = returnType
+    var converter = cachedConverter
+    var expectedReturnType = cachedExpectedReturnType
+    if (converter == null || expectedReturnType == null || cachedReturnType !== type) {
+      converter = TypeConverterProviderImpl
+        .obtainTypeConverter(
+          type ?: LazyKType(
+            classifier = Unit::class,
+            isMarkedNullable = false,
+            kTypeProvider = { typeOf<Unit>() }
+          )
         )
-      )
+      expectedReturnType = converter.getCppRequiredTypes()
+      cachedReturnType = type
+      cachedConverter = converter
+      cachedExpectedReturnType = expectedReturnType
+    }
 
-    val expectedReturnType = converter.getCppRequiredTypes()
-    val result = invoke(thisValue, convertedArgs, expectedReturnType)
+    val result = call(expectedReturnType)
     @Suppress("UNCHECKED_CAST")
     return converter.convert(result, appContext) as ReturnType
   }
@@ -5,11 +5,14 @@ package expo.modules.kotlin.jni.decorators
 import com.facebook.jni.HybridData
 import com.facebook.react.bridge.NativeMap
 import expo.modules.core.interfaces.DoNotStrip
+import expo.modules.kotlin.AppContext
+import expo.modules.kotlin.functions.AnyFunction
 import expo.modules.kotlin.jni.Destructible
 import expo.modules.kotlin.jni.ExpectedType
 import expo.modules.kotlin.jni.JNIAsyncFunctionBody
 import expo.modules.kotlin.jni.JNIDeallocator
 import expo.modules.kotlin.jni.JNIFunctionBody
+import expo.modules.kotlin.jni.JNIPrimitiveFunctionBody
 
 /**
  * This class was introduced to bridge the gap between Kotlin and cpp only once.
@@ -33,7 +36,10 @@ class JSDecoratorsBridgingObject(jniDeallocator: JNIDeallocator) : Destructible
     takesOwner: Boolean,
     enumerable: Boolean,
     desiredTypes: Array<ExpectedType>,
-    body: JNIFunctionBody
+    returnType: ExpectedType,
+    body: JNIFunctionBody,
+    primitiveReturnType: Int,
+    primitiveBody: JNIPrimitiveFunctionBody?
   )
 
   external fun registerAsyncFunction(
@@ -44,6 +50,28 @@ class JSDecoratorsBridgingObject(jniDeallocator: JNIDeallocator) : Destructible
     body: JNIAsyncFunctionBody
   )
 
+  /**
+   * Registers all [functions] in a single JNI call.
+   */
+  fun registerFunctions(appContext: AppContext, functions: Iterator<AnyFunction>, moduleName: String) {
+    val batch = JSFunctionsBatch()
+    functions.forEach { function ->
+      function.appendTo(batch, appContext, moduleName)
+    }
+    if (!batch.isEmpty) {
+      batch.registerIn(this)
+    }
+  }
+
+  external fun registerFunctions(
+    names: String,
+    descriptor: IntArray,
+    expectedArgTypes: Array<ExpectedType>,
+    bodies: Array<Any>,
+    returnTypes: Array<ExpectedType?>,
+    primitiveBodies: Array<JNIPrimitiveFunctionBody?>
+  )
+
   external fun registerProperty(
     name: String,
     getterTakesOwner: Boolean,
@@ -0,0 +1,147 @@
+package expo.modules.kotlin.jni.decorators
+
+import expo.modules.kotlin.jni.CppType
+import expo.modules.kotlin.jni.ExpectedType
+import expo.modules.kotlin.jni.JNIAsyncFunctionBody
+import expo.modules.kotlin.jni.JNIFunctionBody
+import expo.modules.kotlin.jni.JNIPrimitiveFunctionBody
+
+/**
+ * Collects functions of a single JS object, so they can be passed to the cpp in one JNI call.
+ * Names and argument types are flattened into a compact descriptor, which the cpp reads without calling back to Kotlin.
+ * The [ExpectedType] objects are only read when the type can't be described by its [CppType] alone.
+ */
+class JSFunctionsBatch {
+  private val names = StringBuilder()
+
+  /**
+   * For each function: flags, primitive return type, combined return types, arity and combined types of every argument.
+   * The layout has to be kept in sync with `JSFunctionsDecorator::registerFunctions`.
+   */
+  private val descriptor = ArrayList<Int>()
+  private val expectedArgTypes = ArrayList<ExpectedType>()
+  private val bodies = ArrayList<Any>()
+  private val returnTypes = ArrayList<ExpectedType?>()
+  private val primitiveBodies = ArrayList<JNIPrimitiveFunctionBody?>()
+
+  val isEmpty: Boolean
+    get() = bodies.isEmpty()
+
+  fun addSyncFunction(
+    name: String,
+    takesOwner: Boolean,
+    enumerable: Boolean,
+    desiredTypes: List<ExpectedType>,
+    returnType: ExpectedType,
+    body: JNIFunctionBody,
+    primitiveReturnType: Int,
+    primitiveBody: JNIPrimitiveFunctionBody?
+  ) {
+    var flags = flagsOf(takesOwner, enumerable)
+    if (primitiveBody != null) {
+      flags = flags or HAS_PRIMITIVE_BODY
+    }
+    add(name, flags, primitiveReturnType, returnType.getCombinedTypes(), desiredTypes)
+    bodies.add(body)
+    returnTypes.add(returnType)
+    primitiveBodies.add(primitiveBody)
+  }
+
+  fun addAsyncFunction(
+    name: String,
+    takesOwner: Boolean,
+    enumerable: Boolean,
+    desiredTypes: List<ExpectedType>,
+    body: JNIAsyncFunctionBody
+  ) {
+    add(name, flagsOf(takesOwner, enumerable) or IS_ASYNC, CppType.NONE.value, CppType.NONE.value, desiredTypes)
+    bodies.add(body)
+    returnTypes.add(null)
+    primitiveBodies.add(null)
+  }
+
+  private fun flagsOf(takesOwner: Boolean, enumerable: Boolean): Int {
+    var flags = 0
+    if (takesOwner) {
+      flags = flags or TAKES_OWNER
+    }
+    if (enumerable) {
+      flags = flags or ENUMERABLE
+    }
+    return flags
+  }
+
+  private fun add(
+    name: String,
+    flags: Int,
+    primitiveReturnType: Int,
+    returnCombinedTypes: Int,
+    desiredTypes: List<ExpectedType>
+  ) {
+    names.append(name).append(NAME_SEPARATOR)
+    descriptor.add(flags)
+    descriptor.add(primitiveReturnType)
+    descriptor.add(returnCombinedTypes)
+    descriptor.add(desiredTypes.size)
+    desiredTypes.forEach { expectedType ->
+      descriptor.add(expectedType.getCombinedTypes())
+      expectedArgTypes.add(expectedType)
+    }
+  }
+
+  internal fun registerIn(decorator: JSDecoratorsBridgingObject) {
+    decorator.registerFunctions(
+      names.toString(),
+      descriptor.toIntArray(),
+      expectedArgTypes.toTypedArray(),
+      bodies.toTypedArray(),
+      returnTypes.toTypedArray(),
+      primitiveBodies.toTypedArray()
+    )
+  }
+
+  /**
+   * Registers the functions with a separate JNI call each, like before they were batched.
+   * Only used by tests, to check that both ways create the same JS functions.
+   */
+  internal fun registerOneByOneIn(decorator: JSDecoratorsBridgingObject) {
+    val functionNames = names.split(NAME_SEPARATOR)
+    var position = 0
+    var argIndex = 0
+    bodies.forEachIndexed { index, body ->
+      val flags = descriptor[position]
+      val primitiveReturnType = descriptor[position + 1]
+      val arity = descriptor[position + 3]
+      position += 4 + arity
+      val desiredTypes = expectedArgTypes.subList(argIndex, argIndex + arity).toTypedArray()
+      argIndex += arity
+
+      val takesOwner = flags and TAKES_OWNER != 0
+      val enumerable = flags and ENUMERABLE != 0
+      if (flags and IS_ASYNC != 0) {
+        decorator.registerAsyncFunction(functionNames[index], takesOwner, enumerable, desiredTypes, body as JNIAsyncFunctionBody)
+      } else {
+        decorator.registerSyncFunction(
+          functionNames[index],
+          takesOwner,
+          enumerable,
+          desiredTypes,
+          requireNotNull(returnTypes[index]),
+          body as JNIFunctionBody,
+          primitiveReturnType,
+          primitiveBodies[index]
+        )
+      }
+    }
+  }
+
+  private companion object {
+    // Values have to be kept in sync with `JSFunctionsDecorator.cpp`.
+    const val TAKES_OWNER = 1 shl 0
+    const val ENUMERABLE = 1 shl 1
+    const val IS_ASYNC = 1 shl 2
+    const val HAS_PRIMITIVE_BODY = 1 shl 3
+
+    const val NAME_SEPARATOR = '\u0000'
+  }
+}
@@ -7,6 +7,7 @@ import expo.modules.kotlin.Promise
 import expo.modules.kotlin.component6
 import expo.modules.kotlin.component7
 import expo.modules.kotlin.component8
+import expo.modules.kotlin.events.EventDeliveryPolicy
 import expo.modules.kotlin.events.EventsDefinition
 import expo.modules.kotlin.functions.AsyncFunction
 import expo.modules.kotlin.functions.AsyncFunctionBuilder
@@ -35,6 +36,8 @@ open class ObjectDefinitionBuilder {
   @PublishedApi
   internal var eventsDefinition: EventsDefinition? = null
 
+  private val eventDeliveryPolicies = mutableMapOf<String, EventDeliveryPolicy>()
+
   @PublishedApi
   internal var syncFunctions = mutableMapOf<String, SyncFunctionComponent>()
 
@@ -71,7 +74,7 @@ open class ObjectDefinitionBuilder {
       constantsProvider,
       syncFunctions + syncFunctionBuilder.mapValues { (_, value) -> value.build() },
       asyncFunctions,
-      eventsDefinition,
+      eventsDefinition?.let { EventsDefinition(it.names, eventDeliveryPolicies.toMap()) },
       properties.mapValues { (_, value) -> value.build() }
     )
   }
@@ -439,6 +442,14 @@ open class ObjectDefinitionBuilder {
     eventsDefinition = EventsDefinition(events)
   }
 
+  /**
+   * Sets how the given event is delivered to JavaScript. Events are delivered immediately by default.
+   * The event has to be also defined using the `Events` component.
+   */
+  fun EventDelivery(eventName: String, policy: EventDeliveryPolicy) {
+    eventDeliveryPolicies[eventName] = policy
+  }
+
   inline fun <reified T> Events() where T : Enumerable, T : Enum<T> {
     val primaryConstructor = T::class.primaryConstructor
     val events = if (primaryConstructor?.parameters?.size == 1) {
@@ -560,11 +571,7 @@ inline fun Module.Object(block: ObjectDefinitionBuilder.() -> Unit): JavaScriptM
   val decorator = JSDecoratorsBridgingObject(runtimeContext.jniDeallocator)
   decorator.registerConstants(convertedConstants)
 
-  objectData
-    .functions
-    .forEach { function ->
-      function.attachToJSObject(appContext, decorator, moduleName)
-    }
+  decorator.registerFunctions(appContext, objectData.functions, moduleName)
 
   objectData
     .properties
@@ -88,6 +88,11 @@ class SharedObjectRegistry(runtimeContext: RuntimeContext) {
     synchronized(this) {
       pairs.remove(id)
     }?.let { (native, _) ->
+      // The native object could have been passed back to JavaScript after its previous JavaScript object was collected.
+      // In that case, it was registered again under a new id and isn't released.
+      if (native.sharedObjectId != id) {
+        return
+      }
       native.sharedObjectId = SharedObjectId(0)
       native.sharedObjectDidRelease()
     }
@@ -23,6 +23,7 @@ import expo.modules.kotlin.typedarray.Uint8ClampedArray
 import java.io.File
 import java.net.URI
 import java.net.URL
+import java.nio.ByteBuffer
 import kotlin.reflect.KClass
 import kotlin.reflect.KType
 import kotlin.reflect.KTypeProjection
@@ -98,6 +99,7 @@ object AnyTypeProvider {
       String::class,
 
       ByteArray::class,
+      ByteBuffer::class,
       LongArray::class,
       IntArray::class,
       BooleanArray::class,
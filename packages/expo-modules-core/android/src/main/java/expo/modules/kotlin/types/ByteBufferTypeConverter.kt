@@ -0,0 +1,20 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+package expo.modules.kotlin.types
+
+import expo.modules.kotlin.AppContext
+import expo.modules.kotlin.jni.CppType
+import expo.modules.kotlin.jni.ExpectedType
+import java.nio.ByteBuffer
+
+/**
+ * Receives an `ArrayBuffer` or a typed array as a direct [ByteBuffer] in the native byte order.
+ * Synchronous functions get a buffer over the JS memory, which is valid only until the function returns,
+ * so it must not be stored or used from other threads. Returning it from the function gives JS a copy.
+ * Asynchronous functions get a copy, also for buffers nested in lists and maps.
+ */
+class ByteBufferTypeConverter(isOptional: Boolean) : NullAwareTypeConverter<ByteBuffer>(isOptional) {
+  override fun convertNonOptional(value: Any, context: AppContext?): ByteBuffer = value as ByteBuffer
+  override fun getCppRequiredTypes(): ExpectedType = ExpectedType(CppType.BYTE_BUFFER)
+  override fun isTrivial() = false
+}
@@ -11,6 +11,7 @@ import expo.modules.kotlin.types.folly.FollyDynamicExtensionConverter
 import java.io.File
 import java.net.URI
 import java.net.URL
+import java.nio.ByteBuffer
 import kotlin.time.Duration
 import kotlin.time.DurationUnit
 
@@ -41,6 +42,7 @@ object JSTypeConverter {
       is DoubleArray -> value.toJSValue(containerProvider)
       is BooleanArray -> value.toJSValue(containerProvider)
       is ByteArray -> FollyDynamicExtensionConverter.put(value)
+      is ByteBuffer -> FollyDynamicExtensionConverter.put(value.toByteArray())
       is Map<*, *> -> value.toJSValue(containerProvider)
       is Enum<*> -> value.toJSValue()
       is Record -> value.toJSValue(containerProvider)
@@ -67,7 +69,16 @@ object JSTypeConverter {
       is Bundle -> value.toJSValue(containerProvider)
       is Array<*> -> value.toJSValue(containerProvider)
       is IntArray, is FloatArray, is DoubleArray, is BooleanArray, is LongArray -> value
-      is ByteArray -> FollyDynamicExtensionConverter.put(value)
+      is ByteArray -> if (useExperimentalConverter) {
+        value
+      } else {
+        FollyDynamicExtensionConverter.put(value)
+      }
+      is ByteBuffer -> if (useExperimentalConverter) {
+        value.toJSValueExperimental()
+      } else {
+        FollyDynamicExtensionConverter.put(value.toByteArray())
+      }
       is Map<*, *> -> if (useExperimentalConverter) {
         value.toJSValueExperimental()
       } else {
@@ -11,6 +11,7 @@ import expo.modules.kotlin.records.Record
 import java.io.File
 import java.net.URI
 import java.net.URL
+import java.nio.ByteBuffer
 import kotlin.reflect.KProperty1
 import kotlin.reflect.full.declaredMemberProperties
 import kotlin.reflect.full.findAnnotation
@@ -157,6 +158,26 @@ fun BooleanArray.toJSValue(containerProvider: JSTypeConverter.ContainerProvider)
   }
 }
 
+/**
+ * Returns a buffer that can back a JS ArrayBuffer without copying - a direct buffer spanning only the remaining bytes.
+ * Heap buffers are copied into a [ByteArray].
+ */
+fun ByteBuffer.toJSValueExperimental(): Any {
+  if (!isDirect) {
+    return toByteArray()
+  }
+  return if (position() == 0 && limit() == capacity()) {
+    this
+  } else {
+    slice()
+  }
+}
+
+internal fun ByteBuffer.toByteArray(): ByteArray {
+  val source = duplicate()
+  return ByteArray(source.remaining()).also { source.get(it) }
+}
+
 fun Enum<*>.toJSValue(): Any? {
   val primaryConstructor = requireNotNull(this::class.primaryConstructor) {
     "Cannot convert enum without the primary constructor to js value"
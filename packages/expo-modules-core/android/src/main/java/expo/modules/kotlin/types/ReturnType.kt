@@ -1,17 +1,34 @@
 package expo.modules.kotlin.types
 
 import android.os.Bundle
-import expo.modules.kotlin.types.folly.FollyDynamicExtensionConverter
+import expo.modules.kotlin.jni.CppType
+import expo.modules.kotlin.jni.ExpectedType
+import java.nio.ByteBuffer
 import kotlin.reflect.KClass
+import kotlin.reflect.KType
+import kotlin.reflect.typeOf
 import kotlin.time.Duration
 import kotlin.time.DurationUnit
 
 object ReturnTypeProvider {
   val types = mutableMapOf<KClass<*>, ReturnType>()
+  val nullableTypes = mutableMapOf<KClass<*>, ReturnType>()
+  val genericTypes = mutableMapOf<KType, ReturnType>()
 
   inline fun <reified T> get(): ReturnType {
-    return types[T::class] ?: ReturnType(T::class).also {
-      types[T::class] = it
+    val isNullable = null is T
+    // Element types of collections and maps are part of the cpp return type,
+    // so those can't be shared between different type arguments.
+    if (Collection::class.java.isAssignableFrom(T::class.java) || Map::class.java.isAssignableFrom(T::class.java)) {
+      val kType = typeOf<T>()
+      return genericTypes[kType] ?: ReturnType(T::class, isNullable, kType).also {
+        genericTypes[kType] = it
+      }
+    }
+
+    val cache = if (isNullable) nullableTypes else types
+    return cache[T::class] ?: ReturnType(T::class, isNullable).also {
+      cache[T::class] = it
     }
   }
 }
@@ -74,7 +91,15 @@ interface ExperimentalJSTypeConverter<T> {
   class ByteArrayConverter : ExperimentalJSTypeConverter<ByteArray> {
     override fun convertToJS(value: Any?): Any? {
       enforceType<ByteArray?>(value)
-      return value?.let { FollyDynamicExtensionConverter.put(it) }
+      // The native side turns byte arrays into Uint8Arrays.
+      return value
+    }
+  }
+
+  class ByteBufferConverter : ExperimentalJSTypeConverter<ByteBuffer> {
+    override fun convertToJS(value: Any?): Any? {
+      enforceType<ByteBuffer?>(value)
+      return value?.toJSValueExperimental()
     }
   }
 
@@ -170,8 +195,54 @@ interface ExperimentalJSTypeConverter<T> {
 }
 
 class ReturnType(
-  private val klass: KClass<*>
+  private val klass: KClass<*>,
+  private val isNullable: Boolean = false,
+  private val kType: KType? = null
 ) {
+  /**
+   * The cpp type that can represent the result without boxing or `null` if the result has to be boxed.
+   * `CppType.NONE` means that the function doesn't return anything.
+   */
+  internal val primitiveCppType: CppType? = when (klass) {
+    Unit::class -> CppType.NONE
+    String::class -> CppType.STRING
+    Double::class, Int::class, Long::class, Float::class -> CppType.DOUBLE.takeUnless { isNullable }
+    Boolean::class -> CppType.BOOLEAN.takeUnless { isNullable }
+    else -> null
+  }
+
+  /**
+   * Describes the value produced by [convertToJS], so the cpp code can convert it
+   * without checking the class of every returned object.
+   * Parts that can't be described ahead of time are represented as [CppType.ANY].
+   */
+  internal val cppReturnType: ExpectedType by lazy {
+    if (klass == Unit::class) {
+      ExpectedType(CppType.NONE)
+    } else {
+      describeJSValue(klass, kType)
+    }
+  }
+
+  private fun describeJSValue(klass: KClass<*>?, kType: KType?): ExpectedType {
+    return when {
+      klass == Double::class || klass == Long::class -> ExpectedType(CppType.DOUBLE)
+      klass == Int::class -> ExpectedType(CppType.INT)
+      klass == Float::class -> ExpectedType(CppType.FLOAT)
+      klass == Boolean::class -> ExpectedType(CppType.BOOLEAN)
+      klass == String::class -> ExpectedType(CppType.STRING)
+      klass != null && kType != null && Map::class.java.isAssignableFrom(klass.java) -> {
+        val valueType = kType.arguments.getOrNull(1)?.type
+        ExpectedType.forMap(describeJSValue(valueType?.classifier as? KClass<*>, valueType))
+      }
+      klass != null && kType != null && Collection::class.java.isAssignableFrom(klass.java) -> {
+        val elementType = kType.arguments.firstOrNull()?.type
+        ExpectedType.forList(describeJSValue(elementType?.classifier as? KClass<*>, elementType))
+      }
+      else -> ExpectedType(CppType.ANY)
+    }
+  }
+
   private val converter: ExperimentalJSTypeConverter<*> = run {
     val directConverter = when (klass) {
       Unit::class -> ExperimentalJSTypeConverter.PassThroughConverter()
@@ -181,6 +252,7 @@ class ReturnType(
       DoubleArray::class -> ExperimentalJSTypeConverter.DoubleArrayConverter()
       BooleanArray::class -> ExperimentalJSTypeConverter.BooleanArrayConverter()
       ByteArray::class -> ExperimentalJSTypeConverter.ByteArrayConverter()
+      ByteBuffer::class -> ExperimentalJSTypeConverter.ByteBufferConverter()
       java.net.URI::class -> ExperimentalJSTypeConverter.URIConverter()
       java.net.URL::class -> ExperimentalJSTypeConverter.URLConverter()
       android.net.Uri::class -> ExperimentalJSTypeConverter.AndroidUriConverter()
@@ -41,6 +41,7 @@ import expo.modules.kotlin.views.ViewTypeConverter
 import java.io.File
 import java.net.URI
 import java.net.URL
+import java.nio.ByteBuffer
 import java.nio.file.Path
 import java.time.LocalDate
 import kotlin.reflect.KClass
@@ -255,6 +256,7 @@ object TypeConverterProviderImpl : TypeConverterProvider {
         }
       },
       ByteArray::class to ByteArrayTypeConverter(isOptional),
+      ByteBuffer::class to ByteBufferTypeConverter(isOptional),
 
       JavaScriptValue::class to createTrivialTypeConverter(
         isOptional, ExpectedType(CppType.JS_VALUE)
@@ -4,7 +4,10 @@ import android.content.Context
 import android.graphics.Canvas
 import android.widget.LinearLayout
 import androidx.annotation.UiThread
+import com.facebook.react.bridge.Arguments
 import com.facebook.react.uimanager.BackgroundStyleApplicator
+import com.facebook.react.uimanager.PixelUtil
+import com.facebook.react.uimanager.StateWrapper
 import expo.modules.kotlin.AppContext
 
 /**
@@ -28,6 +31,27 @@ abstract class ExpoView(
    */
   open val shouldUseAndroidLayout: Boolean = false
 
+  /**
+   * The state of the shadow node, provided by the view manager on the new architecture.
+   */
+  internal var stateWrapper: StateWrapper? = null
+
+  /**
+   * Sets the intrinsic size of the view in the shadow tree, so Yoga lays out the view with it in a single pass,
+   * without reporting the size to JavaScript and re-rendering.
+   * Sizes are in pixels. A given dimension overrides `width` or `height` from the style.
+   * Pass [Float.NaN] to keep a dimension from the style, or for both dimensions to clear the size.
+   * Has no effect on the old architecture.
+   */
+  fun setShadowNodeSize(width: Float, height: Float) {
+    val stateWrapper = stateWrapper ?: return
+    val state = Arguments.createMap().apply {
+      putDouble("width", PixelUtil.toDIPFromPixel(width).toDouble())
+      putDouble("height", PixelUtil.toDIPFromPixel(height).toDouble())
+    }
+    stateWrapper.updateState(state)
+  }
+
   /**
    * Manually trigger measure and layout.
    * If [shouldUseAndroidLayout] is set to `true`, this method will be called automatically after [requestLayout].
@@ -2,6 +2,7 @@ package expo.modules.kotlin.views
 
 import android.view.View
 import com.facebook.react.uimanager.ReactStylesDiffMap
+import com.facebook.react.uimanager.StateWrapper
 import com.facebook.react.uimanager.SimpleViewManager
 import com.facebook.react.uimanager.ThemedReactContext
 import com.facebook.react.uimanager.getBackingMap
@@ -26,6 +27,11 @@ class SimpleViewManagerWrapper(
     )
   }
 
+  override fun updateState(view: View, props: ReactStylesDiffMap?, stateWrapper: StateWrapper?): Any? {
+    (view as? ExpoView)?.stateWrapper = stateWrapper
+    return super.updateState(view, props, stateWrapper)
+  }
+
   override fun onAfterUpdateTransaction(view: View) {
     super.onAfterUpdateTransaction(view)
     viewWrapperDelegate.onViewDidUpdateProps(view)
@@ -2,6 +2,7 @@ package expo.modules.kotlin.modules
 
 import com.google.common.truth.Truth
 import expo.modules.core.Promise
+import expo.modules.kotlin.events.EventDeliveryPolicy
 import expo.modules.kotlin.events.EventName
 import org.junit.Assert
 import org.junit.Test
@@ -88,6 +89,21 @@ class ModuleDefinitionBuilderTest {
     Truth.assertThat(moduleDefinition.eventListeners[EventName.ACTIVITY_DESTROYS]).isNotNull()
   }
 
+  @Test
+  fun `builder should respect event delivery policies`() {
+    val moduleDefinition = unboundModuleDefinition {
+      Name("Module")
+      Events("onPosition", "onSample", "onStatus")
+      EventDelivery("onPosition", EventDeliveryPolicy.MaxRate(20.0))
+      EventDelivery("onSample", EventDeliveryPolicy.Batched)
+    }
+
+    val eventsDefinition = moduleDefinition.eventsDefinition!!
+    Truth.assertThat(eventsDefinition.deliveryPolicy("onPosition").minIntervalMs).isEqualTo(50)
+    Truth.assertThat(eventsDefinition.deliveryPolicy("onSample")).isEqualTo(EventDeliveryPolicy.Batched)
+    Truth.assertThat(eventsDefinition.deliveryPolicy("onStatus")).isEqualTo(EventDeliveryPolicy.Immediate)
+  }
+
   @Test
   fun `onStartObserving should be translated into method`() {
     val moduleDefinition = unboundModuleDefinition {
@@ -4,88 +4,162 @@
 
 #include <cxxreact/ErrorUtils.h>
 
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
 namespace expo::EventEmitter {
 
-#pragma mark - Listeners
+#pragma mark - Event names
+
+namespace {
+
+std::shared_mutex eventNamesMutex;
+std::unordered_map<std::string, EventId> eventIds;
+// A deque doesn't move its elements, so references returned by `getEventName` stay valid.
+std::deque<std::string> eventNames;
 
-void Listeners::add(jsi::Runtime &runtime, const std::string& eventName, const jsi::Function &listener) noexcept {
-  listenersMap[eventName].emplace_back(runtime, listener);
+} // namespace
+
+EventId internEventName(const std::string &eventName) {
+  if (std::optional<EventId> eventId = findEventName(eventName)) {
+    return *eventId;
+  }
+  std::unique_lock lock(eventNamesMutex);
+  auto [it, inserted] = eventIds.try_emplace(eventName, static_cast<EventId>(eventNames.size()));
+  if (inserted) {
+    eventNames.push_back(eventName);
+  }
+  return it->second;
 }
 
-void Listeners::remove(jsi::Runtime &runtime, const std::string& eventName, const jsi::Function &listener) noexcept {
-  if (!listenersMap.contains(eventName)) {
-    return;
+std::optional<EventId> findEventName(const std::string &eventName) {
+  std::shared_lock lock(eventNamesMutex);
+  auto it = eventIds.find(eventName);
+  if (it != eventIds.end()) {
+    return it->second;
   }
-  jsi::Value listenerValue(runtime, listener);
+  return std::nullopt;
+}
 
-  listenersMap[eventName].remove_if([&](const jsi::Value &item) {
-    return jsi::Value::strictEquals(runtime, listenerValue, item);
-  });
+const std::string &getEventName(EventId eventId) {
+  std::shared_lock lock(eventNamesMutex);
+  return eventNames.at(eventId);
 }
 
-void Listeners::removeAll(const std::string& eventName) noexcept {
-  if (listenersMap.contains(eventName)) {
-    listenersMap[eventName].clear();
+#pragma mark - Listeners
+
+Listeners::Event *Listeners::find(EventId eventId) noexcept {
+  for (Event &event : events) {
+    if (event.id == eventId) {
+      return &event;
+    }
   }
+  return nullptr;
 }
 
-void Listeners::clear() noexcept {
-  listenersMap.clear();
+void Listeners::compact(Event &event) noexcept {
+  if (callDepth > 0 || event.count == event.slots.size()) {
+    return;
+  }
+  std::erase_if(event.slots, [](const Slot &slot) {
+    return slot.removedAt != kNotRemoved;
+  });
 }
 
-size_t Listeners::listenersCount(const std::string& eventName) noexcept {
-  if (!listenersMap.contains(eventName)) {
-    return 0;
+void Listeners::add(jsi::Runtime &runtime, EventId eventId, const jsi::Function &listener) noexcept {
+  Event *event = find(eventId);
+  if (event == nullptr) {
+    event = &events.emplace_back(Event { eventId });
   }
-  return listenersMap[eventName].size();
+  event->slots.push_back(Slot { jsi::Value(runtime, listener), kNotRemoved });
+  event->count++;
 }
 
-void Listeners::call(jsi::Runtime &runtime, const std::string& eventName, const jsi::Object &thisObject, const jsi::Value *args, size_t count) noexcept {
-  if (!listenersMap.contains(eventName)) {
+void Listeners::remove(jsi::Runtime &runtime, EventId eventId, const jsi::Function &listener) noexcept {
+  Event *event = find(eventId);
+  if (event == nullptr) {
     return;
   }
-  ListenersList &listenersList = listenersMap[eventName];
-  size_t listSize = listenersList.size();
+  jsi::Value listenerValue(runtime, listener);
+  uint64_t removedAt = ++clock;
 
-  if (listSize == 0) {
-    // Nothing to call.
+  for (Slot &slot : event->slots) {
+    if (slot.removedAt == kNotRemoved && jsi::Value::strictEquals(runtime, listenerValue, slot.listener)) {
+      slot.removedAt = removedAt;
+      event->count--;
+    }
+  }
+  compact(*event);
+}
+
+void Listeners::removeAll(EventId eventId) noexcept {
+  Event *event = find(eventId);
+  if (event == nullptr) {
     return;
   }
-  if (listSize == 1) {
-    // The most common scenario – just call the only listener.
-    try {
-      listenersList
-        .front()
-        .asObject(runtime)
-        .asFunction(runtime)
-        .callWithThis(runtime, thisObject, args, count);
-    } catch (jsi::JSError& error) {
-      facebook::react::handleJSError(runtime, error, false);
+  uint64_t removedAt = ++clock;
+
+  for (Slot &slot : event->slots) {
+    if (slot.removedAt == kNotRemoved) {
+      slot.removedAt = removedAt;
     }
-    return;
   }
-  // When there are more than one listener, we copy the list to a vector as the list may be modified during the loop.
-  std::vector<jsi::Function> listenersVector;
-  listenersVector.reserve(listSize);
+  event->count = 0;
+  compact(*event);
+}
 
-  // Copy listeners to vector already as jsi::Function so we don't additionally copy jsi::Value
-  for (const jsi::Value &listener : listenersList) {
-    listenersVector.push_back(listener.asObject(runtime).asFunction(runtime));
+void Listeners::clear() noexcept {
+  events.clear();
+}
+
+size_t Listeners::listenersCount(EventId eventId) noexcept {
+  Event *event = find(eventId);
+  return event != nullptr ? event->count : 0;
+}
+
+void Listeners::call(jsi::Runtime &runtime, EventId eventId, const jsi::Object &thisObject, const jsi::Value *args, size_t count) noexcept {
+  Event *event = find(eventId);
+  if (event == nullptr || event->count == 0) {
+    // Nothing to call.
+    return;
   }
 
-  // Call listeners from the vector. The list can be modified by the listeners but it will not affect this loop,
-  // i.e. newly added listeners will not be called and removed listeners will be called one last time.
-  // This is compliant with the EventEmitter in Node.js
-  for (const jsi::Function &listener : listenersVector) {
+  // Listeners can add and remove other listeners. Newly added listeners are not called
+  // and removed listeners are called one last time, which is compliant with the EventEmitter in Node.js.
+  // The slots are accessed by index as the vectors may be reallocated by the listeners.
+  const size_t slotsCount = event->slots.size();
+  const uint64_t startedAt = clock;
+  callDepth++;
+
+  for (size_t i = 0; i < slotsCount; i++) {
+    event = find(eventId);
+    if (event == nullptr || i >= event->slots.size()) {
+      // The listeners were cleared.
+      break;
+    }
+    const Slot &slot = event->slots[i];
+    if (slot.removedAt <= startedAt) {
+      continue;
+    }
     // As opposed to Node.js and fbemitter, when the listener throws an error the behavior is the same as on web.
     // That is, it doesn't stop the execution of subsequent listeners and the error is not propagated to the `emit` function.
     // The motivation behind this is that errors thrown from a module or user's code shouldn't affect other modules' behavior.
     try {
+      jsi::Function listener = slot.listener.asObject(runtime).asFunction(runtime);
       listener.callWithThis(runtime, thisObject, args, count);
     } catch (jsi::JSError& error) {
       facebook::react::handleJSError(runtime, error, false);
     }
   }
+
+  callDepth--;
+  if (callDepth == 0) {
+    for (Event &item : events) {
+      compact(item);
+    }
+  }
 }
 
 #pragma mark - NativeState
@@ -110,7 +184,7 @@ NativeState::Shared NativeState::get(jsi::Runtime &runtime, const jsi::Object &o
 
 #pragma mark - Utils
 
-void callObservingFunction(jsi::Runtime &runtime, const jsi::Object &object, const char* functionName, const std::string& eventName) {
+void callObservingFunction(jsi::Runtime &runtime, const jsi::Object &object, const char* functionName, EventId eventId) {
   jsi::Value fnValue = object.getProperty(runtime, functionName);
 
   if (!fnValue.isObject()) {
@@ -122,71 +196,71 @@ void callObservingFunction(jsi::Runtime &runtime, const jsi::Object &object, con
     .getObject(runtime)
     .asFunction(runtime)
     .callWithThis(runtime, object, {
-      jsi::Value(runtime, jsi::String::createFromUtf8(runtime, eventName))
+      jsi::Value(runtime, jsi::String::createFromUtf8(runtime, getEventName(eventId)))
     });
 }
 
-void addListener(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Function &listener) {
+void addListener(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Function &listener) {
   if (NativeState::Shared state = NativeState::get(runtime, emitter, true)) {
-    state->listeners.add(runtime, eventName, listener);
+    state->listeners.add(runtime, eventId, listener);
 
-    if (state->listeners.listenersCount(eventName) == 1) {
-      callObservingFunction(runtime, emitter, "__expo_onStartListeningToEvent", eventName);
-      callObservingFunction(runtime, emitter, "startObserving", eventName);
+    if (state->listeners.listenersCount(eventId) == 1) {
+      callObservingFunction(runtime, emitter, "__expo_onStartListeningToEvent", eventId);
+      callObservingFunction(runtime, emitter, "startObserving", eventId);
     }
   }
 }
 
-void removeListener(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Function &listener) {
+void removeListener(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Function &listener) {
   if (NativeState::Shared state = NativeState::get(runtime, emitter, false)) {
-    size_t listenersCountBefore = state->listeners.listenersCount(eventName);
+    size_t listenersCountBefore = state->listeners.listenersCount(eventId);
 
-    state->listeners.remove(runtime, eventName, listener);
+    state->listeners.remove(runtime, eventId, listener);
 
-    if (listenersCountBefore >= 1 && state->listeners.listenersCount(eventName) == 0) {
-      callObservingFunction(runtime, emitter, "__expo_onStopListeningToEvent", eventName);
-      callObservingFunction(runtime, emitter, "stopObserving", eventName);
+    if (listenersCountBefore >= 1 && state->listeners.listenersCount(eventId) == 0) {
+      callObservingFunction(runtime, emitter, "__expo_onStopListeningToEvent", eventId);
+      callObservingFunction(runtime, emitter, "stopObserving", eventId);
     }
   }
 }
 
-void removeAllListeners(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName) {
+void removeAllListeners(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId) {
   if (NativeState::Shared state = NativeState::get(runtime, emitter, false)) {
-    size_t listenersCountBefore = state->listeners.listenersCount(eventName);
+    size_t listenersCountBefore = state->listeners.listenersCount(eventId);
 
-    state->listeners.removeAll(eventName);
+    state->listeners.removeAll(eventId);
 
     if (listenersCountBefore >= 1) {
-      callObservingFunction(runtime, emitter, "__expo_onStopListeningToEvent", eventName);
-      callObservingFunction(runtime, emitter, "stopObserving", eventName);
+      callObservingFunction(runtime, emitter, "__expo_onStopListeningToEvent", eventId);
+      callObservingFunction(runtime, emitter, "stopObserving", eventId);
     }
   }
 }
 
-void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Value *args, size_t count) {
+void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Value *args, size_t count) {
   if (NativeState::Shared state = NativeState::get(runtime, emitter, false)) {
-    state->listeners.call(runtime, eventName, emitter, args, count);
+    state->listeners.call(runtime, eventId, emitter, args, count);
   }
 }
 
-size_t getListenerCount(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName) {
+size_t getListenerCount(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId) {
   if (NativeState::Shared state = NativeState::get(runtime, emitter, false)) {
-    return state->listeners.listenersCount(eventName);
+    return state->listeners.listenersCount(eventId);
   }
   return 0;
 }
 
-jsi::Value createEventSubscription(jsi::Runtime &runtime, const std::string &eventName, const jsi::Object &emitter, const jsi::Function &listener) {
+jsi::Value createEventSubscription(jsi::Runtime &runtime, EventId eventId, const jsi::Object &emitter, const jsi::Function &listener) {
   jsi::Object subscription(runtime);
   jsi::PropNameID removeProp = jsi::PropNameID::forAscii(runtime, "remove", 6);
   std::shared_ptr<jsi::Value> emitterValue = std::make_shared<jsi::Value>(runtime, emitter);
   std::shared_ptr<jsi::Value> listenerValue = std::make_shared<jsi::Value>(runtime, listener);
 
-  jsi::HostFunctionType removeSubscription = [eventName, emitterValue, listenerValue](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
+  jsi::HostFunctionType removeSubscription = [eventId, emitterValue, listenerValue](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
     jsi::Object emitter = emitterValue->getObject(runtime);
     jsi::Function listener = listenerValue->getObject(runtime).getFunction(runtime);
 
-    removeListener(runtime, emitter, eventName, listener);
+    removeListener(runtime, emitter, eventId, listener);
     return jsi::Value::undefined();
   };
 
@@ -198,7 +272,13 @@ jsi::Value createEventSubscription(jsi::Runtime &runtime, const std::string &eve
 #pragma mark - Public API
 
 void emitEvent(jsi::Runtime &runtime, jsi::Object &emitter, const std::string &eventName, const std::vector<jsi::Value> &arguments) {
-  emitEvent(runtime, emitter, eventName, arguments.data(), arguments.size());
+  if (std::optional<EventId> eventId = findEventName(eventName)) {
+    emitEvent(runtime, emitter, *eventId, arguments.data(), arguments.size());
+  }
+}
+
+void emitEvent(jsi::Runtime &runtime, jsi::Object &emitter, EventId eventId, const std::vector<jsi::Value> &arguments) {
+  emitEvent(runtime, emitter, eventId, arguments.data(), arguments.size());
 }
 
 jsi::Function getClass(jsi::Runtime &runtime) {
@@ -228,7 +308,7 @@ void installClass(jsi::Runtime &runtime) {
   jsi::Object prototype = eventEmitterClass.getPropertyAsObject(runtime, "prototype");
 
   jsi::HostFunctionType addListenerHost = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    EventId eventId = internEventName(args[0].asString(runtime).utf8(runtime));
     jsi::Function listener = args[1].asObject(runtime).asFunction(runtime);
     jsi::Object thisObject = thisValue.getObject(runtime);
 
@@ -236,35 +316,45 @@ void installClass(jsi::Runtime &runtime) {
     // For native modules we need to unwrap it to get the object used under the hood by `LazyObject` host object.
     const jsi::Object &emitter = LazyObject::unwrapObjectIfNecessary(runtime, thisObject);
 
-    addListener(runtime, emitter, eventName, listener);
-    return createEventSubscription(runtime, eventName, emitter, listener);
+    addListener(runtime, emitter, eventId, listener);
+    return createEventSubscription(runtime, eventId, emitter, listener);
   };
 
   jsi::HostFunctionType removeListenerHost = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    std::optional<EventId> eventId = findEventName(args[0].asString(runtime).utf8(runtime));
+    if (!eventId) {
+      return jsi::Value::undefined();
+    }
     jsi::Function listener = args[1].asObject(runtime).asFunction(runtime);
     jsi::Object thisObject = thisValue.getObject(runtime);
 
     // Unwrap `this` object if it's a lazy object (e.g. native module).
     const jsi::Object &emitter = LazyObject::unwrapObjectIfNecessary(runtime, thisObject);
 
-    removeListener(runtime, emitter, eventName, listener);
+    removeListener(runtime, emitter, *eventId, listener);
     return jsi::Value::undefined();
   };
 
   jsi::HostFunctionType removeAllListenersHost = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    std::optional<EventId> eventId = findEventName(args[0].asString(runtime).utf8(runtime));
+    if (!eventId) {
+      return jsi::Value::undefined();
+    }
     jsi::Object thisObject = thisValue.getObject(runtime);
 
     // Unwrap `this` object if it's a lazy object (e.g. native module).
     const jsi::Object &emitter = LazyObject::unwrapObjectIfNecessary(runtime, thisObject);
 
-    removeAllListeners(runtime, emitter, eventName);
+    removeAllListeners(runtime, emitter, *eventId);
     return jsi::Value::undefined();
   };
 
   jsi::HostFunctionType emit = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    std::optional<EventId> eventId = findEventName(args[0].asString(runtime).utf8(runtime));
+    if (!eventId) {
+      // Nobody has ever listened to this event.
+      return jsi::Value::undefined();
+    }
     jsi::Object thisObject = thisValue.getObject(runtime);
 
     // Unwrap `this` object if it's a lazy object (e.g. native module).
@@ -273,18 +363,21 @@ void installClass(jsi::Runtime &runtime) {
     // Make a new pointer that skips the first argument which is the event name.
     const jsi::Value *eventArgs = count > 1 ? &args[1] : nullptr;
 
-    emitEvent(runtime, emitter, eventName, eventArgs, count - 1);
+    emitEvent(runtime, emitter, *eventId, eventArgs, count - 1);
     return jsi::Value::undefined();
   };
 
   jsi::HostFunctionType listenerCountHost = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    std::optional<EventId> eventId = findEventName(args[0].asString(runtime).utf8(runtime));
+    if (!eventId) {
+      return jsi::Value(0);
+    }
     jsi::Object thisObject = thisValue.getObject(runtime);
 
     // Unwrap `this` object if it's a lazy object (e.g. native module).
     const jsi::Object &emitter = LazyObject::unwrapObjectIfNecessary(runtime, thisObject);
 
-    return jsi::Value((int)getListenerCount(runtime, emitter, eventName));
+    return jsi::Value((int)getListenerCount(runtime, emitter, *eventId));
   };
 
   // Added for compatibility with the old EventEmitter API.
@@ -2,70 +2,130 @@
 
 #ifdef __cplusplus
 
-#include <unordered_map>
-#include <list>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
 #include <jsi/jsi.h>
 
 namespace jsi = facebook::jsi;
 
 namespace expo::EventEmitter {
 
+/**
+ Small integer identifying an event name. The same name always maps to the same id, in all runtimes.
+ */
+using EventId = uint32_t;
+
+/**
+ Returns the id of the given event name, assigning a new one if the name is seen for the first time.
+ Thread-safe, so it can be called on the thread that emits the event, off the JS thread.
+ */
+EventId internEventName(const std::string &eventName);
+
+/**
+ Returns the id of the given event name, or `std::nullopt` if it was never interned.
+ The table of names never shrinks, so only adding a listener interns a name. Other operations use this function,
+ as an event that was never listened to has no listeners to call, count or remove.
+ Thread-safe, like `internEventName`.
+ */
+std::optional<EventId> findEventName(const std::string &eventName);
+
+/**
+ Returns the name of the interned event.
+ */
+const std::string &getEventName(EventId eventId);
+
 /**
  Class containing and managing listeners of the event emitter.
  */
 class Listeners {
 private:
   friend class NativeState;
-  friend void addListener(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Function &listener);
-  friend void removeListener(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Function &listener);
-  friend void removeAllListeners(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName);
-  friend void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Value *args, size_t count);
-  friend size_t getListenerCount(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName);
+  friend void addListener(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Function &listener);
+  friend void removeListener(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Function &listener);
+  friend void removeAllListeners(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId);
+  friend void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Value *args, size_t count);
+  friend size_t getListenerCount(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId);
+
+  /**
+   Slot holding a listener. Removed listeners are tombstoned rather than erased,
+   so the slots can be iterated by index while the listeners modify them.
+   */
+  struct Slot {
+    jsi::Value listener;
+    /**
+     Value of the clock when the listener was removed or `kNotRemoved`.
+     */
+    uint64_t removedAt;
+  };
+
+  static constexpr uint64_t kNotRemoved = UINT64_MAX;
 
   /**
-   Type of the list containing listeners for the specific event name.
+   Listeners of the specific event.
    */
-  using ListenersList = std::list<jsi::Value>;
+  struct Event {
+    EventId id;
+    std::vector<Slot> slots;
+    /**
+     Number of slots that are not tombstoned.
+     */
+    size_t count = 0;
+  };
 
   /**
-   Type of the map where the keys are event names and the values are lists of listeners.
+   Events with listeners. An emitter usually has only a few events, so the linear search beats hashing.
    */
-  using ListenersMap = std::unordered_map<std::string, ListenersList>;
+  std::vector<Event> events;
 
   /**
-   Map with the events and listeners.
+   Clock advanced by removals. Each call compares it with the removal time of listeners,
+   so the listeners removed during the call are still called one last time.
    */
-  ListenersMap listenersMap;
+  uint64_t clock = 0;
+
+  /**
+   Number of calls in progress. Tombstones are compacted only when there are none.
+   */
+  size_t callDepth = 0;
+
+  Event *find(EventId eventId) noexcept;
 
   /**
-   Adds a listener for the given event name.
+   Erases tombstoned slots of the event, unless there is a call in progress.
    */
-  void add(jsi::Runtime &runtime, const std::string& eventName, const jsi::Function &listener) noexcept;
+  void compact(Event &event) noexcept;
 
   /**
-   Removes the listener for the given event name.
+   Adds a listener for the given event.
    */
-  void remove(jsi::Runtime &runtime, const std::string& eventName, const jsi::Function &listener) noexcept;
+  void add(jsi::Runtime &runtime, EventId eventId, const jsi::Function &listener) noexcept;
 
   /**
-   Removes all listeners for the given event name.
+   Removes the listener for the given event.
    */
-  void removeAll(const std::string& eventName) noexcept;
+  void remove(jsi::Runtime &runtime, EventId eventId, const jsi::Function &listener) noexcept;
 
   /**
-   Clears the entire map of events and listeners.
+   Removes all listeners for the given event.
+   */
+  void removeAll(EventId eventId) noexcept;
+
+  /**
+   Clears all events and listeners.
    */
   void clear() noexcept;
 
   /**
-   Returns a number of listeners added for the given event name.
+   Returns a number of listeners added for the given event.
    */
-  size_t listenersCount(const std::string& eventName) noexcept;
+  size_t listenersCount(EventId eventId) noexcept;
 
   /**
-   Calls listeners for the given event name, with the given `this` object and payload arguments.
+   Calls listeners for the given event, with the given `this` object and payload arguments.
    */
-  void call(jsi::Runtime &runtime, const std::string& eventName, const jsi::Object &thisObject, const jsi::Value *args, size_t count) noexcept;
+  void call(jsi::Runtime &runtime, EventId eventId, const jsi::Object &thisObject, const jsi::Value *args, size_t count) noexcept;
 };
 
 /**
@@ -96,6 +156,12 @@ public:
  */
 void emitEvent(jsi::Runtime &runtime, jsi::Object &emitter, const std::string &eventName, const std::vector<jsi::Value> &arguments);
 
+/**
+ Emits an event with the given interned id and arguments to the emitter object.
+ Use it to emit the same event repeatedly without converting and hashing its name each time.
+ */
+void emitEvent(jsi::Runtime &runtime, jsi::Object &emitter, EventId eventId, const std::vector<jsi::Value> &arguments);
+
 /**
  Gets `expo.EventEmitter` class from the given runtime.
  */
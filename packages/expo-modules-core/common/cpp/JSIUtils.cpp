@@ -1,24 +1,72 @@
 // Copyright 2022-present 650 Industries. All rights reserved.
 
-#include <sstream>
 #include "JSIUtils.h"
 
 namespace expo::common {
 
-jsi::Function createClass(jsi::Runtime &runtime, const char *name, ClassConstructor constructor) {
-  std::string nativeConstructorKey("__native_constructor__");
-
-  // Create a string buffer of the source code to evaluate.
-  std::stringstream source;
-  source << "(function " << name << "(...args) { return this." << nativeConstructorKey << "(...args); })";
-  std::shared_ptr<jsi::StringBuffer> sourceBuffer = std::make_shared<jsi::StringBuffer>(source.str());
-
-  // Evaluate the code and obtain returned value (the constructor function).
-  jsi::Object klass = runtime.evaluateJavaScript(sourceBuffer, "").asObject(runtime);
+namespace {
+
+/**
+ Name of the hidden global property holding the intrinsics.
+ */
+constexpr char intrinsicsKey[] = "__expo_intrinsics__";
+
+/**
+ Source of the function that creates classes. The computed key gives the constructor its name,
+ just like a function declared with that name would have. It also sets the native constructor
+ and optionally the base prototype, so creating a class takes a single call into JS.
+ */
+constexpr char classFactorySource[] =
+  "(function createClass(name, nativeConstructor, basePrototype) {\n"
+  "  const klass = { [name]: function (...args) { return this.__native_constructor__(...args); } }[name];\n"
+  "  Object.defineProperty(klass.prototype, '__native_constructor__', { value: nativeConstructor });\n"
+  "  if (basePrototype) {\n"
+  "    Object.setPrototypeOf(klass.prototype, basePrototype);\n"
+  "  }\n"
+  "  return klass;\n"
+  "})";
+
+/**
+ Functions and property names used to create classes and define properties.
+ They are looked up once per runtime.
+ */
+class Intrinsics : public jsi::NativeState {
+public:
+  explicit Intrinsics(jsi::Runtime &runtime)
+    : objectCreate(runtime.global().getPropertyAsObject(runtime, "Object").getPropertyAsFunction(runtime, "create")),
+      objectDefineProperty(runtime.global().getPropertyAsObject(runtime, "Object").getPropertyAsFunction(runtime, "defineProperty")),
+      classFactory(
+        runtime
+          .evaluateJavaScript(std::make_shared<jsi::StringBuffer>(classFactorySource), "[expo] JSIUtils")
+          .asObject(runtime)
+          .asFunction(runtime)
+      ),
+      getPropName(jsi::PropNameID::forAscii(runtime, "get", 3)),
+      setPropName(jsi::PropNameID::forAscii(runtime, "set", 3)),
+      valuePropName(jsi::PropNameID::forAscii(runtime, "value", 5)),
+      configurablePropName(jsi::PropNameID::forAscii(runtime, "configurable", 12)),
+      enumerablePropName(jsi::PropNameID::forAscii(runtime, "enumerable", 10)),
+      writablePropName(jsi::PropNameID::forAscii(runtime, "writable", 8)),
+      prototypePropName(jsi::PropNameID::forAscii(runtime, "prototype", 9)) {}
+
+  const jsi::Function objectCreate;
+  const jsi::Function objectDefineProperty;
+  const jsi::Function classFactory;
+  const jsi::PropNameID getPropName;
+  const jsi::PropNameID setPropName;
+  const jsi::PropNameID valuePropName;
+  const jsi::PropNameID configurablePropName;
+  const jsi::PropNameID enumerablePropName;
+  const jsi::PropNameID writablePropName;
+  const jsi::PropNameID prototypePropName;
+}; // class Intrinsics
+
+inline std::shared_ptr<Intrinsics> getIntrinsics(jsi::Runtime &runtime) {
+  return getRuntimeState<Intrinsics>(runtime, intrinsicsKey);
+}
 
-  // Set the native constructor in the prototype.
-  jsi::Object prototype = klass.getPropertyAsObject(runtime, "prototype");
-  jsi::PropNameID nativeConstructorPropId = jsi::PropNameID::forAscii(runtime, nativeConstructorKey);
+jsi::Function createClassWithPrototype(jsi::Runtime &runtime, const char *name, ClassConstructor constructor, const jsi::Object *basePrototype) {
+  jsi::PropNameID nativeConstructorPropId = jsi::PropNameID::forAscii(runtime, "__native_constructor__");
   jsi::Function nativeConstructor = jsi::Function::createFromHostFunction(
     runtime,
     nativeConstructorPropId,
@@ -31,43 +79,52 @@ jsi::Function createClass(jsi::Runtime &runtime, const char *name, ClassConstruc
       return jsi::Value(runtime, thisValue);
     });
 
+  return getIntrinsics(runtime)->classFactory
+    .call(runtime, {
+      jsi::String::createFromUtf8(runtime, name),
+      std::move(nativeConstructor),
+      basePrototype ? jsi::Value(runtime, *basePrototype) : jsi::Value::undefined()
+    })
+    .asObject(runtime)
+    .asFunction(runtime);
+}
+
+} // namespace
+
+void defineHiddenGlobalProperty(jsi::Runtime &runtime, const char *name, jsi::Value value) {
+  jsi::Object global = runtime.global();
+  jsi::Object objectClass = global.getPropertyAsObject(runtime, "Object");
+
+  // Neither enumerable, writable nor configurable, so JS code doesn't come across it.
   jsi::Object descriptor(runtime);
-  descriptor.setProperty(runtime, "value", jsi::Value(runtime, nativeConstructor));
+  descriptor.setProperty(runtime, "value", std::move(value));
 
-  defineProperty(runtime, &prototype, nativeConstructorKey.c_str(), std::move(descriptor));
+  objectClass
+    .getPropertyAsFunction(runtime, "defineProperty")
+    .callWithThis(runtime, objectClass, {
+      jsi::Value(runtime, global),
+      jsi::String::createFromAscii(runtime, name),
+      std::move(descriptor)
+    });
+}
 
-  return klass.asFunction(runtime);
+jsi::Function createClass(jsi::Runtime &runtime, const char *name, ClassConstructor constructor) {
+  return createClassWithPrototype(runtime, name, std::move(constructor), nullptr);
 }
 
 jsi::Function createInheritingClass(jsi::Runtime &runtime, const char *className, jsi::Function &baseClass, ClassConstructor constructor) {
-  jsi::PropNameID prototypePropNameId = jsi::PropNameID::forAscii(runtime, "prototype", 9);
   jsi::Object baseClassPrototype = baseClass
-    .getProperty(runtime, prototypePropNameId)
+    .getProperty(runtime, getIntrinsics(runtime)->prototypePropName)
     .asObject(runtime);
 
-  jsi::Function klass = createClass(runtime, className, constructor);
-  jsi::Object klassPrototype = klass.getProperty(runtime, prototypePropNameId).asObject(runtime);
-
-  klassPrototype.setProperty(runtime, "__proto__", baseClassPrototype);
-
-  return klass;
+  return createClassWithPrototype(runtime, className, std::move(constructor), &baseClassPrototype);
 }
 
 jsi::Object createObjectWithPrototype(jsi::Runtime &runtime, jsi::Object *prototype) {
-  // Get the "Object" class.
-  jsi::Object objectClass = runtime
-    .global()
-    .getPropertyAsObject(runtime, "Object");
-
   // Call "Object.create(prototype)" to create an object with the given prototype without calling the constructor.
-  jsi::Object object = objectClass
-    .getPropertyAsFunction(runtime, "create")
-    .callWithThis(runtime, objectClass, {
-      jsi::Value(runtime, *prototype)
-    })
+  return getIntrinsics(runtime)->objectCreate
+    .call(runtime, jsi::Value(runtime, *prototype))
     .asObject(runtime);
-
-  return object;
 }
 
 std::vector<jsi::PropNameID> jsiArrayToPropNameIdsVector(jsi::Runtime &runtime, const jsi::Array &array) {
@@ -84,21 +141,22 @@ std::vector<jsi::PropNameID> jsiArrayToPropNameIdsVector(jsi::Runtime &runtime,
 }
 
 void defineProperty(jsi::Runtime &runtime, jsi::Object *object, const char *name, const PropertyDescriptor& descriptor) {
+  const auto intrinsics = getIntrinsics(runtime);
   jsi::Object jsDescriptor(runtime);
 
   // These three flags are all `false` by default, so set the property only when `true`.
   if (descriptor.configurable) {
-    jsDescriptor.setProperty(runtime, "configurable", jsi::Value(true));
+    jsDescriptor.setProperty(runtime, intrinsics->configurablePropName, jsi::Value(true));
   }
   if (descriptor.enumerable) {
-    jsDescriptor.setProperty(runtime, "enumerable", jsi::Value(true));
+    jsDescriptor.setProperty(runtime, intrinsics->enumerablePropName, jsi::Value(true));
   }
   if (descriptor.writable) {
-    jsDescriptor.setProperty(runtime, "writable", jsi::Value(true));
+    jsDescriptor.setProperty(runtime, intrinsics->writablePropName, jsi::Value(true));
   }
 
   if (descriptor.get) {
-    jsi::PropNameID getPropName = jsi::PropNameID::forAscii(runtime, "get", 3);
+    const jsi::PropNameID &getPropName = intrinsics->getPropName;
     jsi::Function get = jsi::Function::createFromHostFunction(
       runtime,
       getPropName,
@@ -110,7 +168,7 @@ void defineProperty(jsi::Runtime &runtime, jsi::Object *object, const char *name
     jsDescriptor.setProperty(runtime, getPropName, get);
   }
   if (descriptor.set) {
-    jsi::PropNameID setPropName = jsi::PropNameID::forAscii(runtime, "set", 3);
+    const jsi::PropNameID &setPropName = intrinsics->setPropName;
     jsi::Function set = jsi::Function::createFromHostFunction(
       runtime,
       setPropName,
@@ -123,20 +181,15 @@ void defineProperty(jsi::Runtime &runtime, jsi::Object *object, const char *name
     jsDescriptor.setProperty(runtime, setPropName, set);
   }
   if (!descriptor.value.isUndefined()) {
-    jsi::PropNameID valuePropName = jsi::PropNameID::forAscii(runtime, "value", 5);
-    jsDescriptor.setProperty(runtime, valuePropName, descriptor.value);
+    jsDescriptor.setProperty(runtime, intrinsics->valuePropName, descriptor.value);
   }
 
   defineProperty(runtime, object, name, std::move(jsDescriptor));
 }
 
 void defineProperty(jsi::Runtime &runtime, jsi::Object *object, const char *name, jsi::Object descriptor) {
-  jsi::Object global = runtime.global();
-  jsi::Object objectClass = global.getPropertyAsObject(runtime, "Object");
-  jsi::Function definePropertyFunction = objectClass.getPropertyAsFunction(runtime, "defineProperty");
-
   // This call is basically the same as `Object.defineProperty(object, name, descriptor)` in JS
-  definePropertyFunction.callWithThis(runtime, objectClass, {
+  getIntrinsics(runtime)->objectDefineProperty.call(runtime, {
     jsi::Value(runtime, *object),
     jsi::String::createFromUtf8(runtime, name),
     std::move(descriptor),
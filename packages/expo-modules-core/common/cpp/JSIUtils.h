@@ -5,6 +5,9 @@
 
 #include <jsi/jsi.h>
 
+#include <memory>
+#include <type_traits>
+
 namespace jsi = facebook::jsi;
 
 namespace expo::common {
@@ -18,6 +21,47 @@ inline jsi::Object getCoreObject(jsi::Runtime &runtime) {
   return runtime.global().getPropertyAsObject(runtime, "expo");
 }
 
+#pragma mark - Runtime state
+
+/**
+ Defines a hidden (non-enumerable, non-writable and non-configurable) property on the global object.
+ */
+void defineHiddenGlobalProperty(jsi::Runtime &runtime, const char *name, jsi::Value value);
+
+/**
+ Returns the native state of type `T` bound to the runtime, creating it with `T(runtime)` on first use.
+ The state is kept by a hidden global property with the given name, so it's released together with the runtime.
+ The state of the last used runtime is also cached for each thread, so most calls don't access the global object.
+ */
+template <typename T>
+std::shared_ptr<T> getRuntimeState(jsi::Runtime &runtime, const char *name) {
+  static_assert(std::is_base_of_v<jsi::NativeState, T>, "The runtime state has to be a native state");
+  thread_local const jsi::Runtime *lastRuntime = nullptr;
+  thread_local std::weak_ptr<T> lastState;
+
+  if (lastRuntime == &runtime) {
+    if (auto state = lastState.lock()) {
+      return state;
+    }
+  }
+
+  std::shared_ptr<T> state;
+  jsi::Value holder = runtime.global().getProperty(runtime, name);
+
+  if (holder.isObject() && holder.getObject(runtime).hasNativeState<T>(runtime)) {
+    state = holder.getObject(runtime).getNativeState<T>(runtime);
+  } else {
+    state = std::make_shared<T>(runtime);
+    jsi::Object holderObject(runtime);
+    holderObject.setNativeState(runtime, state);
+    defineHiddenGlobalProperty(runtime, name, std::move(holderObject));
+  }
+
+  lastRuntime = &runtime;
+  lastState = state;
+  return state;
+}
+
 #pragma mark - Classes
 
 /**
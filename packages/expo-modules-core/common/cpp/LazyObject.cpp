@@ -5,7 +5,8 @@
 
 namespace expo {
 
-LazyObject::LazyObject(LazyObjectInitializer initializer) : initializer(std::move(initializer)) {}
+LazyObject::LazyObject(LazyObjectInitializer initializer, LazyPropertyInitializer propertyInitializer)
+  : initializer(std::move(initializer)), propertyInitializer(std::move(propertyInitializer)) {}
 
 LazyObject::~LazyObject() {
   backedObject = nullptr;
@@ -19,7 +20,11 @@ jsi::Value LazyObject::get(jsi::Runtime &runtime, const jsi::PropNameID &name) {
     }
     initializeBackedObject(runtime);
   }
-  return backedObject ? backedObject->getProperty(runtime, name) : jsi::Value::undefined();
+  if (!backedObject) {
+    return jsi::Value::undefined();
+  }
+  initializeProperty(runtime, &name);
+  return backedObject->getProperty(runtime, name);
 }
 
 void LazyObject::set(jsi::Runtime &runtime, const jsi::PropNameID &name, const jsi::Value &value) {
@@ -27,6 +32,7 @@ void LazyObject::set(jsi::Runtime &runtime, const jsi::PropNameID &name, const j
     initializeBackedObject(runtime);
   }
   if (backedObject) {
+    initializeProperty(runtime, &name);
     backedObject->setProperty(runtime, name, value);
   }
 }
@@ -36,6 +42,7 @@ std::vector<jsi::PropNameID> LazyObject::getPropertyNames(jsi::Runtime &runtime)
     initializeBackedObject(runtime);
   }
   if (backedObject) {
+    initializeProperty(runtime, nullptr);
     jsi::Array propertyNames = backedObject->getPropertyNames(runtime);
     return common::jsiArrayToPropNameIdsVector(runtime, propertyNames);
   }
@@ -49,6 +56,10 @@ const jsi::Object &LazyObject::unwrapObjectIfNecessary(jsi::Runtime &runtime, co
     if (!lazyObject->backedObject) {
       lazyObject->initializeBackedObject(runtime);
     }
+    if (!lazyObject->backedObject) {
+      // The object couldn't be created, e.g. the module is no longer available.
+      throw jsi::JSError(runtime, "Cannot access an object that is no longer available");
+    }
     return *lazyObject->backedObject;
   }
   return object;
@@ -15,6 +15,13 @@ namespace expo {
  */
 typedef std::function<std::shared_ptr<jsi::Object>(jsi::Runtime &)> LazyObjectInitializer;
 
+/**
+ A function that is called before a property of the backed object is accessed, so the property can be defined lazily.
+ The name is a null pointer when all properties are needed, e.g. to list them.
+ Returns whether any properties are left to define. Once it returns `false`, it is not called anymore.
+ */
+typedef std::function<bool(jsi::Runtime &, const jsi::PropNameID *name)> LazyPropertyInitializer;
+
 /**
  A host object that defers the creating of the raw object until any property is accessed for the first time.
  */
@@ -22,7 +29,7 @@ class JSI_EXPORT LazyObject : public jsi::HostObject {
 public:
   using Shared = std::shared_ptr<LazyObject>;
 
-  explicit LazyObject(LazyObjectInitializer initializer);
+  explicit LazyObject(LazyObjectInitializer initializer, LazyPropertyInitializer propertyInitializer = nullptr);
 
   ~LazyObject() override;
 
@@ -35,11 +42,13 @@ public:
   /**
    If the given object is a host object of type `LazyObject`, it returns its backed object.
    Otherwise, the given object is returned back.
+   Throws a JS error if the backed object couldn't be created.
    */
   static const jsi::Object &unwrapObjectIfNecessary(jsi::Runtime &runtime, const jsi::Object &object);
 
 private:
   const LazyObjectInitializer initializer;
+  LazyPropertyInitializer propertyInitializer;
   std::shared_ptr<jsi::Object> backedObject;
 
   /**
@@ -49,6 +58,15 @@ private:
     backedObject = initializer(runtime);
   }
 
+  /**
+   Lets the property initializer define the property with the given name (or all of them) in the backed object.
+   */
+  inline void initializeProperty(jsi::Runtime &runtime, const jsi::PropNameID *name) {
+    if (propertyInitializer && !propertyInitializer(runtime, name)) {
+      propertyInitializer = nullptr;
+    }
+  }
+
 }; // class LazyObject
 
 } // namespace expo
@@ -1,7 +1,9 @@
 // Copyright 2022-present 650 Industries. All rights reserved.
 
+#include <optional>
 #include <unordered_map>
 #include "TypedArray.h"
+#include "JSIUtils.h"
 
 namespace expo {
 
@@ -23,11 +25,78 @@ TypedArrayKind getTypedArrayKindForName(const std::string &name) {
   return nameToKindMap.at(name);
 }
 
+namespace {
+
+/**
+ Typed array constructors of the runtime, so the kind of typed array can be resolved
+ by comparing its constructor instead of reading and looking up the constructor's name.
+ */
+class TypedArrayConstructors : public jsi::NativeState {
+public:
+  explicit TypedArrayConstructors(jsi::Runtime &runtime)
+    : constructorPropName(jsi::PropNameID::forAscii(runtime, "constructor", 11)),
+      bufferPropName(jsi::PropNameID::forAscii(runtime, "buffer", 6)),
+      byteOffsetPropName(jsi::PropNameID::forAscii(runtime, "byteOffset", 10)),
+      byteLengthPropName(jsi::PropNameID::forAscii(runtime, "byteLength", 10)),
+      objectConstructor(runtime.global().getProperty(runtime, "Object")),
+      arrayBufferIsView(
+        runtime
+          .global()
+          .getPropertyAsObject(runtime, "ArrayBuffer")
+          .getPropertyAsFunction(runtime, "isView")
+      ) {
+    for (const auto &[name, kind]: nameToKindMap) {
+      jsi::Value constructor = runtime.global().getProperty(runtime, name.c_str());
+      // Some engines may not provide all kinds, e.g. the BigInt ones.
+      if (constructor.isObject()) {
+        constructors.emplace_back(std::move(constructor), kind);
+      }
+    }
+  }
+
+  std::optional<TypedArrayKind> getKind(jsi::Runtime &runtime, const jsi::Value &constructor) const {
+    if (!constructor.isObject()) {
+      return std::nullopt;
+    }
+    for (const auto &[candidate, kind]: constructors) {
+      if (jsi::Value::strictEquals(runtime, candidate, constructor)) {
+        return kind;
+      }
+    }
+    return std::nullopt;
+  }
+
+  const jsi::PropNameID constructorPropName;
+  const jsi::PropNameID bufferPropName;
+  const jsi::PropNameID byteOffsetPropName;
+  const jsi::PropNameID byteLengthPropName;
+  const jsi::Value objectConstructor;
+  const jsi::Function arrayBufferIsView;
+
+private:
+  std::vector<std::pair<jsi::Value, TypedArrayKind>> constructors;
+}; // class TypedArrayConstructors
+
+inline std::shared_ptr<TypedArrayConstructors> getTypedArrayConstructors(jsi::Runtime &runtime) {
+  return common::getRuntimeState<TypedArrayConstructors>(runtime, "__expo_typed_array_constructors__");
+}
+
+} // namespace
+
 TypedArray::TypedArray(jsi::Runtime &runtime, const jsi::Object &obj)
     : jsi::Object(jsi::Value(runtime, obj).asObject(runtime)) {}
 
 TypedArrayKind TypedArray::getKind(jsi::Runtime &runtime) const {
-  auto constructorName = this->getPropertyAsObject(runtime, "constructor")
+  const auto constructors = getTypedArrayConstructors(runtime);
+  jsi::Value constructor = getProperty(runtime, constructors->constructorPropName);
+
+  if (auto kind = constructors->getKind(runtime, constructor)) {
+    return *kind;
+  }
+
+  // Fall back to the name of the constructor, e.g. for typed arrays from other realms.
+  auto constructorName = constructor
+                             .asObject(runtime)
                              .getProperty(runtime, "name")
                              .asString(runtime)
                              .utf8(runtime);
@@ -56,15 +125,47 @@ void* TypedArray::getRawPointer(jsi::Runtime &runtime) const {
 }
 
 bool isTypedArray(jsi::Runtime &runtime, const jsi::Object &jsObj) {
-  jsi::Object ArrayBuffer = runtime
-    .global()
-    .getPropertyAsObject(runtime, "ArrayBuffer");
+  // Objects of these types are never views and can be recognized without calling into JS.
+  if (jsObj.isArray(runtime) || jsObj.isFunction(runtime) || jsObj.isArrayBuffer(runtime) || jsObj.isHostObject(runtime)) {
+    return false;
+  }
+
+  const auto constructors = getTypedArrayConstructors(runtime);
+  jsi::Value constructor = jsObj.getProperty(runtime, constructors->constructorPropName);
+
+  // Plain objects are the most common arguments that get here.
+  if (jsi::Value::strictEquals(runtime, constructor, constructors->objectConstructor)) {
+    return false;
+  }
 
-  jsi::Value isViewResult = ArrayBuffer
-    .getPropertyAsFunction(runtime, "isView")
-    .callWithThis(runtime, ArrayBuffer, {jsi::Value(runtime, jsObj)});
+  // Every view has a buffer. Other objects, like dates or instances of classes, are rejected here.
+  // The `buffer` getter throws for objects that only inherit from a typed array prototype,
+  // e.g. `Object.create(Uint8Array.prototype)`, as they are not backed by a buffer.
+  jsi::Value buffer;
+  try {
+    buffer = jsObj.getProperty(runtime, constructors->bufferPropName);
+  } catch (const jsi::JSError &) {
+    return false;
+  }
+  if (!buffer.isObject() || !buffer.getObject(runtime).isArrayBuffer(runtime)) {
+    return false;
+  }
+
+  if (constructors->getKind(runtime, constructor).has_value()) {
+    // The constructor can still be spoofed, so make sure that the view doesn't point outside of its buffer.
+    const jsi::Value byteOffset = jsObj.getProperty(runtime, constructors->byteOffsetPropName);
+    const jsi::Value byteLength = jsObj.getProperty(runtime, constructors->byteLengthPropName);
+    return byteOffset.isNumber()
+      && byteLength.isNumber()
+      && byteOffset.getNumber() >= 0
+      && byteLength.getNumber() >= 0
+      && byteOffset.getNumber() + byteLength.getNumber() <= buffer.getObject(runtime).getArrayBuffer(runtime).size(runtime);
+  }
 
-  return isViewResult.getBool();
+  // Other objects with a buffer, like `DataView` or subclasses of typed arrays, still go through `ArrayBuffer.isView`.
+  return constructors->arrayBufferIsView
+    .call(runtime, jsi::Value(runtime, jsObj))
+    .getBool();
 }
 
 } // namespace expo
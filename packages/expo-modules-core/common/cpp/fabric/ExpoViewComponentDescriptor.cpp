@@ -16,4 +16,14 @@ facebook::react::ComponentName ExpoViewComponentDescriptor::getComponentName() c
   return std::static_pointer_cast<std::string const>(this->flavor_)->c_str();
 }
 
+void ExpoViewComponentDescriptor::adopt(facebook::react::ShadowNode &shadowNode) const {
+  if (shadowNode.getState()) {
+    // Similar to the modal host view in React Native, but only the dimensions that are set override the style,
+    // and the style from props is restored once the size is cleared.
+    static_cast<ExpoViewShadowNode &>(shadowNode).applyIntrinsicSize();
+  }
+
+  ConcreteComponentDescriptor::adopt(shadowNode);
+}
+
 } // namespace expo
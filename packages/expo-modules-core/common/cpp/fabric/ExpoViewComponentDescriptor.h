@@ -18,6 +18,11 @@ class ExpoViewComponentDescriptor : public facebook::react::ConcreteComponentDes
 
   facebook::react::ComponentHandle getComponentHandle() const override;
   facebook::react::ComponentName getComponentName() const override;
+
+  /**
+   Applies the intrinsic size from the state, so the view settles its layout in a single pass.
+   */
+  void adopt(facebook::react::ShadowNode &shadowNode) const override;
 };
 
 } // namespace expo
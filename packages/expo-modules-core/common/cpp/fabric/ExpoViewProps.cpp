@@ -9,21 +9,26 @@ namespace react = facebook::react;
 namespace expo {
 
 /**
- Borrows the props map from the source props and applies the update given in the raw props.
+ Copies the props map from the source props and applies the update given in the raw props.
+ Only pointers to the values are copied, the values of props that weren't updated are shared with the source props.
  */
-std::unordered_map<std::string, folly::dynamic> propsMapFromProps(const ExpoViewProps &sourceProps, const react::RawProps &rawProps) {
-  // Move the contents of the source props map – the source props instance will not be used anymore.
-  std::unordered_map<std::string, folly::dynamic> propsMap = std::move(sourceProps.propsMap);
+std::unordered_map<std::string, ExpoViewProps::PropValue> propsMapFromProps(const ExpoViewProps &sourceProps, const react::RawProps &rawProps) {
+#ifdef ANDROID
+  // Props are passed to the view managers from the raw props, so the map would never be read.
+  return {};
+#else
+  std::unordered_map<std::string, ExpoViewProps::PropValue> propsMap = sourceProps.propsMap;
 
   // Iterate over values in the raw props object.
   // Note that it contains only updated props.
   const auto& dynamicRawProps = static_cast<folly::dynamic>(rawProps);
   for (const auto& propsPair : dynamicRawProps.items()) {
     const auto &propName = propsPair.first.getString();
-    propsMap[propName] = static_cast<folly::dynamic>(propsPair.second);
+    propsMap[propName] = std::make_shared<const folly::dynamic>(propsPair.second);
   }
 
   return propsMap;
+#endif
 }
 
 ExpoViewProps::ExpoViewProps(const react::PropsParserContext &context,
@@ -19,10 +19,15 @@ public:
 
 #pragma mark - Props
 
+  using PropValue = std::shared_ptr<const folly::dynamic>;
+
   /**
    A map with props stored as `folly::dynamic` objects.
+   Values are immutable and shared with the source props, so a prop that wasn't updated
+   points to the same value as in the props it was copied from. Comparing the pointers is enough to skip unchanged props.
+   It's not populated on Android, where the view managers receive only updated props straight from the raw props.
    */
-  std::unordered_map<std::string, folly::dynamic> propsMap;
+  std::unordered_map<std::string, PropValue> propsMap;
 };
 
 } // namespace expo
@@ -2,8 +2,44 @@
 
 #include "ExpoViewShadowNode.h"
 
+#include <cmath>
+#include <type_traits>
+
+namespace yoga = facebook::yoga;
+
 namespace expo {
 
   extern const char ExpoViewComponentName[] = "ExpoFabricView";
 
+  namespace {
+
+    bool applyDimension(yoga::Style &style, const yoga::Style &propsStyle, yoga::Dimension dimension, float size) {
+      using Length = std::decay_t<decltype(style.dimension(dimension))>;
+      const Length length = std::isnan(size) ? propsStyle.dimension(dimension) : Length::points(size);
+
+      if (style.dimension(dimension) == length) {
+        return false;
+      }
+      style.setDimension(dimension, length);
+      return true;
+    }
+
+  } // namespace
+
+  bool applyIntrinsicSize(yoga::Style &style, const yoga::Style &propsStyle, const ExpoViewState &state) {
+    const bool widthChanged = applyDimension(style, propsStyle, yoga::Dimension::Width, state.intrinsicWidth);
+    const bool heightChanged = applyDimension(style, propsStyle, yoga::Dimension::Height, state.intrinsicHeight);
+    return widthChanged || heightChanged;
+  }
+
+  void ExpoViewShadowNode::applyIntrinsicSize() const {
+    ensureUnsealed();
+
+    auto style = yogaNode_.style();
+    if (expo::applyIntrinsicSize(style, getConcreteProps().yogaStyle, getStateData())) {
+      yogaNode_.setStyle(style);
+      yogaNode_.setDirty(true);
+    }
+  }
+
 } // namespace expo
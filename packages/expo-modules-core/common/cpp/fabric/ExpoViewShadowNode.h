@@ -14,9 +14,26 @@ namespace expo {
 
 extern const char ExpoViewComponentName[];
 
+/**
+ Resolves the width and height of the Yoga `style` from the intrinsic size in the `state`.
+ Dimensions that are `NaN` get the values from `propsStyle`, i.e. the style derived from the props.
+ Returns whether the style has changed.
+ */
+bool applyIntrinsicSize(
+  facebook::yoga::Style &style,
+  const facebook::yoga::Style &propsStyle,
+  const ExpoViewState &state
+);
+
 class ExpoViewShadowNode final : public facebook::react::ConcreteViewShadowNode<ExpoViewComponentName, ExpoViewProps, ExpoViewEventEmitter, ExpoViewState> {
 public:
   using ConcreteViewShadowNode::ConcreteViewShadowNode;
+
+  /**
+   Applies the intrinsic size from the node's state to its Yoga style. When the state has no intrinsic size,
+   the width and height from the props are restored. The node is marked dirty only if the style has changed.
+   */
+  void applyIntrinsicSize() const;
 };
 
 } // namespace expo
@@ -4,6 +4,8 @@
 
 #ifdef __cplusplus
 
+#include <limits>
+
 #ifdef ANDROID
 #include <folly/dynamic.h>
 #include <react/renderer/mapbuffer/MapBuffer.h>
@@ -16,8 +18,12 @@ class ExpoViewState final {
 public:
   ExpoViewState() {};
 
+  ExpoViewState(float intrinsicWidth, float intrinsicHeight)
+    : intrinsicWidth(intrinsicWidth), intrinsicHeight(intrinsicHeight) {};
+
 #ifdef ANDROID
-  ExpoViewState(ExpoViewState const &previousState, folly::dynamic data) {};
+  ExpoViewState(ExpoViewState const &previousState, folly::dynamic data)
+    : intrinsicWidth(getDimension(data, "width")), intrinsicHeight(getDimension(data, "height")) {};
 
   folly::dynamic getDynamic() const {
     return {};
@@ -28,6 +34,20 @@ public:
   };
 #endif
 
+  /**
+   Size of the view content supplied by the native view, in points.
+   A dimension that is `NaN` keeps the width or height from the style props, including percentages and `auto`.
+   */
+  float intrinsicWidth = std::numeric_limits<float>::quiet_NaN();
+  float intrinsicHeight = std::numeric_limits<float>::quiet_NaN();
+
+private:
+#ifdef ANDROID
+  static float getDimension(const folly::dynamic &data, const char *name) {
+    const auto &value = data.getDefault(name, nullptr);
+    return value.isNumber() ? static_cast<float>(value.asDouble()) : std::numeric_limits<float>::quiet_NaN();
+  }
+#endif
 };
 
 } // namespace expo
@@ -34,6 +34,10 @@ open class ExpoClassicView: RCTView, AnyExpoView {
     // Stub function – it's not used on the old architecture and non-SwiftUI views
   }
 
+  public func updateChangedProps(_ rawProps: [String: Any]) {
+    // Stub function – it's not used on the old architecture and non-SwiftUI views
+  }
+
   public func supportsProp(withName name: String) -> Bool {
     // Stub function – it's not used on the old architecture and non-SwiftUI views
     return false
@@ -20,7 +20,7 @@ extension ExpoSwiftUI {
      Props object that stores all the props for this particular view.
      It's an environment object that is observed by the content view.
      */
-    private let props: Props
+    internal let props: Props
 
     /**
      View controller that embeds the content view into the UIKit view hierarchy.
@@ -67,6 +67,21 @@ extension ExpoSwiftUI {
       }
     }
 
+    /**
+     Updates the environment object only with the props that changed since the last update.
+     */
+    public override func updateChangedProps(_ rawProps: [String: Any]) {
+      guard let appContext else {
+        log.error("AppContext is not available, view props cannot be updated for \(ContentView.self)")
+        return
+      }
+      do {
+        try props.updateChangedRawProps(rawProps, appContext: appContext)
+      } catch let error {
+        log.error("Updating props for \(ContentView.self) has failed: \(error.localizedDescription)")
+      }
+    }
+
     /**
      Returns a bool value whether the view supports prop with the given name.
      */
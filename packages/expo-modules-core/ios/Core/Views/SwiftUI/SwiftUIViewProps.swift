@@ -23,6 +23,20 @@ extension ExpoSwiftUI {
       objectWillChange.send()
     }
 
+    /**
+     Updates only the props that are present in the given dictionary. Unlike `updateRawProps`,
+     props missing in the dictionary keep their current values, even if they are required.
+     */
+    internal func updateChangedRawProps(_ rawProps: [String: Any], appContext: AppContext) throws {
+      try fieldsOf(self).forEach { field in
+        guard let key = field.key, rawProps.keys.contains(key) else {
+          return
+        }
+        try field.set(rawProps[key], appContext: appContext)
+      }
+      objectWillChange.send()
+    }
+
     internal func setUpEvents(_ dispatcher: @escaping (_ eventName: String, _ payload: Any) -> Void) {
       Mirror(reflecting: self).children.forEach { (label: String?, value: Any) in
         guard let event = value as? EventDispatcher else {
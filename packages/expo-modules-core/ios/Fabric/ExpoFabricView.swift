@@ -83,6 +83,18 @@ open class ExpoFabricView: ExpoFabricViewObjC, AnyExpoView {
     }
   }
 
+  public override func updateChangedProps(_ props: [String: Any]) {
+    guard let context = appContext, let propsDict = viewManagerPropDict else {
+      return
+    }
+    for (key, newValue) in props {
+      guard let prop = propsDict[key] else {
+        continue
+      }
+      try? prop.set(value: Conversions.fromNSObject(newValue), onView: self, appContext: context)
+    }
+  }
+
   /**
    Calls lifecycle methods registered by `OnViewDidUpdateProps` definition component.
    */
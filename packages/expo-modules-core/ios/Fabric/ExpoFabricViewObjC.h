@@ -36,10 +36,22 @@
 
 - (void)updateProps:(nonnull NSDictionary<NSString *, id> *)props;
 
+/**
+ Updates only the given props. Unlike `updateProps:`, props missing in the dictionary are left untouched.
+ */
+- (void)updateChangedProps:(nonnull NSDictionary<NSString *, id> *)props;
+
 - (void)viewDidUpdateProps;
 
 - (BOOL)supportsPropWithName:(nonnull NSString *)name;
 
+/**
+ Sets the intrinsic size of the view in the shadow tree, so Yoga lays out the view with it in a single pass,
+ without reporting the size to JavaScript and re-rendering. A given dimension overrides the one from the style.
+ Pass `NaN` to keep a dimension from the style, or `NaN` for both to clear the size.
+ */
+- (void)setShadowNodeSize:(float)width height:(float)height;
+
 // MARK: - Derived from RCTComponentViewProtocol
 
 - (void)prepareForRecycle;
@@ -80,7 +80,13 @@ static NSString *normalizeEventName(NSString *eventName)
  */
 static std::unordered_map<std::string, ExpoViewComponentDescriptor::Flavor> _componentFlavorsCache;
 
-@implementation ExpoFabricViewObjC
+@implementation ExpoFabricViewObjC {
+  /**
+   Props that were last delivered to the view. Used to deliver only props that changed since then.
+   */
+  std::shared_ptr<const ExpoViewProps> _deliveredProps;
+  ExpoViewShadowNode::ConcreteState::Shared _state;
+}
 
 - (instancetype)initWithFrame:(CGRect)frame
 {
@@ -121,23 +127,61 @@ static std::unordered_map<std::string, ExpoViewComponentDescriptor::Flavor> _com
   [super finalizeUpdates:updateMask];
 
   if (updateMask & RNComponentViewUpdateMaskProps) {
-    const auto &newProps = static_cast<const ExpoViewProps &>(*_props);
+    const auto newProps = std::static_pointer_cast<const ExpoViewProps>(_props);
+    const auto deliveredProps = _deliveredProps;
     NSMutableDictionary<NSString *, id> *propsMap = [[NSMutableDictionary alloc] init];
 
-    for (const auto &item : newProps.propsMap) {
+    for (const auto &item : newProps->propsMap) {
+      // Values of props that weren't updated are shared between the props, so in most cases comparing pointers is enough.
+      if (deliveredProps) {
+        const auto deliveredProp = deliveredProps->propsMap.find(item.first);
+        if (deliveredProp != deliveredProps->propsMap.end()
+            && (deliveredProp->second == item.second || *deliveredProp->second == *item.second)) {
+          continue;
+        }
+      }
+
       NSString *propName = [NSString stringWithUTF8String:item.first.c_str()];
 
       // Ignore props inherited from the base view and Yoga.
       if ([self supportsPropWithName:propName]) {
-        propsMap[propName] = convertFollyDynamicToId(item.second);
+        propsMap[propName] = convertFollyDynamicToId(*item.second);
       }
     }
 
-    [self updateProps:propsMap];
+    if (deliveredProps) {
+      [self updateChangedProps:propsMap];
+    } else {
+      // The first update has to set all props, including those that were not provided.
+      [self updateProps:propsMap];
+    }
+    _deliveredProps = newProps;
     [self viewDidUpdateProps];
   }
 }
 
+- (void)updateState:(const facebook::react::State::Shared &)state
+           oldState:(const facebook::react::State::Shared &)oldState
+{
+  _state = std::static_pointer_cast<const ExpoViewShadowNode::ConcreteState>(state);
+}
+
+- (void)prepareForRecycle
+{
+  [super prepareForRecycle];
+  _deliveredProps.reset();
+  _state.reset();
+}
+
+#pragma mark - Layout
+
+- (void)setShadowNodeSize:(float)width height:(float)height
+{
+  if (_state) {
+    _state->updateState(ExpoViewState(width, height));
+  }
+}
+
 #pragma mark - Events
 
 - (void)dispatchEvent:(nonnull NSString *)eventName payload:(nullable id)payload
@@ -156,6 +200,11 @@ static std::unordered_map<std::string, ExpoViewComponentDescriptor::Flavor> _com
   // Implemented in `ExpoFabricView.swift`
 }
 
+- (void)updateChangedProps:(nonnull NSDictionary<NSString *, id> *)props
+{
+  // Implemented in `ExpoFabricView.swift`
+}
+
 - (void)viewDidUpdateProps
 {
   // Implemented in `ExpoFabricView.swift`
@@ -241,6 +241,30 @@ final class EventEmitterSpec: ExpoSpec {
         ])
         expect(try result.asInt()) == 5
       }
+
+      it("handles events that were never listened to") {
+        let listenerCount = try runtime.eval([
+          "emitter = new expo.EventEmitter()",
+          "emitter.emit('neverListenedEvent', 1)",
+          "emitter.removeListener('neverListenedEvent', () => {})",
+          "emitter.removeAllListeners('neverListenedEvent')",
+          "emitter.listenerCount('neverListenedEvent')"
+        ])
+        expect(try listenerCount.asInt()) == 0
+      }
+
+      it("calls a listener added after the event was emitted without listeners") {
+        let result = try runtime.eval([
+          "emitter = new expo.EventEmitter()",
+          "emitter.emit('lateListenedEvent', 1)",
+          "result = 0",
+          "emitter.addListener('lateListenedEvent', (value) => result += value)",
+          "emitter.emit('lateListenedEvent', 2)",
+          "[result, emitter.listenerCount('lateListenedEvent')]"
+        ]).asArray()
+        expect(try result[0]?.asInt()) == 2
+        expect(try result[1]?.asInt()) == 1
+      }
     }
   }
 }
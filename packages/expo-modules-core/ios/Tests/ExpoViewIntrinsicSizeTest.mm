@@ -0,0 +1,63 @@
+// Copyright 2025-present 650 Industries. All rights reserved.
+
+#import <XCTest/XCTest.h>
+
+#if RCT_NEW_ARCH_ENABLED
+
+#import <ExpoModulesCore/ExpoViewShadowNode.h>
+
+#include <limits>
+#include <type_traits>
+
+namespace yoga = facebook::yoga;
+
+using Length = std::decay_t<decltype(yoga::Style{}.dimension(yoga::Dimension::Width))>;
+
+static const float kUnset = std::numeric_limits<float>::quiet_NaN();
+
+@interface ExpoViewIntrinsicSizeTest : XCTestCase
+
+@end
+
+@implementation ExpoViewIntrinsicSizeTest
+{
+  yoga::Style _propsStyle;
+}
+
+- (void)setUp
+{
+  _propsStyle = yoga::Style{};
+  _propsStyle.setDimension(yoga::Dimension::Width, Length::percent(50));
+  _propsStyle.setDimension(yoga::Dimension::Height, Length::points(100));
+}
+
+- (void)test_applyIntrinsicSize_shouldKeepUnsetDimensionFromProps
+{
+  yoga::Style style = _propsStyle;
+
+  XCTAssertTrue(expo::applyIntrinsicSize(style, _propsStyle, expo::ExpoViewState(kUnset, 40)));
+  XCTAssertTrue(style.dimension(yoga::Dimension::Width) == Length::percent(50));
+  XCTAssertTrue(style.dimension(yoga::Dimension::Height) == Length::points(40));
+}
+
+- (void)test_applyIntrinsicSize_shouldRestorePropsWhenCleared
+{
+  yoga::Style style = _propsStyle;
+  expo::applyIntrinsicSize(style, _propsStyle, expo::ExpoViewState(20, 40));
+
+  XCTAssertTrue(expo::applyIntrinsicSize(style, _propsStyle, expo::ExpoViewState(kUnset, kUnset)));
+  XCTAssertTrue(style.dimension(yoga::Dimension::Width) == Length::percent(50));
+  XCTAssertTrue(style.dimension(yoga::Dimension::Height) == Length::points(100));
+}
+
+- (void)test_applyIntrinsicSize_shouldNotChangeStyleTwice
+{
+  yoga::Style style = _propsStyle;
+
+  XCTAssertTrue(expo::applyIntrinsicSize(style, _propsStyle, expo::ExpoViewState(20, kUnset)));
+  XCTAssertFalse(expo::applyIntrinsicSize(style, _propsStyle, expo::ExpoViewState(20, kUnset)));
+}
+
+@end
+
+#endif // RCT_NEW_ARCH_ENABLED
@@ -0,0 +1,73 @@
+// Copyright 2025-present 650 Industries. All rights reserved.
+
+#if RCT_NEW_ARCH_ENABLED
+
+import SwiftUI
+import ExpoModulesTestCore
+
+@testable import ExpoModulesCore
+
+final class ViewPropsUpdateSpec: ExpoSpec {
+  override class func spec() {
+    let appContext = AppContext.create()
+
+    describe("ExpoView") {
+      it("updates only the changed props") {
+        let definition = View(PropsTestView.self) {
+          Prop("title") { (view: PropsTestView, title: String) in
+            view.title = title
+          }
+          Prop("count") { (view: PropsTestView, count: Int) in
+            view.count = count
+          }
+        }
+        let view = definition.createView(appContext: appContext) as! PropsTestView
+
+        view.updateProps(["title": "hello", "count": 1])
+        expect(view.title) == "hello"
+        expect(view.count) == 1
+
+        // The second update contains only the props that changed.
+        view.updateChangedProps(["count": 2])
+        expect(view.title) == "hello"
+        expect(view.count) == 2
+      }
+    }
+
+    describe("SwiftUI view") {
+      it("updates only the changed props") {
+        let definition = View(PropsTestSwiftUIView.self)
+        let view = definition.createView(appContext: appContext) as! ExpoSwiftUI.HostingView<PropsTestSwiftUIProps, PropsTestSwiftUIView>
+
+        view.updateProps(["title": "hello", "count": 1])
+        expect(view.props.title) == "hello"
+        expect(view.props.count) == 1
+
+        // The second update contains only the props that changed.
+        view.updateChangedProps(["count": 2])
+        expect(view.props.title) == "hello"
+        expect(view.props.count) == 2
+      }
+    }
+  }
+}
+
+private final class PropsTestView: ExpoView {
+  var title = ""
+  var count = 0
+}
+
+private final class PropsTestSwiftUIProps: ExpoSwiftUI.ViewProps {
+  @Field var title: String = ""
+  @Field var count: Int = 0
+}
+
+private struct PropsTestSwiftUIView: ExpoSwiftUI.View {
+  @EnvironmentObject var props: PropsTestSwiftUIProps
+
+  var body: some SwiftUI.View {
+    Text("\(props.title) \(props.count)")
+  }
+}
+
+#endif // RCT_NEW_ARCH_ENABLED
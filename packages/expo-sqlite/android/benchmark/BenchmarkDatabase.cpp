@@ -0,0 +1,179 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#include "BenchmarkDatabase.h"
+
+#include <stdexcept>
+
+#include "SQLiteOperations.h"
+
+namespace expo::benchmark {
+
+namespace {
+
+// Copies the column values, like the JNI binding boxing them for Kotlin.
+struct OwningColumnValue {
+  ColumnValue operator()(int64_t value) const { return value; }
+  ColumnValue operator()(double value) const { return value; }
+  ColumnValue operator()(std::string_view text) const {
+    return std::string(text);
+  }
+  ColumnValue operator()(ColumnBlob blob) const {
+    auto data = static_cast<const uint8_t *>(blob.data);
+    return std::vector<uint8_t>(data, data + blob.size);
+  }
+  ColumnValue operator()(std::nullptr_t) const { return nullptr; }
+  ColumnValue operator()(UnsupportedColumnType column) const {
+    throw std::runtime_error("Unsupported parameter type: " +
+                             std::to_string(column.type));
+  }
+};
+
+std::string formatError(sqlite3 *db, int ret) {
+  std::string message("Error code ");
+  message += std::to_string(ret);
+  message += ": ";
+  message += db != nullptr ? ::exsqlite3_errmsg(db) : ::exsqlite3_errstr(ret);
+  return message;
+}
+
+} // namespace
+
+BenchmarkStatement::BenchmarkStatement(sqlite3 *db, const std::string &source)
+    : db(db) {
+  check(prepareStatement(db, source, &stmt));
+}
+
+BenchmarkStatement::~BenchmarkStatement() { ::exsqlite3_finalize(stmt); }
+
+void BenchmarkStatement::bindBlob(int index,
+                                  const std::vector<uint8_t> &value) {
+  check(expo::bindBlob(stmt, index, value.data(), value.size()));
+}
+
+void BenchmarkStatement::bindDouble(int index, double value) {
+  check(::exsqlite3_bind_double(stmt, index, value));
+}
+
+void BenchmarkStatement::bindInt64(int index, int64_t value) {
+  check(::exsqlite3_bind_int64(stmt, index, value));
+}
+
+void BenchmarkStatement::bindNull(int index) {
+  check(::exsqlite3_bind_null(stmt, index));
+}
+
+void BenchmarkStatement::bindText(int index, const std::string &value) {
+  check(expo::bindText(stmt, index, value));
+}
+
+void BenchmarkStatement::clearBindings() {
+  check(::exsqlite3_clear_bindings(stmt));
+}
+
+void BenchmarkStatement::reset() { check(::exsqlite3_reset(stmt)); }
+
+bool BenchmarkStatement::step() {
+  int ret = execution.step(stmt);
+  if (ret == SQLITE_ROW) {
+    return true;
+  }
+  if (ret != SQLITE_DONE) {
+    check(ret);
+  }
+  return false;
+}
+
+std::vector<ColumnValue> BenchmarkStatement::getColumnValues() {
+  int columnCount = ::exsqlite3_column_count(stmt);
+  std::vector<ColumnValue> values;
+  values.reserve(columnCount);
+  for (int i = 0; i < columnCount; ++i) {
+    values.push_back(visitColumnValue(stmt, i, OwningColumnValue()));
+  }
+  return values;
+}
+
+void BenchmarkStatement::check(int ret) {
+  if (ret != SQLITE_OK) {
+    throw std::runtime_error(formatError(db, ret));
+  }
+}
+
+BenchmarkDatabase::BenchmarkDatabase(const std::string &path,
+                                     const std::string &key) {
+  int ret = openDatabase(path, &db);
+  if (ret != SQLITE_OK) {
+    std::string message = formatError(db, ret);
+    ::exsqlite3_close(db);
+    throw std::runtime_error(message);
+  }
+  if (!key.empty()) {
+    // PRAGMA arguments cannot be bound, so the key is quoted as a literal.
+    std::string quotedKey("'");
+    for (char c : key) {
+      if (c == '\'') {
+        quotedKey += '\'';
+      }
+      quotedKey += c;
+    }
+    quotedKey += '\'';
+    exec("PRAGMA key = " + quotedKey + ";");
+  }
+}
+
+BenchmarkDatabase::~BenchmarkDatabase() { ::exsqlite3_close(db); }
+
+void BenchmarkDatabase::exec(const std::string &source) {
+  check(::exsqlite3_exec(db, source.c_str(), nullptr, nullptr, nullptr));
+}
+
+void BenchmarkDatabase::setUpdateHookEnabled(bool enabled) {
+  if (enabled) {
+    ::exsqlite3_update_hook(db, BenchmarkDatabase::onUpdateHook, this);
+  } else {
+    ::exsqlite3_update_hook(db, nullptr, nullptr);
+  }
+}
+
+std::vector<uint8_t> BenchmarkDatabase::readBlob(const std::string &table,
+                                                 const std::string &column,
+                                                 int64_t rowId) {
+  exsqlite3_blob *blob = nullptr;
+  check(::exsqlite3_blob_open(db, "main", table.c_str(), column.c_str(), rowId,
+                            0, &blob));
+  std::vector<uint8_t> data(::exsqlite3_blob_bytes(blob));
+  int ret = ::exsqlite3_blob_read(blob, data.data(), data.size(), 0);
+  ::exsqlite3_blob_close(blob);
+  check(ret);
+  return data;
+}
+
+void BenchmarkDatabase::writeBlob(const std::string &table,
+                                  const std::string &column, int64_t rowId,
+                                  const std::vector<uint8_t> &data) {
+  exsqlite3_blob *blob = nullptr;
+  check(::exsqlite3_blob_open(db, "main", table.c_str(), column.c_str(), rowId,
+                            1, &blob));
+  int ret = ::exsqlite3_blob_write(blob, data.data(), data.size(), 0);
+  ::exsqlite3_blob_close(blob);
+  check(ret);
+}
+
+// static
+void BenchmarkDatabase::onUpdateHook(void *arg, int /* action */,
+                                     const char *databaseName,
+                                     const char *tableName,
+                                     sqlite3_int64 /* rowId */) {
+  auto pThis = reinterpret_cast<BenchmarkDatabase *>(arg);
+  pThis->lastUpdatedDatabase = databaseName;
+  pThis->lastUpdatedTable = tableName;
+  ++pThis->updateCount;
+}
+
+void BenchmarkDatabase::check(int ret) {
+  if (ret != SQLITE_OK) {
+    throw std::runtime_error(formatError(db, ret));
+  }
+}
+
+} // namespace expo::benchmark
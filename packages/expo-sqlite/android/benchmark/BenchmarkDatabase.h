@@ -0,0 +1,93 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "SQLiteExecution.h"
+#include "sqlite3.h"
+
+namespace expo::benchmark {
+
+/**
+ * The owning column value returned by `getColumnValues()`, matching the
+ * boxed values that `NativeStatementBinding` hands over to Kotlin.
+ */
+using ColumnValue = std::variant<std::nullptr_t, int64_t, double, std::string,
+                                 std::vector<uint8_t>>;
+
+/**
+ * A host facade over a prepared statement. It goes through the same
+ * `SQLiteOperations.h` helpers and `StatementExecution` as
+ * `NativeStatementBinding`, without the JNI layer.
+ */
+class BenchmarkStatement {
+public:
+  BenchmarkStatement(sqlite3 *db, const std::string &source);
+  ~BenchmarkStatement();
+
+  BenchmarkStatement(const BenchmarkStatement &) = delete;
+  BenchmarkStatement &operator=(const BenchmarkStatement &) = delete;
+
+  void bindBlob(int index, const std::vector<uint8_t> &value);
+  void bindDouble(int index, double value);
+  void bindInt64(int index, int64_t value);
+  void bindNull(int index);
+  void bindText(int index, const std::string &value);
+  void clearBindings();
+  void reset();
+  // Returns true if a row is available.
+  bool step();
+  std::vector<ColumnValue> getColumnValues();
+
+private:
+  void check(int ret);
+
+  sqlite3 *db;
+  exsqlite3_stmt *stmt = nullptr;
+  StatementExecution execution;
+};
+
+/**
+ * A host facade over a database connection. It opens connections with the same
+ * `openDatabase()` as `NativeDatabaseBinding`, including the vector functions.
+ */
+class BenchmarkDatabase {
+public:
+  // `key` is applied with `PRAGMA key` when non-empty.
+  BenchmarkDatabase(const std::string &path, const std::string &key);
+  ~BenchmarkDatabase();
+
+  BenchmarkDatabase(const BenchmarkDatabase &) = delete;
+  BenchmarkDatabase &operator=(const BenchmarkDatabase &) = delete;
+
+  void exec(const std::string &source);
+  sqlite3 *get() const { return db; }
+
+  // Mirrors `NativeDatabaseBinding::sqlite3_update_hook()`. The hook copies
+  // the database and table names, like the JNI hook converting them to Java
+  // strings.
+  void setUpdateHookEnabled(bool enabled);
+  int64_t getUpdateCount() const { return updateCount; }
+
+  std::vector<uint8_t> readBlob(const std::string &table,
+                                const std::string &column, int64_t rowId);
+  void writeBlob(const std::string &table, const std::string &column,
+                 int64_t rowId, const std::vector<uint8_t> &data);
+
+private:
+  static void onUpdateHook(void *arg, int action, const char *databaseName,
+                           const char *tableName, sqlite3_int64 rowId);
+
+  void check(int ret);
+
+  sqlite3 *db = nullptr;
+  int64_t updateCount = 0;
+  std::string lastUpdatedDatabase;
+  std::string lastUpdatedTable;
+};
+
+} // namespace expo::benchmark
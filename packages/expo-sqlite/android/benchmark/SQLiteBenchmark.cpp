@@ -0,0 +1,411 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BenchmarkDatabase.h"
+
+namespace expo::benchmark {
+
+namespace {
+
+struct Options {
+  int64_t rows = 100000;
+  int repeat = 5;
+  size_t blobSize = 4096;
+  size_t vectorDimensions = 384;
+  std::string filter;
+  std::string outputPath;
+  std::string key;
+};
+
+/**
+ * Measures only the code between `start()` and `stop()`, so that each case
+ * can prepare its fixtures without skewing the results.
+ */
+class Stopwatch {
+public:
+  void start() { startTime = std::chrono::steady_clock::now(); }
+  void stop() {
+    elapsed += std::chrono::steady_clock::now() - startTime;
+  }
+  int64_t elapsedNs() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+        .count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point startTime;
+  std::chrono::steady_clock::duration elapsed{};
+};
+
+// Runs one repetition of a case and returns the number of operations timed.
+using BenchmarkCase =
+    std::function<int64_t(BenchmarkDatabase &, Stopwatch &, const Options &)>;
+
+struct BenchmarkResult {
+  std::string name;
+  int64_t operations = 0;
+  std::vector<int64_t> samplesNs;
+};
+
+const char *kCreateTableSql =
+    "CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT NOT NULL, "
+    "value REAL NOT NULL, data BLOB);";
+
+std::string makeName(int64_t id) { return "item-" + std::to_string(id); }
+
+std::vector<uint8_t> makeBlob(size_t size, uint8_t seed) {
+  std::vector<uint8_t> blob(size);
+  for (size_t i = 0; i < size; ++i) {
+    blob[i] = static_cast<uint8_t>(seed + i * 31);
+  }
+  return blob;
+}
+
+void insertRows(BenchmarkDatabase &db, int64_t rows) {
+  db.exec(kCreateTableSql);
+  db.exec("BEGIN;");
+  BenchmarkStatement statement(
+      db.get(), "INSERT INTO items (id, name, value) VALUES (?, ?, ?);");
+  for (int64_t id = 1; id <= rows; ++id) {
+    statement.bindInt64(1, id);
+    statement.bindText(2, makeName(id));
+    statement.bindDouble(3, static_cast<double>(id) * 0.5);
+    statement.step();
+    statement.reset();
+  }
+  db.exec("COMMIT;");
+}
+
+int64_t bulkInsert(BenchmarkDatabase &db, Stopwatch &stopwatch,
+                   const Options &options) {
+  db.exec(kCreateTableSql);
+  BenchmarkStatement statement(
+      db.get(), "INSERT INTO items (id, name, value) VALUES (?, ?, ?);");
+  stopwatch.start();
+  db.exec("BEGIN;");
+  for (int64_t id = 1; id <= options.rows; ++id) {
+    statement.bindInt64(1, id);
+    statement.bindText(2, makeName(id));
+    statement.bindDouble(3, static_cast<double>(id) * 0.5);
+    statement.step();
+    statement.reset();
+  }
+  db.exec("COMMIT;");
+  stopwatch.stop();
+  return options.rows;
+}
+
+int64_t pointRead(BenchmarkDatabase &db, Stopwatch &stopwatch,
+                  const Options &options) {
+  insertRows(db, options.rows);
+  std::mt19937_64 random(42);
+  std::uniform_int_distribution<int64_t> distribution(1, options.rows);
+  std::vector<int64_t> ids(options.rows);
+  std::generate(ids.begin(), ids.end(),
+                [&]() { return distribution(random); });
+
+  BenchmarkStatement statement(
+      db.get(), "SELECT id, name, value FROM items WHERE id = ?;");
+  stopwatch.start();
+  for (int64_t id : ids) {
+    statement.bindInt64(1, id);
+    while (statement.step()) {
+      statement.getColumnValues();
+    }
+    statement.reset();
+  }
+  stopwatch.stop();
+  return options.rows;
+}
+
+int64_t rangeScan(BenchmarkDatabase &db, Stopwatch &stopwatch,
+                  const Options &options) {
+  constexpr int64_t kRangeSize = 100;
+  insertRows(db, options.rows);
+  BenchmarkStatement statement(
+      db.get(),
+      "SELECT id, name, value FROM items WHERE id BETWEEN ? AND ? ORDER BY id;");
+  int64_t scannedRows = 0;
+  stopwatch.start();
+  for (int64_t first = 1; first <= options.rows; first += kRangeSize) {
+    statement.bindInt64(1, first);
+    statement.bindInt64(2, first + kRangeSize - 1);
+    while (statement.step()) {
+      statement.getColumnValues();
+      ++scannedRows;
+    }
+    statement.reset();
+  }
+  stopwatch.stop();
+  return scannedRows;
+}
+
+int64_t blobRoundTrip(BenchmarkDatabase &db, Stopwatch &stopwatch,
+                      const Options &options) {
+  // Blobs are much larger than rows, so fewer of them are written.
+  int64_t count = std::max<int64_t>(1, options.rows / 10);
+  db.exec(kCreateTableSql);
+  BenchmarkStatement insertStatement(
+      db.get(), "INSERT INTO items (id, name, value, data) VALUES (?, '', 0, ?);");
+  BenchmarkStatement selectStatement(db.get(),
+                                     "SELECT data FROM items WHERE id = ?;");
+  std::vector<uint8_t> blob = makeBlob(options.blobSize, 7);
+  std::vector<uint8_t> updatedBlob = makeBlob(options.blobSize, 11);
+
+  stopwatch.start();
+  db.exec("BEGIN;");
+  for (int64_t id = 1; id <= count; ++id) {
+    insertStatement.bindInt64(1, id);
+    insertStatement.bindBlob(2, blob);
+    insertStatement.step();
+    insertStatement.reset();
+  }
+  db.exec("COMMIT;");
+  // Reads the blobs back as column values, then round-trips them through the
+  // incremental blob I/O used by `NativeBlobBinding`.
+  for (int64_t id = 1; id <= count; ++id) {
+    selectStatement.bindInt64(1, id);
+    while (selectStatement.step()) {
+      selectStatement.getColumnValues();
+    }
+    selectStatement.reset();
+  }
+  db.exec("BEGIN;");
+  for (int64_t id = 1; id <= count; ++id) {
+    db.writeBlob("items", "data", id, updatedBlob);
+    db.readBlob("items", "data", id);
+  }
+  db.exec("COMMIT;");
+  stopwatch.stop();
+  return count;
+}
+
+int64_t updateHook(BenchmarkDatabase &db, Stopwatch &stopwatch,
+                   const Options &options) {
+  insertRows(db, options.rows);
+  db.setUpdateHookEnabled(true);
+  BenchmarkStatement statement(
+      db.get(), "UPDATE items SET value = value + 1 WHERE id = ?;");
+  stopwatch.start();
+  db.exec("BEGIN;");
+  for (int64_t id = 1; id <= options.rows; ++id) {
+    statement.bindInt64(1, id);
+    statement.step();
+    statement.reset();
+  }
+  db.exec("COMMIT;");
+  stopwatch.stop();
+  db.setUpdateHookEnabled(false);
+  if (db.getUpdateCount() != options.rows) {
+    throw std::runtime_error("Unexpected number of update hook calls");
+  }
+  return options.rows;
+}
+
+int64_t vectorScan(BenchmarkDatabase &db, Stopwatch &stopwatch,
+                   const Options &options) {
+  int64_t count = std::max<int64_t>(1, options.rows / 10);
+  db.exec("CREATE TABLE embeddings (id INTEGER PRIMARY KEY, vector BLOB);");
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+  auto makeVector = [&]() {
+    std::vector<float> values(options.vectorDimensions);
+    std::generate(values.begin(), values.end(),
+                  [&]() { return distribution(random); });
+    std::vector<uint8_t> bytes(values.size() * sizeof(float));
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    return bytes;
+  };
+  {
+    BenchmarkStatement insertStatement(
+        db.get(), "INSERT INTO embeddings (id, vector) VALUES (?, ?);");
+    db.exec("BEGIN;");
+    for (int64_t id = 1; id <= count; ++id) {
+      insertStatement.bindInt64(1, id);
+      insertStatement.bindBlob(2, makeVector());
+      insertStatement.step();
+      insertStatement.reset();
+    }
+    db.exec("COMMIT;");
+  }
+
+  BenchmarkStatement statement(
+      db.get(), "SELECT vec_top_k(id, vec_distance_cosine(vector, ?), 10) "
+                "FROM embeddings;");
+  statement.bindBlob(1, makeVector());
+  stopwatch.start();
+  while (statement.step()) {
+    statement.getColumnValues();
+  }
+  stopwatch.stop();
+  return count;
+}
+
+const std::vector<std::pair<std::string, BenchmarkCase>> kBenchmarkCases = {
+    {"bulk_insert", bulkInsert},   {"point_read", pointRead},
+    {"range_scan", rangeScan},     {"blob_roundtrip", blobRoundTrip},
+    {"update_hook", updateHook},   {"vector_scan", vectorScan},
+};
+
+void removeDatabaseFiles(const std::filesystem::path &path) {
+  std::error_code error;
+  for (const char *suffix : {"", "-wal", "-shm", "-journal"}) {
+    std::filesystem::remove(path.string() + suffix, error);
+  }
+}
+
+BenchmarkResult runBenchmark(const std::string &name,
+                             const BenchmarkCase &benchmarkCase,
+                             const Options &options) {
+  BenchmarkResult result;
+  result.name = name;
+  auto path = std::filesystem::temp_directory_path() /
+              ("expo-sqlite-benchmark-" + name + ".db");
+  for (int i = 0; i < options.repeat; ++i) {
+    removeDatabaseFiles(path);
+    Stopwatch stopwatch;
+    {
+      BenchmarkDatabase db(path.string(), options.key);
+      // Matches the journal mode recommended for expo-sqlite databases.
+      db.exec("PRAGMA journal_mode = WAL;");
+      result.operations = benchmarkCase(db, stopwatch, options);
+    }
+    result.samplesNs.push_back(stopwatch.elapsedNs());
+  }
+  removeDatabaseFiles(path);
+  return result;
+}
+
+std::string escapeJson(const std::string &value) {
+  std::string result;
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result;
+}
+
+void writeJson(std::ostream &out, const Options &options,
+               const std::vector<BenchmarkResult> &results) {
+  out << "{\n";
+  out << "  \"sqliteVersion\": \"" << escapeJson(::exsqlite3_libversion())
+      << "\",\n";
+#if EXPO_SQLITE_BENCHMARK_SQLCIPHER
+  out << "  \"sqlcipher\": true,\n";
+#else
+  out << "  \"sqlcipher\": false,\n";
+#endif
+  out << "  \"rows\": " << options.rows << ",\n";
+  out << "  \"repeat\": " << options.repeat << ",\n";
+  out << "  \"results\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto &result = results[i];
+    std::vector<int64_t> samples = result.samplesNs;
+    std::sort(samples.begin(), samples.end());
+    int64_t medianNs = samples[samples.size() / 2];
+    double operations = static_cast<double>(std::max<int64_t>(1, result.operations));
+    out << (i > 0 ? "," : "") << "\n    {";
+    out << "\"name\": \"" << escapeJson(result.name) << "\", ";
+    out << "\"operations\": " << result.operations << ", ";
+    out << "\"minNs\": " << samples.front() << ", ";
+    out << "\"medianNs\": " << medianNs << ", ";
+    out << "\"maxNs\": " << samples.back() << ", ";
+    out << "\"nsPerOperation\": " << medianNs / operations << ", ";
+    out << "\"operationsPerSecond\": "
+        << (medianNs > 0 ? operations * 1e9 / medianNs : 0.0) << "}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+void printUsage(const char *programName) {
+  std::cerr << "Usage: " << programName
+            << " [--rows N] [--repeat N] [--blob-size BYTES]"
+               " [--vector-dimensions N] [--filter NAME] [--output FILE]"
+               " [--key KEY]\n";
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--help") {
+      return false;
+    }
+    if (i + 1 >= argc) {
+      std::cerr << "Missing value for " << arg << "\n";
+      return false;
+    }
+    std::string value = argv[++i];
+    if (arg == "--rows") {
+      options.rows = std::stoll(value);
+    } else if (arg == "--repeat") {
+      options.repeat = std::stoi(value);
+    } else if (arg == "--blob-size") {
+      options.blobSize = std::stoul(value);
+    } else if (arg == "--vector-dimensions") {
+      options.vectorDimensions = std::stoul(value);
+    } else if (arg == "--filter") {
+      options.filter = value;
+    } else if (arg == "--output") {
+      options.outputPath = value;
+    } else if (arg == "--key") {
+      options.key = value;
+    } else {
+      std::cerr << "Unknown option " << arg << "\n";
+      return false;
+    }
+  }
+  return options.rows > 0 && options.repeat > 0;
+}
+
+} // namespace
+
+} // namespace expo::benchmark
+
+int main(int argc, char **argv) {
+  using namespace expo::benchmark;
+
+  Options options;
+#if EXPO_SQLITE_BENCHMARK_SQLCIPHER
+  options.key = "expo-sqlite-benchmark";
+#endif
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return 1;
+  }
+
+  std::vector<BenchmarkResult> results;
+  try {
+    for (const auto &[name, benchmarkCase] : kBenchmarkCases) {
+      if (!options.filter.empty() &&
+          name.find(options.filter) == std::string::npos) {
+        continue;
+      }
+      std::cerr << "Running " << name << "...\n";
+      results.push_back(runBenchmark(name, benchmarkCase, options));
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "Benchmark failed: " << e.what() << "\n";
+    return 1;
+  }
+
+  if (options.outputPath.empty()) {
+    writeJson(std::cout, options, results);
+  } else {
+    std::ofstream out(options.outputPath);
+    writeJson(out, options, results);
+  }
+  return 0;
+}
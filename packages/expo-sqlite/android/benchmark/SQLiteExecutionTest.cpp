@@ -0,0 +1,157 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+// Tests for the cancellation and timeouts of `ExecutionController`, run with
+// `ctest`. Every case uses a fresh in-memory connection.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SQLiteExecution.h"
+#include "sqlite3.h"
+
+namespace {
+
+// Never finishes unless it's aborted.
+constexpr char kEndlessQuery[] =
+    "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c) "
+    "SELECT count(*) FROM c";
+// Long enough to run the progress handler many times.
+constexpr char kFiniteQuery[] =
+    "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c "
+    "WHERE x < 100000) SELECT count(*) FROM c";
+
+int failures = 0;
+
+void expect(bool condition, const char *message) {
+  if (!condition) {
+    std::fprintf(stderr, "  FAILED: %s\n", message);
+    failures++;
+  }
+}
+
+class Connection {
+public:
+  Connection() { ::exsqlite3_open(":memory:", &db); }
+  ~Connection() { ::exsqlite3_close(db); }
+
+  sqlite3 *db = nullptr;
+};
+
+class Statement {
+public:
+  Statement(sqlite3 *db, const char *source) {
+    ::exsqlite3_prepare_v2(db, source, -1, &stmt, nullptr);
+  }
+  ~Statement() { ::exsqlite3_finalize(stmt); }
+
+  int step() { return execution.step(stmt); }
+
+  exsqlite3_stmt *stmt = nullptr;
+  expo::StatementExecution execution;
+};
+
+void testTimeout() {
+  Connection connection;
+  expo::ExecutionController executions;
+  Statement statement(connection.db, kEndlessQuery);
+
+  executions.begin(connection.db, statement.execution, 20);
+  expect(statement.step() == SQLITE_INTERRUPT,
+         "the statement is aborted after its timeout");
+  executions.end(connection.db, statement.execution);
+}
+
+void testInterrupt() {
+  Connection connection;
+  expo::ExecutionController executions;
+  Statement statement(connection.db, kEndlessQuery);
+
+  executions.begin(connection.db, statement.execution, 0);
+  int ret = SQLITE_OK;
+  std::thread worker([&] { ret = statement.step(); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  executions.interrupt(statement.execution);
+  worker.join();
+  executions.end(connection.db, statement.execution);
+  expect(ret == SQLITE_INTERRUPT, "the interrupted statement is aborted");
+}
+
+void testInterruptAfterEnd() {
+  Connection connection;
+  expo::ExecutionController executions;
+  Statement statement(connection.db, kFiniteQuery);
+
+  executions.begin(connection.db, statement.execution, 0);
+  executions.end(connection.db, statement.execution);
+  executions.interrupt(statement.execution);
+
+  executions.begin(connection.db, statement.execution, 0);
+  expect(statement.step() == SQLITE_ROW,
+         "an interrupt after the execution ended doesn't abort the next one");
+  executions.end(connection.db, statement.execution);
+}
+
+void testOverlappingTimeouts() {
+  Connection connection;
+  expo::ExecutionController executions;
+  Statement running(connection.db, kFiniteQuery);
+  Statement overlapping(connection.db, kFiniteQuery);
+
+  executions.begin(connection.db, running.execution, 0);
+  // Starts while the other execution is active, with a deadline that passes
+  // before either statement steps.
+  executions.begin(connection.db, overlapping.execution, 1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+  expect(running.step() == SQLITE_ROW,
+         "the deadline of an overlapping execution doesn't abort the other one");
+  expect(overlapping.step() == SQLITE_INTERRUPT,
+         "the overlapping execution is aborted after its own timeout");
+  executions.end(connection.db, overlapping.execution);
+  executions.end(connection.db, running.execution);
+}
+
+void testOverlappingInterrupts() {
+  Connection connection;
+  expo::ExecutionController executions;
+  Statement running(connection.db, kFiniteQuery);
+  Statement overlapping(connection.db, kFiniteQuery);
+
+  executions.begin(connection.db, running.execution, 0);
+  executions.begin(connection.db, overlapping.execution, 0);
+  executions.interrupt(running.execution);
+
+  expect(overlapping.step() == SQLITE_ROW,
+         "interrupting one execution doesn't abort the overlapping one");
+  executions.end(connection.db, overlapping.execution);
+  // The progress handler stays installed until the last execution ends.
+  expect(running.step() == SQLITE_INTERRUPT,
+         "the interrupted execution is aborted after the other one ended");
+  executions.end(connection.db, running.execution);
+}
+
+} // namespace
+
+int main() {
+  const std::vector<std::pair<std::string, std::function<void()>>> tests = {
+      {"timeout", testTimeout},
+      {"interrupt", testInterrupt},
+      {"interrupt_after_end", testInterruptAfterEnd},
+      {"overlapping_timeouts", testOverlappingTimeouts},
+      {"overlapping_interrupts", testOverlappingInterrupts},
+  };
+  for (const auto &[name, test] : tests) {
+    std::printf("%s\n", name.c_str());
+    test();
+  }
+  if (failures > 0) {
+    std::fprintf(stderr, "%d expectation(s) failed\n", failures);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,49 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#include "NativeBackupBinding.h"
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+// static
+void NativeBackupBinding::registerNatives() {
+  registerHybrid({
+      makeNativeMethod("initHybrid", NativeBackupBinding::initHybrid),
+      makeNativeMethod("sqlite3_backup_finish",
+                       NativeBackupBinding::sqlite3_backup_finish),
+      makeNativeMethod("sqlite3_backup_pagecount",
+                       NativeBackupBinding::sqlite3_backup_pagecount),
+      makeNativeMethod("sqlite3_backup_remaining",
+                       NativeBackupBinding::sqlite3_backup_remaining),
+      makeNativeMethod("sqlite3_backup_step",
+                       NativeBackupBinding::sqlite3_backup_step),
+  });
+}
+
+int NativeBackupBinding::sqlite3_backup_finish() {
+  int ret = ::exsqlite3_backup_finish(backup);
+  // The handle is always released, even if an error is returned.
+  backup = nullptr;
+  return ret;
+}
+
+int NativeBackupBinding::sqlite3_backup_pagecount() {
+  return ::exsqlite3_backup_pagecount(backup);
+}
+
+int NativeBackupBinding::sqlite3_backup_remaining() {
+  return ::exsqlite3_backup_remaining(backup);
+}
+
+int NativeBackupBinding::sqlite3_backup_step(int pages) {
+  return ::exsqlite3_backup_step(backup, pages);
+}
+
+// static
+jni::local_ref<NativeBackupBinding::jhybriddata>
+NativeBackupBinding::initHybrid(jni::alias_ref<jhybridobject> jThis) {
+  return makeCxxInstance(jThis);
+}
+
+} // namespace expo
@@ -0,0 +1,46 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+
+#include "sqlite3.h"
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+class NativeDatabaseBinding;
+
+/**
+ * A binding for the sqlite3 online backup API.
+ */
+class NativeBackupBinding : public jni::HybridClass<NativeBackupBinding> {
+public:
+  static constexpr auto kJavaDescriptor =
+      "Lexpo/modules/sqlite/NativeBackupBinding;";
+
+  static void registerNatives();
+
+  // sqlite3 bindings
+  int sqlite3_backup_finish();
+  int sqlite3_backup_pagecount();
+  int sqlite3_backup_remaining();
+  int sqlite3_backup_step(int pages);
+
+private:
+  explicit NativeBackupBinding(
+      jni::alias_ref<NativeBackupBinding::jhybridobject> jThis) {}
+
+private:
+  static jni::local_ref<jhybriddata>
+  initHybrid(jni::alias_ref<jhybridobject> jThis);
+
+private:
+  friend HybridBase;
+  friend NativeDatabaseBinding;
+
+  exsqlite3_backup *backup = nullptr;
+};
+
+} // namespace expo
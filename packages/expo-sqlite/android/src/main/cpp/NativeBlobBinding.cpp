@@ -0,0 +1,105 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#include "NativeBlobBinding.h"
+
+#include "NativeDatabaseBinding.h"
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+// static
+void NativeBlobBinding::registerNatives() {
+  registerHybrid({
+      makeNativeMethod("initHybrid", NativeBlobBinding::initHybrid),
+      makeNativeMethod("sqlite3_blob_bytes",
+                       NativeBlobBinding::sqlite3_blob_bytes),
+      makeNativeMethod("sqlite3_blob_close",
+                       NativeBlobBinding::sqlite3_blob_close),
+      makeNativeMethod("sqlite3_blob_read", NativeBlobBinding::sqlite3_blob_read),
+      makeNativeMethod("sqlite3_blob_reopen",
+                       NativeBlobBinding::sqlite3_blob_reopen),
+      makeNativeMethod("sqlite3_blob_write",
+                       NativeBlobBinding::sqlite3_blob_write),
+      makeNativeMethod("readBytes", NativeBlobBinding::readBytes),
+      makeNativeMethod("writeBytes", NativeBlobBinding::writeBytes),
+  });
+}
+
+NativeBlobBinding::~NativeBlobBinding() {
+  // Releases the handle of a blob that was deallocated without being closed.
+  if (blob != nullptr) {
+    ::exsqlite3_blob_close(blob);
+    blob = nullptr;
+  }
+}
+
+int NativeBlobBinding::sqlite3_blob_bytes() {
+  return ::exsqlite3_blob_bytes(blob);
+}
+
+int NativeBlobBinding::sqlite3_blob_close() {
+  int ret = ::exsqlite3_blob_close(blob);
+  // The handle is always released, even if an error is returned.
+  blob = nullptr;
+  return ret;
+}
+
+int NativeBlobBinding::sqlite3_blob_read(
+    jni::alias_ref<jni::JByteBuffer> buffer, int length, int offset) {
+  if (length < 0 || static_cast<size_t>(length) > buffer->getDirectSize()) {
+    jni::throwNewJavaException(
+        SQLiteErrorException::create("Buffer is too small for the read length")
+            .get());
+  }
+  return ::exsqlite3_blob_read(blob, buffer->getDirectBytes(), length, offset);
+}
+
+int NativeBlobBinding::sqlite3_blob_reopen(int64_t rowId) {
+  return ::exsqlite3_blob_reopen(blob, rowId);
+}
+
+int NativeBlobBinding::sqlite3_blob_write(
+    jni::alias_ref<jni::JByteBuffer> buffer, int length, int offset) {
+  if (length < 0 || static_cast<size_t>(length) > buffer->getDirectSize()) {
+    jni::throwNewJavaException(
+        SQLiteErrorException::create("Buffer is too small for the write length")
+            .get());
+  }
+  return ::exsqlite3_blob_write(blob, buffer->getDirectBytes(), length, offset);
+}
+
+jni::local_ref<jni::JArrayByte> NativeBlobBinding::readBytes(int offset,
+                                                             int length) {
+  if (length < 0) {
+    jni::throwNewJavaException(
+        SQLiteErrorException::create("Read length must not be negative").get());
+  }
+  auto byteArray = jni::JArrayByte::newArray(length);
+  // Pins or copies the Java array once, and lets sqlite write into it directly.
+  auto region = byteArray->pin();
+  int ret = ::exsqlite3_blob_read(blob, region.get(), length, offset);
+  if (ret != SQLITE_OK) {
+    region.abort();
+    jni::throwNewJavaException(
+        SQLiteErrorException::create(::exsqlite3_errstr(ret)).get());
+  }
+  region.release();
+  return byteArray;
+}
+
+int NativeBlobBinding::writeBytes(jni::alias_ref<jni::JArrayByte> data,
+                                  int offset) {
+  auto region = data->pin();
+  int ret = ::exsqlite3_blob_write(blob, region.get(), region.size(), offset);
+  region.abort();
+  return ret;
+}
+
+// static
+jni::local_ref<NativeBlobBinding::jhybriddata>
+NativeBlobBinding::initHybrid(jni::alias_ref<jhybridobject> jThis) {
+  return makeCxxInstance(jThis);
+}
+
+} // namespace expo
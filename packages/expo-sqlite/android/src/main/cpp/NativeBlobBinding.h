@@ -0,0 +1,58 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include <fbjni/ByteBuffer.h>
+
+#include "sqlite3.h"
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+class NativeDatabaseBinding;
+
+/**
+ * A binding for the sqlite3 incremental blob I/O.
+ * Reading and writing are done in chunks so that large blobs never have to be
+ * fully materialized in memory.
+ */
+class NativeBlobBinding : public jni::HybridClass<NativeBlobBinding> {
+public:
+  static constexpr auto kJavaDescriptor =
+      "Lexpo/modules/sqlite/NativeBlobBinding;";
+
+  static void registerNatives();
+
+  ~NativeBlobBinding();
+
+  // sqlite3 bindings
+  int sqlite3_blob_bytes();
+  int sqlite3_blob_close();
+  int sqlite3_blob_read(jni::alias_ref<jni::JByteBuffer> buffer, int length,
+                        int offset);
+  int sqlite3_blob_reopen(int64_t rowId);
+  int sqlite3_blob_write(jni::alias_ref<jni::JByteBuffer> buffer, int length,
+                         int offset);
+
+  // helpers
+  jni::local_ref<jni::JArrayByte> readBytes(int offset, int length);
+  int writeBytes(jni::alias_ref<jni::JArrayByte> data, int offset);
+
+private:
+  explicit NativeBlobBinding(
+      jni::alias_ref<NativeBlobBinding::jhybridobject> jThis) {}
+
+private:
+  static jni::local_ref<jhybriddata>
+  initHybrid(jni::alias_ref<jhybridobject> jThis);
+
+private:
+  friend HybridBase;
+  friend NativeDatabaseBinding;
+
+  exsqlite3_blob *blob = nullptr;
+};
+
+} // namespace expo
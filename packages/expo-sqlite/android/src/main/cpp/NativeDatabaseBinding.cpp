@@ -2,6 +2,10 @@
 
 #include "NativeDatabaseBinding.h"
 
+#include <algorithm>
+
+#include "SQLiteOperations.h"
+
 namespace jni = facebook::jni;
 
 namespace expo {
@@ -16,11 +20,19 @@ constexpr char TAG[] = "expo-sqlite";
 void NativeDatabaseBinding::registerNatives() {
   registerHybrid({
       makeNativeMethod("initHybrid", NativeDatabaseBinding::initHybrid),
+      makeNativeMethod("sqlite3_backup_init",
+                       NativeDatabaseBinding::sqlite3_backup_init),
+      makeNativeMethod("sqlite3_blob_open",
+                       NativeDatabaseBinding::sqlite3_blob_open),
       makeNativeMethod("sqlite3_changes",
                        NativeDatabaseBinding::sqlite3_changes),
       makeNativeMethod("sqlite3_close", NativeDatabaseBinding::sqlite3_close),
       makeNativeMethod("sqlite3_db_filename",
                        NativeDatabaseBinding::sqlite3_db_filename),
+      makeNativeMethod("sqlite3_db_release_memory",
+                       NativeDatabaseBinding::sqlite3_db_release_memory),
+      makeNativeMethod("sqlite3_db_status",
+                       NativeDatabaseBinding::sqlite3_db_status),
       makeNativeMethod("sqlite3_enable_load_extension",
                        NativeDatabaseBinding::sqlite3_enable_load_extension),
       makeNativeMethod("sqlite3_exec", NativeDatabaseBinding::sqlite3_exec),
@@ -39,11 +51,49 @@ void NativeDatabaseBinding::registerNatives() {
                        NativeDatabaseBinding::sqlite3_deserialize),
       makeNativeMethod("sqlite3_update_hook",
                        NativeDatabaseBinding::sqlite3_update_hook),
+      makeNativeMethod("sqlite3_soft_heap_limit64",
+                       NativeDatabaseBinding::sqlite3_soft_heap_limit64),
+      makeNativeMethod("sqlite3_status64",
+                       NativeDatabaseBinding::sqlite3_status64),
       makeNativeMethod("convertSqlLiteErrorToString",
                        NativeDatabaseBinding::convertSqlLiteErrorToString),
+      makeNativeMethod("openKVStore", NativeDatabaseBinding::openKVStore),
+      makeNativeMethod("beginExecution", NativeDatabaseBinding::beginExecution),
+      makeNativeMethod("endExecution", NativeDatabaseBinding::endExecution),
+      makeNativeMethod("interruptExecution",
+                       NativeDatabaseBinding::interruptExecution),
+      makeNativeMethod("enableProfiler", NativeDatabaseBinding::enableProfiler),
+      makeNativeMethod("disableProfiler",
+                       NativeDatabaseBinding::disableProfiler),
+      makeNativeMethod("getSlowQueries", NativeDatabaseBinding::getSlowQueries),
+      makeNativeMethod("getStatementProfiles",
+                       NativeDatabaseBinding::getStatementProfiles),
+      makeNativeMethod("resetProfiler", NativeDatabaseBinding::resetProfiler),
   });
 }
 
+int NativeDatabaseBinding::sqlite3_backup_init(
+    const std::string &destDatabaseName,
+    jni::alias_ref<NativeDatabaseBinding::javaobject> source,
+    const std::string &sourceDatabaseName,
+    jni::alias_ref<NativeBackupBinding::javaobject> backup) {
+  NativeDatabaseBinding *cSource = cthis(source);
+  NativeBackupBinding *cBackup = cthis(backup);
+  cBackup->backup =
+      ::exsqlite3_backup_init(db, destDatabaseName.c_str(), cSource->db,
+                            sourceDatabaseName.c_str());
+  return cBackup->backup != nullptr ? SQLITE_OK : ::exsqlite3_errcode(db);
+}
+
+int NativeDatabaseBinding::sqlite3_blob_open(
+    const std::string &databaseName, const std::string &tableName,
+    const std::string &columnName, int64_t rowId, int flags,
+    jni::alias_ref<NativeBlobBinding::javaobject> blob) {
+  NativeBlobBinding *cBlob = cthis(blob);
+  return ::exsqlite3_blob_open(db, databaseName.c_str(), tableName.c_str(),
+                             columnName.c_str(), rowId, flags, &cBlob->blob);
+}
+
 int NativeDatabaseBinding::sqlite3_changes() { return ::exsqlite3_changes(db); }
 
 int NativeDatabaseBinding::sqlite3_close() {
@@ -57,6 +107,23 @@ NativeDatabaseBinding::sqlite3_db_filename(const std::string &databaseName) {
   return ::exsqlite3_db_filename(db, databaseName.c_str());
 }
 
+int NativeDatabaseBinding::sqlite3_db_release_memory() {
+  return ::exsqlite3_db_release_memory(db);
+}
+
+jni::local_ref<jni::JArrayInt>
+NativeDatabaseBinding::sqlite3_db_status(int op, bool reset) {
+  // [current, highwater], or null if the op is not supported.
+  jint values[2] = {0, 0};
+  if (::exsqlite3_db_status(db, op, &values[0], &values[1], reset ? 1 : 0) !=
+      SQLITE_OK) {
+    return nullptr;
+  }
+  auto result = jni::JArrayInt::newArray(2);
+  result->setRegion(0, 2, values);
+  return result;
+}
+
 int NativeDatabaseBinding::sqlite3_enable_load_extension(int onoff) {
   return ::exsqlite3_enable_load_extension(db, onoff);
 }
@@ -94,15 +161,14 @@ int NativeDatabaseBinding::sqlite3_load_extension(
 }
 
 int NativeDatabaseBinding::sqlite3_open(const std::string &dbPath) {
-  return ::exsqlite3_open(dbPath.c_str(), &db);
+  return openDatabase(dbPath, &db);
 }
 
 int NativeDatabaseBinding::sqlite3_prepare_v2(
     const std::string &source,
     jni::alias_ref<NativeStatementBinding::javaobject> statement) {
   NativeStatementBinding *cStatement = cthis(statement);
-  return ::exsqlite3_prepare_v2(db, source.c_str(), source.size(),
-                              &cStatement->stmt, nullptr);
+  return prepareStatement(db, source, &cStatement->stmt);
 }
 
 jni::local_ref<jni::JArrayByte>
@@ -145,6 +211,29 @@ void NativeDatabaseBinding::sqlite3_update_hook(bool enabled) {
   }
 }
 
+// static
+int64_t NativeDatabaseBinding::sqlite3_soft_heap_limit64(jni::alias_ref<jclass>,
+                                                         int64_t limit) {
+  return ::exsqlite3_soft_heap_limit64(limit);
+}
+
+// static
+jni::local_ref<jni::JArrayLong>
+NativeDatabaseBinding::sqlite3_status64(jni::alias_ref<jclass>, int op,
+                                        bool reset) {
+  // [current, highwater], or null if the op is not supported.
+  sqlite3_int64 current = 0;
+  sqlite3_int64 highwater = 0;
+  if (::exsqlite3_status64(op, &current, &highwater, reset ? 1 : 0) !=
+      SQLITE_OK) {
+    return nullptr;
+  }
+  jlong values[2] = {current, highwater};
+  auto result = jni::JArrayLong::newArray(2);
+  result->setRegion(0, 2, values);
+  return result;
+}
+
 jni::local_ref<jni::JString>
 NativeDatabaseBinding::convertSqlLiteErrorToString() {
   int code = exsqlite3_errcode(db);
@@ -156,6 +245,72 @@ NativeDatabaseBinding::convertSqlLiteErrorToString() {
   return jni::make_jstring(result);
 }
 
+int NativeDatabaseBinding::openKVStore(
+    const std::string &tableName,
+    jni::alias_ref<NativeKVStoreBinding::javaobject> kvStore) {
+  NativeKVStoreBinding *cKVStore = cthis(kvStore);
+  return cKVStore->open(db, tableName);
+}
+
+void NativeDatabaseBinding::beginExecution(
+    jni::alias_ref<NativeStatementBinding::javaobject> statement,
+    double timeoutMs) {
+  executions.begin(db, cthis(statement)->execution, timeoutMs);
+}
+
+void NativeDatabaseBinding::endExecution(
+    jni::alias_ref<NativeStatementBinding::javaobject> statement) {
+  executions.end(db, cthis(statement)->execution);
+}
+
+void NativeDatabaseBinding::interruptExecution(
+    jni::alias_ref<NativeStatementBinding::javaobject> statement) {
+  executions.interrupt(cthis(statement)->execution);
+}
+
+void NativeDatabaseBinding::enableProfiler(double slowQueryThresholdMs,
+                                           int slowQueryLogSize) {
+  // Unregisters the previous callback first, so that no trace event can reach
+  // the profiler while it is being replaced.
+  ::exsqlite3_trace_v2(db, 0, nullptr, nullptr);
+  std::atomic_store(&profiler,
+                    std::make_shared<SQLiteProfiler>(
+                        static_cast<int64_t>(slowQueryThresholdMs * 1000000),
+                        static_cast<size_t>(std::max(slowQueryLogSize, 0))));
+  ::exsqlite3_trace_v2(db, SQLITE_TRACE_PROFILE, NativeDatabaseBinding::OnTrace,
+                     this);
+}
+
+void NativeDatabaseBinding::disableProfiler() {
+  ::exsqlite3_trace_v2(db, 0, nullptr, nullptr);
+  std::atomic_store(&profiler, std::shared_ptr<SQLiteProfiler>());
+}
+
+jni::local_ref<jni::JArrayList<JSlowQuery>>
+NativeDatabaseBinding::getSlowQueries() {
+  auto profiler = std::atomic_load(&this->profiler);
+  if (!profiler) {
+    return jni::JArrayList<JSlowQuery>::create(0);
+  }
+  return profiler->getSlowQueries();
+}
+
+jni::local_ref<jni::JArrayList<JStatementProfile>>
+NativeDatabaseBinding::getStatementProfiles() {
+  auto profiler = std::atomic_load(&this->profiler);
+  if (!profiler) {
+    return jni::JArrayList<JStatementProfile>::create(0);
+  }
+  return profiler->getStatementProfiles();
+}
+
+void NativeDatabaseBinding::resetProfiler() {
+  auto profiler = std::atomic_load(&this->profiler);
+  if (profiler) {
+    profiler->reset();
+  }
+}
+
 // static
 jni::local_ref<NativeDatabaseBinding::jhybriddata>
 NativeDatabaseBinding::initHybrid(jni::alias_ref<jhybridobject> jThis) {
@@ -175,4 +330,19 @@ void NativeDatabaseBinding::OnUpdateHook(void *arg, int action,
          jni::make_jstring(tableName).get(), rowId);
 }
 
+// static
+int NativeDatabaseBinding::OnTrace(unsigned type, void *arg, void *p,
+                                   void *x) {
+  NativeDatabaseBinding *pThis = reinterpret_cast<NativeDatabaseBinding *>(arg);
+  if (type != SQLITE_TRACE_PROFILE) {
+    return 0;
+  }
+  auto profiler = std::atomic_load(&pThis->profiler);
+  if (profiler) {
+    profiler->onProfile(reinterpret_cast<exsqlite3_stmt *>(p),
+                        *reinterpret_cast<int64_t *>(x));
+  }
+  return 0;
+}
+
 } // namespace expo
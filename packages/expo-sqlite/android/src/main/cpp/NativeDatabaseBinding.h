@@ -3,9 +3,15 @@
 #pragma once
 
 #include <fbjni/fbjni.h>
+#include <memory>
 #include <string>
 
+#include "NativeBackupBinding.h"
+#include "NativeBlobBinding.h"
+#include "NativeKVStoreBinding.h"
 #include "NativeStatementBinding.h"
+#include "SQLiteExecution.h"
+#include "SQLiteProfiler.h"
 #include "sqlite3.h"
 
 namespace jni = facebook::jni;
@@ -20,9 +26,21 @@ public:
   static void registerNatives();
 
   // sqlite3 bindings
+  int sqlite3_backup_init(
+      const std::string &destDatabaseName,
+      jni::alias_ref<NativeDatabaseBinding::javaobject> source,
+      const std::string &sourceDatabaseName,
+      jni::alias_ref<NativeBackupBinding::javaobject> backup);
+  int sqlite3_blob_open(const std::string &databaseName,
+                        const std::string &tableName,
+                        const std::string &columnName, int64_t rowId,
+                        int flags,
+                        jni::alias_ref<NativeBlobBinding::javaobject> blob);
   int sqlite3_changes();
   int sqlite3_close();
   std::string sqlite3_db_filename(const std::string &databaseName);
+  int sqlite3_db_release_memory();
+  jni::local_ref<jni::JArrayInt> sqlite3_db_status(int op, bool reset);
   int sqlite3_enable_load_extension(int onoff);
   int sqlite3_exec(const std::string &source);
   int sqlite3_get_autocommit();
@@ -39,8 +57,31 @@ public:
                           jni::alias_ref<jni::JArrayByte> serializedData);
   void sqlite3_update_hook(bool enabled);
 
+  // process-wide sqlite3 bindings
+  static int64_t sqlite3_soft_heap_limit64(jni::alias_ref<jclass>,
+                                           int64_t limit);
+  static jni::local_ref<jni::JArrayLong>
+  sqlite3_status64(jni::alias_ref<jclass>, int op, bool reset);
+
   // helpers
   jni::local_ref<jni::JString> convertSqlLiteErrorToString();
+  int openKVStore(const std::string &tableName,
+                  jni::alias_ref<NativeKVStoreBinding::javaobject> kvStore);
+
+  // execution control
+  void beginExecution(
+      jni::alias_ref<NativeStatementBinding::javaobject> statement,
+      double timeoutMs);
+  void endExecution(jni::alias_ref<NativeStatementBinding::javaobject> statement);
+  void interruptExecution(
+      jni::alias_ref<NativeStatementBinding::javaobject> statement);
+
+  // profiler
+  void enableProfiler(double slowQueryThresholdMs, int slowQueryLogSize);
+  void disableProfiler();
+  jni::local_ref<jni::JArrayList<JSlowQuery>> getSlowQueries();
+  jni::local_ref<jni::JArrayList<JStatementProfile>> getStatementProfiles();
+  void resetProfiler();
 
 private:
   explicit NativeDatabaseBinding(
@@ -54,11 +95,21 @@ private:
   static void OnUpdateHook(void *arg, int action, char const *databaseName,
                            char const *tableName, sqlite3_int64 rowId);
 
+  static int OnTrace(unsigned type, void *arg, void *p, void *x);
+
 private:
   friend HybridBase;
 
   jni::global_ref<NativeDatabaseBinding::javaobject> javaPart_;
   sqlite3 *db;
+  // Swapped on the module queue while the sync report functions and trace
+  // callbacks read it from other threads. Always accessed through
+  // `std::atomic_load`/`std::atomic_store`, so readers keep their copy alive.
+  std::shared_ptr<SQLiteProfiler> profiler;
+
+  // Executions run on the JS thread for the sync functions and on the module
+  // queue for the async ones, so they may overlap.
+  ExecutionController executions;
 };
 
 /**
@@ -0,0 +1,301 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#include "NativeKVStoreBinding.h"
+
+#include "NativeDatabaseBinding.h"
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+namespace {
+
+std::string quoteIdentifier(const std::string &identifier) {
+  std::string result("\"");
+  for (char c : identifier) {
+    if (c == '"') {
+      result += '"';
+    }
+    result += c;
+  }
+  result += '"';
+  return result;
+}
+
+} // namespace
+
+// static
+void NativeKVStoreBinding::registerNatives() {
+  registerHybrid({
+      makeNativeMethod("initHybrid", NativeKVStoreBinding::initHybrid),
+      makeNativeMethod("getItem", NativeKVStoreBinding::getItem),
+      makeNativeMethod("multiGet", NativeKVStoreBinding::multiGet),
+      makeNativeMethod("setItem", NativeKVStoreBinding::setItem),
+      makeNativeMethod("multiSet", NativeKVStoreBinding::multiSet),
+      makeNativeMethod("removeItem", NativeKVStoreBinding::removeItem),
+      makeNativeMethod("multiRemove", NativeKVStoreBinding::multiRemove),
+      makeNativeMethod("getAllKeys", NativeKVStoreBinding::getAllKeys),
+      makeNativeMethod("clear", NativeKVStoreBinding::clear),
+      makeNativeMethod("hasPendingWrites",
+                       NativeKVStoreBinding::hasPendingWrites),
+      makeNativeMethod("flush", NativeKVStoreBinding::flush),
+      makeNativeMethod("closeKVStore", NativeKVStoreBinding::closeKVStore),
+  });
+}
+
+jni::local_ref<jni::JString>
+NativeKVStoreBinding::getItem(const std::string &key) {
+  std::lock_guard<std::mutex> lock(mutex);
+  ensureLoaded();
+  auto it = entries.find(key);
+  if (it == entries.end()) {
+    return nullptr;
+  }
+  return jni::make_jstring(it->second);
+}
+
+jni::local_ref<NativeKVStoreBinding::JStringArray>
+NativeKVStoreBinding::multiGet(jni::alias_ref<JStringArray> keys) {
+  size_t size = keys->size();
+  auto values = JStringArray::newArray(size);
+  std::lock_guard<std::mutex> lock(mutex);
+  ensureLoaded();
+  for (size_t i = 0; i < size; ++i) {
+    auto it = entries.find(keys->getElement(i)->toStdString());
+    if (it != entries.end()) {
+      (*values)[i] = jni::make_jstring(it->second);
+    }
+  }
+  return values;
+}
+
+void NativeKVStoreBinding::setItem(const std::string &key,
+                                   const std::string &value) {
+  std::lock_guard<std::mutex> lock(mutex);
+  ensureLoaded();
+  entries.insert_or_assign(key, value);
+  dirtyKeys.insert(key);
+}
+
+void NativeKVStoreBinding::multiSet(jni::alias_ref<JStringArray> keys,
+                                    jni::alias_ref<JStringArray> values) {
+  size_t size = keys->size();
+  if (values->size() != size) {
+    jni::throwNewJavaException(
+        SQLiteErrorException::create("Keys and values must have the same size")
+            .get());
+  }
+  std::lock_guard<std::mutex> lock(mutex);
+  ensureLoaded();
+  for (size_t i = 0; i < size; ++i) {
+    std::string key = keys->getElement(i)->toStdString();
+    entries.insert_or_assign(key, values->getElement(i)->toStdString());
+    dirtyKeys.insert(std::move(key));
+  }
+}
+
+bool NativeKVStoreBinding::removeItem(const std::string &key) {
+  std::lock_guard<std::mutex> lock(mutex);
+  ensureLoaded();
+  if (entries.erase(key) == 0) {
+    return false;
+  }
+  dirtyKeys.insert(key);
+  return true;
+}
+
+void NativeKVStoreBinding::multiRemove(jni::alias_ref<JStringArray> keys) {
+  size_t size = keys->size();
+  std::lock_guard<std::mutex> lock(mutex);
+  ensureLoaded();
+  for (size_t i = 0; i < size; ++i) {
+    std::string key = keys->getElement(i)->toStdString();
+    if (entries.erase(key) > 0) {
+      dirtyKeys.insert(std::move(key));
+    }
+  }
+}
+
+jni::local_ref<NativeKVStoreBinding::JStringArray>
+NativeKVStoreBinding::getAllKeys() {
+  std::lock_guard<std::mutex> lock(mutex);
+  ensureLoaded();
+  auto keys = JStringArray::newArray(entries.size());
+  size_t index = 0;
+  for (const auto &entry : entries) {
+    (*keys)[index++] = jni::make_jstring(entry.first);
+  }
+  return keys;
+}
+
+bool NativeKVStoreBinding::clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  ensureLoaded();
+  bool hadEntries = !entries.empty();
+  entries.clear();
+  dirtyKeys.clear();
+  cleared = true;
+  return hadEntries;
+}
+
+bool NativeKVStoreBinding::hasPendingWrites() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return cleared || !dirtyKeys.empty();
+}
+
+int NativeKVStoreBinding::flush() {
+  std::lock_guard<std::mutex> flushLock(flushMutex);
+  if (db == nullptr) {
+    return SQLITE_MISUSE;
+  }
+  bool shouldClear;
+  std::vector<std::pair<std::string, std::optional<std::string>>> writes;
+  {
+    // Only snapshot the pending writes under the lock, so that reads from the
+    // JS thread are not blocked by the disk I/O below.
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!cleared && dirtyKeys.empty()) {
+      return SQLITE_OK;
+    }
+    shouldClear = cleared;
+    writes.reserve(dirtyKeys.size());
+    for (const auto &key : dirtyKeys) {
+      auto it = entries.find(key);
+      if (it != entries.end()) {
+        writes.emplace_back(key, it->second);
+      } else {
+        writes.emplace_back(key, std::nullopt);
+      }
+    }
+    dirtyKeys.clear();
+    cleared = false;
+  }
+
+  int ret = writeBatch(shouldClear, writes);
+  if (ret != SQLITE_OK) {
+    // Marks the keys dirty again. The in-memory values are still the latest
+    // ones, so the next flush picks up whatever changed in the meantime.
+    std::lock_guard<std::mutex> lock(mutex);
+    cleared = cleared || shouldClear;
+    for (auto &write : writes) {
+      dirtyKeys.insert(std::move(write.first));
+    }
+  }
+  return ret;
+}
+
+int NativeKVStoreBinding::closeKVStore() {
+  std::lock_guard<std::mutex> flushLock(flushMutex);
+  int ret = ::exsqlite3_finalize(upsertStmt);
+  int deleteRet = ::exsqlite3_finalize(deleteStmt);
+  upsertStmt = nullptr;
+  deleteStmt = nullptr;
+  db = nullptr;
+  return ret != SQLITE_OK ? ret : deleteRet;
+}
+
+int NativeKVStoreBinding::open(sqlite3 *db, const std::string &tableName) {
+  this->db = db;
+  this->tableName = quoteIdentifier(tableName);
+  std::string upsertSql = "INSERT INTO " + this->tableName +
+                          " (key, value) VALUES (?, ?) ON CONFLICT(key) DO "
+                          "UPDATE SET value = excluded.value;";
+  int ret = ::exsqlite3_prepare_v2(db, upsertSql.c_str(), -1, &upsertStmt,
+                                 nullptr);
+  if (ret != SQLITE_OK) {
+    return ret;
+  }
+  std::string deleteSql = "DELETE FROM " + this->tableName + " WHERE key = ?;";
+  return ::exsqlite3_prepare_v2(db, deleteSql.c_str(), -1, &deleteStmt,
+                              nullptr);
+}
+
+void NativeKVStoreBinding::ensureLoaded() {
+  if (loaded) {
+    return;
+  }
+  if (db == nullptr) {
+    jni::throwNewJavaException(
+        SQLiteErrorException::create("The key-value store is not open").get());
+  }
+  std::string selectSql = "SELECT key, value FROM " + tableName + ";";
+  exsqlite3_stmt *stmt = nullptr;
+  int ret = ::exsqlite3_prepare_v2(db, selectSql.c_str(), -1, &stmt, nullptr);
+  if (ret != SQLITE_OK) {
+    throwSQLiteError(ret);
+  }
+  std::unordered_map<std::string, std::string> loadedEntries;
+  while ((ret = ::exsqlite3_step(stmt)) == SQLITE_ROW) {
+    if (::exsqlite3_column_type(stmt, 1) == SQLITE_NULL) {
+      continue;
+    }
+    auto key = reinterpret_cast<const char *>(::exsqlite3_column_text(stmt, 0));
+    int keyLength = ::exsqlite3_column_bytes(stmt, 0);
+    auto value =
+        reinterpret_cast<const char *>(::exsqlite3_column_text(stmt, 1));
+    int valueLength = ::exsqlite3_column_bytes(stmt, 1);
+    loadedEntries.emplace(std::string(key, keyLength),
+                          std::string(value, valueLength));
+  }
+  ::exsqlite3_finalize(stmt);
+  if (ret != SQLITE_DONE) {
+    throwSQLiteError(ret);
+  }
+  entries = std::move(loadedEntries);
+  loaded = true;
+}
+
+int NativeKVStoreBinding::writeBatch(
+    bool shouldClear,
+    const std::vector<std::pair<std::string, std::optional<std::string>>>
+        &writes) {
+  int ret = ::exsqlite3_exec(db, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr);
+  if (ret != SQLITE_OK) {
+    return ret;
+  }
+  if (shouldClear) {
+    std::string clearSql = "DELETE FROM " + tableName + ";";
+    ret = ::exsqlite3_exec(db, clearSql.c_str(), nullptr, nullptr, nullptr);
+  }
+  for (auto it = writes.begin(); ret == SQLITE_OK && it != writes.end(); ++it) {
+    const auto &[key, value] = *it;
+    exsqlite3_stmt *stmt = value.has_value() ? upsertStmt : deleteStmt;
+    ::exsqlite3_bind_text(stmt, 1, key.data(), static_cast<int>(key.size()),
+                        SQLITE_STATIC);
+    if (value.has_value()) {
+      ::exsqlite3_bind_text(stmt, 2, value->data(),
+                          static_cast<int>(value->size()), SQLITE_STATIC);
+    }
+    ret = ::exsqlite3_step(stmt);
+    if (ret == SQLITE_DONE) {
+      ret = SQLITE_OK;
+    }
+    ::exsqlite3_reset(stmt);
+    ::exsqlite3_clear_bindings(stmt);
+  }
+  if (ret != SQLITE_OK) {
+    ::exsqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
+    return ret;
+  }
+  ret = ::exsqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
+  if (ret != SQLITE_OK) {
+    ::exsqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
+  }
+  return ret;
+}
+
+void NativeKVStoreBinding::throwSQLiteError(int code) {
+  std::string message("Error code ");
+  message += std::to_string(code);
+  message += ": ";
+  message += ::exsqlite3_errmsg(db);
+  jni::throwNewJavaException(SQLiteErrorException::create(message).get());
+}
+
+// static
+jni::local_ref<NativeKVStoreBinding::jhybriddata>
+NativeKVStoreBinding::initHybrid(jni::alias_ref<jhybridobject> jThis) {
+  return makeCxxInstance(jThis);
+}
+
+} // namespace expo
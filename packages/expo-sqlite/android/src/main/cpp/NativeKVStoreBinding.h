@@ -0,0 +1,90 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "sqlite3.h"
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+class NativeDatabaseBinding;
+
+/**
+ * A write-back key-value engine on top of a `(key TEXT PRIMARY KEY, value TEXT)` table.
+ * The table is loaded into memory on first access, reads are served from memory,
+ * and writes are coalesced per key until `flush()` commits them in a single transaction.
+ */
+class NativeKVStoreBinding : public jni::HybridClass<NativeKVStoreBinding> {
+public:
+  static constexpr auto kJavaDescriptor =
+      "Lexpo/modules/sqlite/NativeKVStoreBinding;";
+
+  using JStringArray = jni::JArrayClass<jni::JString>;
+
+  static void registerNatives();
+
+  jni::local_ref<jni::JString> getItem(const std::string &key);
+  jni::local_ref<JStringArray> multiGet(jni::alias_ref<JStringArray> keys);
+  void setItem(const std::string &key, const std::string &value);
+  void multiSet(jni::alias_ref<JStringArray> keys,
+                jni::alias_ref<JStringArray> values);
+  bool removeItem(const std::string &key);
+  void multiRemove(jni::alias_ref<JStringArray> keys);
+  jni::local_ref<JStringArray> getAllKeys();
+  bool clear();
+  bool hasPendingWrites();
+  int flush();
+  int closeKVStore();
+
+private:
+  explicit NativeKVStoreBinding(
+      jni::alias_ref<NativeKVStoreBinding::jhybridobject> jThis) {}
+
+  int open(sqlite3 *db, const std::string &tableName);
+
+  // Loads the table into memory if needed. The caller must hold `mutex`.
+  void ensureLoaded();
+  int writeBatch(
+      bool shouldClear,
+      const std::vector<std::pair<std::string, std::optional<std::string>>>
+          &writes);
+  void throwSQLiteError(int code);
+
+private:
+  static jni::local_ref<jhybriddata>
+  initHybrid(jni::alias_ref<jhybridobject> jThis);
+
+private:
+  friend HybridBase;
+  friend NativeDatabaseBinding;
+
+  sqlite3 *db = nullptr;
+  std::string tableName;
+  exsqlite3_stmt *upsertStmt = nullptr;
+  exsqlite3_stmt *deleteStmt = nullptr;
+
+  // Guards the in-memory state below.
+  std::mutex mutex;
+  // Serializes flushes so that batches are committed in order, and guards the
+  // statements from being finalized during a flush.
+  std::mutex flushMutex;
+
+  bool loaded = false;
+  bool cleared = false;
+  std::unordered_map<std::string, std::string> entries;
+  // Keys changed since the last flush. A dirty key missing from `entries` is
+  // a pending delete.
+  std::unordered_set<std::string> dirtyKeys;
+};
+
+} // namespace expo
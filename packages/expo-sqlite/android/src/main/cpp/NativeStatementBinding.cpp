@@ -4,6 +4,8 @@
 
 #include <android/log.h>
 
+#include "SQLiteOperations.h"
+
 namespace jni = facebook::jni;
 
 namespace expo {
@@ -12,14 +14,52 @@ namespace {
 
 constexpr char TAG[] = "expo-sqlite";
 
+// Boxes the column values the way the Kotlin side expects them.
+struct JavaColumnValue {
+  jni::local_ref<jni::JObject> operator()(int64_t value) const {
+    return jni::JLong::valueOf(value);
+  }
+  jni::local_ref<jni::JObject> operator()(double value) const {
+    return jni::JDouble::valueOf(value);
+  }
+  jni::local_ref<jni::JObject> operator()(std::string_view text) const {
+    return jni::make_jstring(std::string(text));
+  }
+  jni::local_ref<jni::JObject> operator()(ColumnBlob blob) const {
+    auto byteArray = jni::JArrayByte::newArray(blob.size);
+    byteArray->setRegion(0, blob.size,
+                         static_cast<const signed char *>(blob.data));
+    return byteArray;
+  }
+  jni::local_ref<jni::JObject> operator()(std::nullptr_t) const {
+    return nullptr;
+  }
+  jni::local_ref<jni::JObject> operator()(UnsupportedColumnType column) const {
+    std::string errorMessage =
+        "Unsupported parameter type: " + std::to_string(column.type);
+    jni::throwNewJavaException(
+        InvalidConvertibleException::create(errorMessage).get());
+  }
+};
+
 } // namespace
 
 // static
 void NativeStatementBinding::registerNatives() {
   registerHybrid({
       makeNativeMethod("initHybrid", NativeStatementBinding::initHybrid),
+      makeNativeMethod("sqlite3_bind_blob",
+                       NativeStatementBinding::sqlite3_bind_blob),
+      makeNativeMethod("sqlite3_bind_double",
+                       NativeStatementBinding::sqlite3_bind_double),
+      makeNativeMethod("sqlite3_bind_int64",
+                       NativeStatementBinding::sqlite3_bind_int64),
+      makeNativeMethod("sqlite3_bind_null",
+                       NativeStatementBinding::sqlite3_bind_null),
       makeNativeMethod("sqlite3_bind_parameter_index",
                        NativeStatementBinding::sqlite3_bind_parameter_index),
+      makeNativeMethod("sqlite3_bind_text",
+                       NativeStatementBinding::sqlite3_bind_text),
       makeNativeMethod("sqlite3_clear_bindings",
                        NativeStatementBinding::sqlite3_clear_bindings),
       makeNativeMethod("sqlite3_column_count",
@@ -30,8 +70,8 @@ void NativeStatementBinding::registerNatives() {
                        NativeStatementBinding::sqlite3_finalize),
       makeNativeMethod("sqlite3_reset", NativeStatementBinding::sqlite3_reset),
       makeNativeMethod("sqlite3_step", NativeStatementBinding::sqlite3_step),
-      makeNativeMethod("bindStatementParam",
-                       NativeStatementBinding::bindStatementParam),
+      makeNativeMethod("getBindParameterNames",
+                       NativeStatementBinding::getBindParameterNames),
       makeNativeMethod("getColumnNames",
                        NativeStatementBinding::getColumnNames),
       makeNativeMethod("getColumnValues",
@@ -39,11 +79,38 @@ void NativeStatementBinding::registerNatives() {
   });
 }
 
+int NativeStatementBinding::sqlite3_bind_blob(
+    int index, jni::alias_ref<jni::JArrayByte> value) {
+  // Binding is short and does not call back into Java, so a critical pin
+  // avoids copying the array before sqlite takes its own copy.
+  auto region = value->pinCritical();
+  int ret = bindBlob(stmt, index, region.get(), region.size());
+  region.abort();
+  return ret;
+}
+
+int NativeStatementBinding::sqlite3_bind_double(int index, double value) {
+  return ::exsqlite3_bind_double(stmt, index, value);
+}
+
+int NativeStatementBinding::sqlite3_bind_int64(int index, int64_t value) {
+  return ::exsqlite3_bind_int64(stmt, index, value);
+}
+
+int NativeStatementBinding::sqlite3_bind_null(int index) {
+  return ::exsqlite3_bind_null(stmt, index);
+}
+
 int NativeStatementBinding::sqlite3_bind_parameter_index(
     const std::string &name) {
   return ::exsqlite3_bind_parameter_index(stmt, name.c_str());
 }
 
+int NativeStatementBinding::sqlite3_bind_text(int index,
+                                              const std::string &value) {
+  return bindText(stmt, index, value);
+}
+
 int NativeStatementBinding::sqlite3_clear_bindings() {
   return ::exsqlite3_clear_bindings(stmt);
 }
@@ -62,42 +129,22 @@ int NativeStatementBinding::sqlite3_finalize() {
 
 int NativeStatementBinding::sqlite3_reset() { return ::exsqlite3_reset(stmt); }
 
-int NativeStatementBinding::sqlite3_step() { return ::exsqlite3_step(stmt); }
-
-int NativeStatementBinding::bindStatementParam(
-    int index, jni::alias_ref<jni::JObject> param) {
-  int ret = -1;
-  if (param == nullptr) {
-    ret = exsqlite3_bind_null(stmt, index);
-  } else if (param->isInstanceOf(jni::JInteger::javaClassStatic())) {
-    ret = exsqlite3_bind_int(stmt, index,
-                           jni::static_ref_cast<jni::JInteger>(param)->value());
-  } else if (param->isInstanceOf(jni::JLong::javaClassStatic())) {
-    ret = exsqlite3_bind_int64(stmt, index,
-                             jni::static_ref_cast<jni::JLong>(param)->value());
-  } else if (param->isInstanceOf(jni::JDouble::javaClassStatic())) {
-    ret = exsqlite3_bind_double(
-        stmt, index, jni::static_ref_cast<jni::JDouble>(param)->value());
-  } else if (param->isInstanceOf(jni::JBoolean::javaClassStatic())) {
-    ret = exsqlite3_bind_int(
-        stmt, index,
-        jni::static_ref_cast<jni::JBoolean>(param)->value() ? 1 : 0);
-  } else if (param->isInstanceOf(jni::JArrayByte::javaClassStatic())) {
-    auto byteArray = jni::static_ref_cast<jni::JArrayByte>(param);
-    auto data = byteArray->getRegion(0, byteArray->size());
-    ret = exsqlite3_bind_blob(stmt, index, data.get(), byteArray->size(),
-                            SQLITE_TRANSIENT);
-  } else {
-    std::string stringArg;
-    if (param->isInstanceOf(jni::JString::javaClassStatic())) {
-      stringArg = jni::static_ref_cast<jni::JString>(param)->toStdString();
+int NativeStatementBinding::sqlite3_step() { return execution.step(stmt); }
+
+jni::local_ref<jni::JArrayList<jni::JString>>
+NativeStatementBinding::getBindParameterNames() {
+  int parameterCount = ::exsqlite3_bind_parameter_count(stmt);
+  auto parameterNames = jni::JArrayList<jni::JString>::create(parameterCount);
+  for (int i = 1; i <= parameterCount; ++i) {
+    const char *name = ::exsqlite3_bind_parameter_name(stmt, i);
+    if (name) {
+      parameterNames->add(jni::make_jstring(name));
     } else {
-      stringArg = param->toString();
+      // Anonymous `?` parameters have no names.
+      parameterNames->add(nullptr);
     }
-    ret = exsqlite3_bind_text(stmt, index, stringArg.c_str(), stringArg.length(),
-                            SQLITE_TRANSIENT);
   }
-  return ret;
+  return parameterNames;
 }
 
 jni::local_ref<jni::JArrayList<jni::JString>>
@@ -127,38 +174,7 @@ NativeStatementBinding::initHybrid(jni::alias_ref<jhybridobject> jThis) {
 }
 
 jni::local_ref<jni::JObject> NativeStatementBinding::getColumnValue(int index) {
-  int type = ::exsqlite3_column_type(stmt, index);
-  switch (type) {
-  case SQLITE_INTEGER: {
-    return jni::JLong::valueOf(exsqlite3_column_int64(stmt, index));
-  }
-  case SQLITE_FLOAT: {
-    return jni::JDouble::valueOf(exsqlite3_column_double(stmt, index));
-  }
-  case SQLITE_TEXT: {
-    std::string text(
-        reinterpret_cast<const char *>(exsqlite3_column_text(stmt, index)),
-        static_cast<size_t>(exsqlite3_column_bytes(stmt, index)));
-    return jni::make_jstring(text);
-  }
-  case SQLITE_BLOB: {
-    size_t length = static_cast<size_t>(exsqlite3_column_bytes(stmt, index));
-    auto byteArray = jni::JArrayByte::newArray(length);
-    byteArray->setRegion(
-        0, length,
-        static_cast<const signed char *>(exsqlite3_column_blob(stmt, index)));
-    return byteArray;
-  }
-  case SQLITE_NULL: {
-    return nullptr;
-  }
-  default: {
-    std::string errorMessage =
-        "Unsupported parameter type: " + std::to_string(type);
-    jni::throwNewJavaException(
-        InvalidConvertibleException::create(errorMessage).get());
-  }
-  }
+  return visitColumnValue(stmt, index, JavaColumnValue());
 }
 
 } // namespace expo
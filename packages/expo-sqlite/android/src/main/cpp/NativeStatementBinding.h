@@ -5,6 +5,7 @@
 #include <fbjni/fbjni.h>
 #include <string>
 
+#include "SQLiteExecution.h"
 #include "sqlite3.h"
 
 namespace jni = facebook::jni;
@@ -21,7 +22,12 @@ public:
   static void registerNatives();
 
   // sqlite3 bindings
+  int sqlite3_bind_blob(int index, jni::alias_ref<jni::JArrayByte> value);
+  int sqlite3_bind_double(int index, double value);
+  int sqlite3_bind_int64(int index, int64_t value);
+  int sqlite3_bind_null(int index);
   int sqlite3_bind_parameter_index(const std::string &name);
+  int sqlite3_bind_text(int index, const std::string &value);
   int sqlite3_clear_bindings();
   int sqlite3_column_count();
   std::string sqlite3_column_name(int index);
@@ -30,7 +36,7 @@ public:
   int sqlite3_step();
 
   // helpers
-  int bindStatementParam(int index, jni::alias_ref<jni::JObject> param);
+  jni::local_ref<jni::JArrayList<jni::JString>> getBindParameterNames();
   jni::local_ref<jni::JArrayList<jni::JString>> getColumnNames();
   jni::local_ref<jni::JArrayList<jni::JObject>> getColumnValues();
 
@@ -48,6 +54,7 @@ private:
   friend NativeDatabaseBinding;
 
   exsqlite3_stmt *stmt;
+  StatementExecution execution;
 };
 
 /**
@@ -2,12 +2,18 @@
 
 #include <fbjni/fbjni.h>
 
+#include "NativeBackupBinding.h"
+#include "NativeBlobBinding.h"
 #include "NativeDatabaseBinding.h"
+#include "NativeKVStoreBinding.h"
 #include "NativeStatementBinding.h"
 
 JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *) {
   return facebook::jni::initialize(vm, [] {
+    expo::NativeBackupBinding::registerNatives();
+    expo::NativeBlobBinding::registerNatives();
     expo::NativeDatabaseBinding::registerNatives();
+    expo::NativeKVStoreBinding::registerNatives();
     expo::NativeStatementBinding::registerNatives();
   });
 }
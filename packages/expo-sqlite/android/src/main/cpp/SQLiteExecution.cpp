@@ -0,0 +1,87 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#include "SQLiteExecution.h"
+
+#include <chrono>
+#include <cmath>
+
+namespace expo {
+
+namespace {
+
+// The number of virtual machine instructions between two interruption checks.
+constexpr int kProgressHandlerInstructions = 1000;
+
+// The execution of the statement stepping on the current thread. The progress
+// handler runs within the step, on the same thread.
+thread_local StatementExecution *steppingExecution = nullptr;
+
+int64_t nowNanoseconds() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+} // namespace
+
+int StatementExecution::step(exsqlite3_stmt *stmt) {
+  // Restores the previous execution, in case a step is nested in another one,
+  // e.g. through a user-defined function.
+  StatementExecution *previous = steppingExecution;
+  steppingExecution = this;
+  int ret = ::exsqlite3_step(stmt);
+  steppingExecution = previous;
+  return ret;
+}
+
+void ExecutionController::begin(sqlite3 *db, StatementExecution &execution,
+                                double timeoutMs) {
+  int64_t deadline = 0;
+  if (timeoutMs > 0) {
+    deadline = nowNanoseconds() +
+               static_cast<int64_t>(std::ceil(timeoutMs * 1000)) * 1000;
+  }
+  std::lock_guard<std::mutex> lock(mutex);
+  execution.isExecuting = true;
+  execution.interruptRequested = false;
+  execution.deadline = deadline;
+  if (activeExecutions++ == 0) {
+    ::exsqlite3_progress_handler(db, kProgressHandlerInstructions, onProgress,
+                                 nullptr);
+  }
+}
+
+void ExecutionController::end(sqlite3 *db, StatementExecution &execution) {
+  std::lock_guard<std::mutex> lock(mutex);
+  execution.isExecuting = false;
+  execution.deadline = 0;
+  if (--activeExecutions == 0) {
+    ::exsqlite3_progress_handler(db, 0, nullptr, nullptr);
+  }
+}
+
+void ExecutionController::interrupt(StatementExecution &execution) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (execution.isExecuting) {
+    execution.interruptRequested = true;
+  }
+}
+
+// static
+int ExecutionController::onProgress(void *arg) {
+  StatementExecution *execution = steppingExecution;
+  if (execution == nullptr) {
+    return 0;
+  }
+  // A non-zero return aborts the statement with SQLITE_INTERRUPT.
+  if (execution->interruptRequested) {
+    return 1;
+  }
+  int64_t deadline = execution->deadline.load();
+  if (deadline == 0) {
+    return 0;
+  }
+  return nowNanoseconds() >= deadline ? 1 : 0;
+}
+
+} // namespace expo
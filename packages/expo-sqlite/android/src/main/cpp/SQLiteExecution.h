@@ -0,0 +1,66 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "sqlite3.h"
+
+namespace expo {
+
+class ExecutionController;
+
+/**
+ * The execution state of one statement. Statements of one connection may
+ * execute at the same time, e.g. a sync one on the JS thread during an async
+ * one on the module queue, so each keeps its own deadline and interrupt flag.
+ */
+class StatementExecution {
+public:
+  // Steps the statement, so that the progress handler of its connection can
+  // find the execution it belongs to.
+  int step(exsqlite3_stmt *stmt);
+
+private:
+  friend ExecutionController;
+
+  // Guarded by the `mutex` of the `ExecutionController`.
+  bool isExecuting = false;
+  // Read by the progress handler without locking.
+  std::atomic<bool> interruptRequested{false};
+  // The deadline in nanoseconds of the steady clock, or 0 if the execution has
+  // no timeout. Read by the progress handler without locking.
+  std::atomic<int64_t> deadline{0};
+};
+
+/**
+ * Interrupts and times out the executions of one connection.
+ *
+ * A progress handler is installed while any execution is active. It aborts the
+ * statement stepping on the calling thread with `SQLITE_INTERRUPT` once that
+ * statement is interrupted or past its deadline, so the other executions are
+ * not affected. `sqlite3_interrupt` is not used, because it would abort all
+ * statements of the connection.
+ */
+class ExecutionController {
+public:
+  // `timeoutMs` of 0 or less means no timeout.
+  void begin(sqlite3 *db, StatementExecution &execution, double timeoutMs);
+  void end(sqlite3 *db, StatementExecution &execution);
+  // Does nothing if the execution is not running, a statement that is not
+  // running yet is rejected before it starts.
+  void interrupt(StatementExecution &execution);
+
+private:
+  static int onProgress(void *arg);
+
+  // Guards `activeExecutions` and the `isExecuting` flags of the executions,
+  // so that an interrupt never reaches an execution that already ended, and
+  // the progress handler stays installed until the last execution ends.
+  std::mutex mutex;
+  int activeExecutions = 0;
+};
+
+} // namespace expo
@@ -0,0 +1,39 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#include "SQLiteOperations.h"
+
+#include "SQLiteVector.h"
+
+namespace expo {
+
+int openDatabase(const std::string &path, sqlite3 **db) {
+  int ret = ::exsqlite3_open(path.c_str(), db);
+  if (ret != SQLITE_OK) {
+    return ret;
+  }
+  ret = registerVectorFunctions(*db);
+  if (ret != SQLITE_OK) {
+    // The connection is unusable without the functions, do not leak it.
+    ::exsqlite3_close(*db);
+    *db = nullptr;
+  }
+  return ret;
+}
+
+int prepareStatement(sqlite3 *db, const std::string &source,
+                     exsqlite3_stmt **stmt) {
+  return ::exsqlite3_prepare_v2(db, source.c_str(), source.size(), stmt,
+                                nullptr);
+}
+
+int bindBlob(exsqlite3_stmt *stmt, int index, const void *data, size_t size) {
+  return ::exsqlite3_bind_blob(stmt, index, data, static_cast<int>(size),
+                               SQLITE_TRANSIENT);
+}
+
+int bindText(exsqlite3_stmt *stmt, int index, const std::string &value) {
+  return ::exsqlite3_bind_text(stmt, index, value.c_str(), value.length(),
+                               SQLITE_TRANSIENT);
+}
+
+} // namespace expo
@@ -0,0 +1,80 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "sqlite3.h"
+
+namespace expo {
+
+/**
+ * The sqlite call sequences shared by the JNI bindings and the host
+ * benchmark. They have no JNI dependency, so that the benchmark measures the
+ * same calls as the shipped bindings.
+ */
+
+// Opens the connection and registers the vector functions. If the functions
+// cannot be registered, the connection is closed and `*db` is reset to null.
+// If opening fails, `*db` is kept so that its error message can be read.
+int openDatabase(const std::string &path, sqlite3 **db);
+
+int prepareStatement(sqlite3 *db, const std::string &source,
+                     exsqlite3_stmt **stmt);
+
+// sqlite takes its own copy of the bound values.
+int bindBlob(exsqlite3_stmt *stmt, int index, const void *data, size_t size);
+int bindText(exsqlite3_stmt *stmt, int index, const std::string &value);
+
+// The bytes of a blob column, valid until the statement is stepped, reset or
+// finalized.
+struct ColumnBlob {
+  const void *data;
+  size_t size;
+};
+
+struct UnsupportedColumnType {
+  int type;
+};
+
+// Calls `visitor` with the value of a column of the current row: an `int64_t`,
+// a `double`, a `std::string_view` over the text, a `ColumnBlob`, `nullptr` or
+// an `UnsupportedColumnType`. The text and blob views are valid until the
+// statement is stepped, reset or finalized.
+template <typename Visitor>
+decltype(auto) visitColumnValue(exsqlite3_stmt *stmt, int index,
+                                Visitor &&visitor) {
+  int type = ::exsqlite3_column_type(stmt, index);
+  switch (type) {
+  case SQLITE_INTEGER: {
+    return visitor(static_cast<int64_t>(::exsqlite3_column_int64(stmt, index)));
+  }
+  case SQLITE_FLOAT: {
+    return visitor(::exsqlite3_column_double(stmt, index));
+  }
+  case SQLITE_TEXT: {
+    // The pointer is read before the size, so that the size is the one of the
+    // UTF-8 text.
+    auto text =
+        reinterpret_cast<const char *>(::exsqlite3_column_text(stmt, index));
+    return visitor(std::string_view(
+        text, static_cast<size_t>(::exsqlite3_column_bytes(stmt, index))));
+  }
+  case SQLITE_BLOB: {
+    const void *data = ::exsqlite3_column_blob(stmt, index);
+    return visitor(ColumnBlob{
+        data, static_cast<size_t>(::exsqlite3_column_bytes(stmt, index))});
+  }
+  case SQLITE_NULL: {
+    return visitor(nullptr);
+  }
+  default: {
+    return visitor(UnsupportedColumnType{type});
+  }
+  }
+}
+
+} // namespace expo
@@ -0,0 +1,127 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#include "SQLiteProfiler.h"
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+namespace {
+
+constexpr double kNanosecondsPerMillisecond = 1000000.0;
+
+} // namespace
+
+SQLiteProfiler::SQLiteProfiler(int64_t slowQueryThresholdNs,
+                               size_t slowQueryLogSize)
+    : slowQueryThresholdNs(slowQueryThresholdNs),
+      slowQueryLogSize(slowQueryLogSize) {
+  slowQueries.reserve(slowQueryLogSize);
+}
+
+void SQLiteProfiler::onProfile(exsqlite3_stmt *stmt, int64_t durationNs) {
+  // The counters are reset on every execution, so they only cover the
+  // statement run that has just finished.
+  int fullscanSteps =
+      ::exsqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_FULLSCAN_STEP, 1);
+  int sorts = ::exsqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_SORT, 1);
+  int autoindexes =
+      ::exsqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_AUTOINDEX, 1);
+  int vmSteps = ::exsqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_VM_STEP, 1);
+
+  const char *sql = ::exsqlite3_sql(stmt);
+  if (!sql) {
+    return;
+  }
+
+  std::string expandedSql;
+  bool isSlow = slowQueryLogSize > 0 && durationNs >= slowQueryThresholdNs;
+  if (isSlow) {
+    // Expands the bound parameters outside of the lock.
+    char *expanded = ::exsqlite3_expanded_sql(stmt);
+    expandedSql = expanded ? expanded : sql;
+    ::exsqlite3_free(expanded);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto it = statementProfiles.find(sql);
+  if (it == statementProfiles.end() &&
+      statementProfiles.size() < kMaxStatementProfiles) {
+    it = statementProfiles.emplace(sql, StatementProfile()).first;
+  }
+  if (it != statementProfiles.end()) {
+    StatementProfile &profile = it->second;
+    ++profile.count;
+    profile.totalDurationNs += durationNs;
+    ++profile.histogram[getHistogramBucket(durationNs)];
+  }
+
+  if (isSlow) {
+    SlowQuery slowQuery{std::move(expandedSql), durationNs, fullscanSteps,
+                        sorts, autoindexes, vmSteps};
+    if (slowQueries.size() < slowQueryLogSize) {
+      slowQueries.push_back(std::move(slowQuery));
+    } else {
+      slowQueries[nextSlowQueryIndex] = std::move(slowQuery);
+    }
+    nextSlowQueryIndex = (nextSlowQueryIndex + 1) % slowQueryLogSize;
+  }
+}
+
+jni::local_ref<jni::JArrayList<JSlowQuery>>
+SQLiteProfiler::getSlowQueries() {
+  std::lock_guard<std::mutex> lock(mutex);
+  size_t size = slowQueries.size();
+  auto result = jni::JArrayList<JSlowQuery>::create(size);
+  // Returns the entries from the oldest to the newest.
+  size_t start = size < slowQueryLogSize ? 0 : nextSlowQueryIndex;
+  for (size_t i = 0; i < size; ++i) {
+    const SlowQuery &slowQuery = slowQueries[(start + i) % size];
+    result->add(JSlowQuery::newInstance(
+        jni::make_jstring(slowQuery.sql),
+        static_cast<jdouble>(slowQuery.durationNs / kNanosecondsPerMillisecond),
+        static_cast<jint>(slowQuery.fullscanSteps),
+        static_cast<jint>(slowQuery.sorts),
+        static_cast<jint>(slowQuery.autoindexes),
+        static_cast<jint>(slowQuery.vmSteps)));
+  }
+  return result;
+}
+
+jni::local_ref<jni::JArrayList<JStatementProfile>>
+SQLiteProfiler::getStatementProfiles() {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto result = jni::JArrayList<JStatementProfile>::create(
+      statementProfiles.size());
+  for (const auto &[sql, profile] : statementProfiles) {
+    auto histogram = jni::JArrayInt::newArray(kHistogramBuckets);
+    histogram->setRegion(0, kHistogramBuckets, profile.histogram.data());
+    result->add(JStatementProfile::newInstance(
+        jni::make_jstring(sql), static_cast<jint>(profile.count),
+        static_cast<jdouble>(profile.totalDurationNs /
+                             kNanosecondsPerMillisecond),
+        histogram));
+  }
+  return result;
+}
+
+void SQLiteProfiler::reset() {
+  std::lock_guard<std::mutex> lock(mutex);
+  slowQueries.clear();
+  nextSlowQueryIndex = 0;
+  statementProfiles.clear();
+}
+
+// static
+size_t SQLiteProfiler::getHistogramBucket(int64_t durationNs) {
+  int64_t durationUs = durationNs / 1000;
+  size_t bucket = 0;
+  while (durationUs > 1 && bucket < kHistogramBuckets - 1) {
+    durationUs >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+} // namespace expo
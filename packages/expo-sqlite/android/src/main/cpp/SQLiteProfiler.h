@@ -0,0 +1,90 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sqlite3.h"
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+/**
+ * A convenient wrapper for the Kotlin SlowQuery record.
+ */
+class JSlowQuery : public jni::JavaClass<JSlowQuery> {
+public:
+  static auto constexpr kJavaDescriptor = "Lexpo/modules/sqlite/SlowQuery;";
+};
+
+/**
+ * A convenient wrapper for the Kotlin StatementProfile record.
+ */
+class JStatementProfile : public jni::JavaClass<JStatementProfile> {
+public:
+  static auto constexpr kJavaDescriptor =
+      "Lexpo/modules/sqlite/StatementProfile;";
+};
+
+/**
+ * Collects statement timings from the `SQLITE_TRACE_PROFILE` trace events.
+ * It keeps a bounded ring of slow statements with their expanded SQL and
+ * `sqlite3_stmt_status` counters, plus a latency histogram per statement.
+ */
+class SQLiteProfiler {
+public:
+  // Bucket `i` counts executions that took [2^i, 2^(i+1)) microseconds.
+  // The first bucket also counts faster executions and the last one slower.
+  static constexpr size_t kHistogramBuckets = 24;
+
+  // Caps the number of distinct statements so that dynamically built SQL does
+  // not grow the table without bounds.
+  static constexpr size_t kMaxStatementProfiles = 512;
+
+  SQLiteProfiler(int64_t slowQueryThresholdNs, size_t slowQueryLogSize);
+
+  // Called from the sqlite trace callback on the thread running the
+  // statement.
+  void onProfile(exsqlite3_stmt *stmt, int64_t durationNs);
+
+  jni::local_ref<jni::JArrayList<JSlowQuery>> getSlowQueries();
+  jni::local_ref<jni::JArrayList<JStatementProfile>>
+  getStatementProfiles();
+  void reset();
+
+private:
+  struct SlowQuery {
+    std::string sql;
+    int64_t durationNs;
+    int fullscanSteps;
+    int sorts;
+    int autoindexes;
+    int vmSteps;
+  };
+
+  struct StatementProfile {
+    int count = 0;
+    int64_t totalDurationNs = 0;
+    std::array<int, kHistogramBuckets> histogram{};
+  };
+
+  static size_t getHistogramBucket(int64_t durationNs);
+
+  const int64_t slowQueryThresholdNs;
+  const size_t slowQueryLogSize;
+
+  std::mutex mutex;
+  std::vector<SlowQuery> slowQueries;
+  // The index in `slowQueries` to overwrite when the ring is full.
+  size_t nextSlowQueryIndex = 0;
+  std::unordered_map<std::string, StatementProfile> statementProfiles;
+};
+
+} // namespace expo
@@ -0,0 +1,540 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#include "SQLiteVector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#define EXPO_SQLITE_VECTOR_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define EXPO_SQLITE_VECTOR_SSE2 1
+#endif
+
+namespace expo {
+
+namespace vector {
+
+namespace {
+
+// The int8 kernels accumulate in 32-bit lanes and flush them into 64-bit sums
+// after every block, so that the lanes can never overflow.
+constexpr size_t kInt8BlockSize = 4096;
+
+#if EXPO_SQLITE_VECTOR_NEON
+inline float horizontalSum(float32x4_t v) {
+#if defined(__aarch64__)
+  return vaddvq_f32(v);
+#else
+  float32x2_t sum = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+  return vget_lane_f32(vpadd_f32(sum, sum), 0);
+#endif
+}
+
+inline int64_t horizontalSum(int32x4_t v) {
+#if defined(__aarch64__)
+  return vaddlvq_s32(v);
+#else
+  int64x2_t sum = vpaddlq_s32(v);
+  return vgetq_lane_s64(sum, 0) + vgetq_lane_s64(sum, 1);
+#endif
+}
+#elif EXPO_SQLITE_VECTOR_SSE2
+inline float horizontalSum(__m128 v) {
+  __m128 shuffled = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+  __m128 sum = _mm_add_ps(v, shuffled);
+  shuffled = _mm_movehl_ps(shuffled, sum);
+  return _mm_cvtss_f32(_mm_add_ss(sum, shuffled));
+}
+
+inline int64_t horizontalSum(__m128i v) {
+  alignas(16) int32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), v);
+  return static_cast<int64_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+}
+
+// Sign-extends the low and high halves of 16 int8 lanes into int16 lanes.
+inline __m128i widenLow(__m128i v) {
+  return _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8);
+}
+
+inline __m128i widenHigh(__m128i v) {
+  return _mm_srai_epi16(_mm_unpackhi_epi8(v, v), 8);
+}
+#endif
+
+} // namespace
+
+float dotFloat32(const float *a, const float *b, size_t size) {
+  size_t i = 0;
+  float sum = 0.0f;
+#if EXPO_SQLITE_VECTOR_NEON
+  float32x4_t acc0 = vdupq_n_f32(0.0f);
+  float32x4_t acc1 = vdupq_n_f32(0.0f);
+  for (; i + 8 <= size; i += 8) {
+    acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+    acc1 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+  }
+  sum = horizontalSum(vaddq_f32(acc0, acc1));
+#elif EXPO_SQLITE_VECTOR_SSE2
+  __m128 acc0 = _mm_setzero_ps();
+  __m128 acc1 = _mm_setzero_ps();
+  for (; i + 8 <= size; i += 8) {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    acc1 = _mm_add_ps(
+        acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+  }
+  sum = horizontalSum(_mm_add_ps(acc0, acc1));
+#endif
+  for (; i < size; ++i) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+float squaredL2Float32(const float *a, const float *b, size_t size) {
+  size_t i = 0;
+  float sum = 0.0f;
+#if EXPO_SQLITE_VECTOR_NEON
+  float32x4_t acc0 = vdupq_n_f32(0.0f);
+  float32x4_t acc1 = vdupq_n_f32(0.0f);
+  for (; i + 8 <= size; i += 8) {
+    float32x4_t diff0 = vsubq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+    float32x4_t diff1 = vsubq_f32(vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    acc0 = vmlaq_f32(acc0, diff0, diff0);
+    acc1 = vmlaq_f32(acc1, diff1, diff1);
+  }
+  sum = horizontalSum(vaddq_f32(acc0, acc1));
+#elif EXPO_SQLITE_VECTOR_SSE2
+  __m128 acc0 = _mm_setzero_ps();
+  __m128 acc1 = _mm_setzero_ps();
+  for (; i + 8 <= size; i += 8) {
+    __m128 diff0 = _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+    __m128 diff1 = _mm_sub_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4));
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(diff0, diff0));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(diff1, diff1));
+  }
+  sum = horizontalSum(_mm_add_ps(acc0, acc1));
+#endif
+  for (; i < size; ++i) {
+    float diff = a[i] - b[i];
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+void cosineTermsFloat32(const float *a, const float *b, size_t size,
+                        float *dot, float *normA, float *normB) {
+  size_t i = 0;
+  float dotSum = 0.0f;
+  float normASum = 0.0f;
+  float normBSum = 0.0f;
+#if EXPO_SQLITE_VECTOR_NEON
+  float32x4_t dotAcc = vdupq_n_f32(0.0f);
+  float32x4_t normAAcc = vdupq_n_f32(0.0f);
+  float32x4_t normBAcc = vdupq_n_f32(0.0f);
+  for (; i + 4 <= size; i += 4) {
+    float32x4_t va = vld1q_f32(a + i);
+    float32x4_t vb = vld1q_f32(b + i);
+    dotAcc = vmlaq_f32(dotAcc, va, vb);
+    normAAcc = vmlaq_f32(normAAcc, va, va);
+    normBAcc = vmlaq_f32(normBAcc, vb, vb);
+  }
+  dotSum = horizontalSum(dotAcc);
+  normASum = horizontalSum(normAAcc);
+  normBSum = horizontalSum(normBAcc);
+#elif EXPO_SQLITE_VECTOR_SSE2
+  __m128 dotAcc = _mm_setzero_ps();
+  __m128 normAAcc = _mm_setzero_ps();
+  __m128 normBAcc = _mm_setzero_ps();
+  for (; i + 4 <= size; i += 4) {
+    __m128 va = _mm_loadu_ps(a + i);
+    __m128 vb = _mm_loadu_ps(b + i);
+    dotAcc = _mm_add_ps(dotAcc, _mm_mul_ps(va, vb));
+    normAAcc = _mm_add_ps(normAAcc, _mm_mul_ps(va, va));
+    normBAcc = _mm_add_ps(normBAcc, _mm_mul_ps(vb, vb));
+  }
+  dotSum = horizontalSum(dotAcc);
+  normASum = horizontalSum(normAAcc);
+  normBSum = horizontalSum(normBAcc);
+#endif
+  for (; i < size; ++i) {
+    dotSum += a[i] * b[i];
+    normASum += a[i] * a[i];
+    normBSum += b[i] * b[i];
+  }
+  *dot = dotSum;
+  *normA = normASum;
+  *normB = normBSum;
+}
+
+int64_t dotInt8(const int8_t *a, const int8_t *b, size_t size) {
+  size_t i = 0;
+  int64_t sum = 0;
+#if EXPO_SQLITE_VECTOR_NEON || EXPO_SQLITE_VECTOR_SSE2
+  while (i + 16 <= size) {
+    size_t blockEnd = std::min(size, i + kInt8BlockSize);
+#if EXPO_SQLITE_VECTOR_NEON
+    int32x4_t acc = vdupq_n_s32(0);
+    for (; i + 16 <= blockEnd; i += 16) {
+      int8x16_t va = vld1q_s8(a + i);
+      int8x16_t vb = vld1q_s8(b + i);
+      acc = vpadalq_s16(acc, vmull_s8(vget_low_s8(va), vget_low_s8(vb)));
+      acc = vpadalq_s16(acc, vmull_s8(vget_high_s8(va), vget_high_s8(vb)));
+    }
+    sum += horizontalSum(acc);
+#elif EXPO_SQLITE_VECTOR_SSE2
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 16 <= blockEnd; i += 16) {
+      __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+      __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(widenLow(va), widenLow(vb)));
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(widenHigh(va), widenHigh(vb)));
+    }
+    sum += horizontalSum(acc);
+#endif
+  }
+#endif
+  for (; i < size; ++i) {
+    sum += static_cast<int32_t>(a[i]) * b[i];
+  }
+  return sum;
+}
+
+int64_t squaredL2Int8(const int8_t *a, const int8_t *b, size_t size) {
+  size_t i = 0;
+  int64_t sum = 0;
+#if EXPO_SQLITE_VECTOR_NEON || EXPO_SQLITE_VECTOR_SSE2
+  while (i + 16 <= size) {
+    size_t blockEnd = std::min(size, i + kInt8BlockSize);
+#if EXPO_SQLITE_VECTOR_NEON
+    int32x4_t acc = vdupq_n_s32(0);
+    for (; i + 16 <= blockEnd; i += 16) {
+      int8x16_t va = vld1q_s8(a + i);
+      int8x16_t vb = vld1q_s8(b + i);
+      int16x8_t diffLow = vsubl_s8(vget_low_s8(va), vget_low_s8(vb));
+      int16x8_t diffHigh = vsubl_s8(vget_high_s8(va), vget_high_s8(vb));
+      acc = vmlal_s16(acc, vget_low_s16(diffLow), vget_low_s16(diffLow));
+      acc = vmlal_s16(acc, vget_high_s16(diffLow), vget_high_s16(diffLow));
+      acc = vmlal_s16(acc, vget_low_s16(diffHigh), vget_low_s16(diffHigh));
+      acc = vmlal_s16(acc, vget_high_s16(diffHigh), vget_high_s16(diffHigh));
+    }
+    sum += horizontalSum(acc);
+#elif EXPO_SQLITE_VECTOR_SSE2
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 16 <= blockEnd; i += 16) {
+      __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+      __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+      __m128i diffLow = _mm_sub_epi16(widenLow(va), widenLow(vb));
+      __m128i diffHigh = _mm_sub_epi16(widenHigh(va), widenHigh(vb));
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(diffLow, diffLow));
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(diffHigh, diffHigh));
+    }
+    sum += horizontalSum(acc);
+#endif
+  }
+#endif
+  for (; i < size; ++i) {
+    int32_t diff = static_cast<int32_t>(a[i]) - b[i];
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+void cosineTermsInt8(const int8_t *a, const int8_t *b, size_t size,
+                     int64_t *dot, int64_t *normA, int64_t *normB) {
+  size_t i = 0;
+  int64_t dotSum = 0;
+  int64_t normASum = 0;
+  int64_t normBSum = 0;
+#if EXPO_SQLITE_VECTOR_NEON || EXPO_SQLITE_VECTOR_SSE2
+  while (i + 16 <= size) {
+    size_t blockEnd = std::min(size, i + kInt8BlockSize);
+#if EXPO_SQLITE_VECTOR_NEON
+    int32x4_t dotAcc = vdupq_n_s32(0);
+    int32x4_t normAAcc = vdupq_n_s32(0);
+    int32x4_t normBAcc = vdupq_n_s32(0);
+    for (; i + 16 <= blockEnd; i += 16) {
+      int8x16_t va = vld1q_s8(a + i);
+      int8x16_t vb = vld1q_s8(b + i);
+      int8x8_t aLow = vget_low_s8(va);
+      int8x8_t aHigh = vget_high_s8(va);
+      int8x8_t bLow = vget_low_s8(vb);
+      int8x8_t bHigh = vget_high_s8(vb);
+      dotAcc = vpadalq_s16(dotAcc, vmull_s8(aLow, bLow));
+      dotAcc = vpadalq_s16(dotAcc, vmull_s8(aHigh, bHigh));
+      normAAcc = vpadalq_s16(normAAcc, vmull_s8(aLow, aLow));
+      normAAcc = vpadalq_s16(normAAcc, vmull_s8(aHigh, aHigh));
+      normBAcc = vpadalq_s16(normBAcc, vmull_s8(bLow, bLow));
+      normBAcc = vpadalq_s16(normBAcc, vmull_s8(bHigh, bHigh));
+    }
+    dotSum += horizontalSum(dotAcc);
+    normASum += horizontalSum(normAAcc);
+    normBSum += horizontalSum(normBAcc);
+#elif EXPO_SQLITE_VECTOR_SSE2
+    __m128i dotAcc = _mm_setzero_si128();
+    __m128i normAAcc = _mm_setzero_si128();
+    __m128i normBAcc = _mm_setzero_si128();
+    for (; i + 16 <= blockEnd; i += 16) {
+      __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+      __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+      __m128i aLow = widenLow(va);
+      __m128i aHigh = widenHigh(va);
+      __m128i bLow = widenLow(vb);
+      __m128i bHigh = widenHigh(vb);
+      dotAcc = _mm_add_epi32(dotAcc, _mm_madd_epi16(aLow, bLow));
+      dotAcc = _mm_add_epi32(dotAcc, _mm_madd_epi16(aHigh, bHigh));
+      normAAcc = _mm_add_epi32(normAAcc, _mm_madd_epi16(aLow, aLow));
+      normAAcc = _mm_add_epi32(normAAcc, _mm_madd_epi16(aHigh, aHigh));
+      normBAcc = _mm_add_epi32(normBAcc, _mm_madd_epi16(bLow, bLow));
+      normBAcc = _mm_add_epi32(normBAcc, _mm_madd_epi16(bHigh, bHigh));
+    }
+    dotSum += horizontalSum(dotAcc);
+    normASum += horizontalSum(normAAcc);
+    normBSum += horizontalSum(normBAcc);
+#endif
+  }
+#endif
+  for (; i < size; ++i) {
+    int32_t va = a[i];
+    int32_t vb = b[i];
+    dotSum += va * vb;
+    normASum += va * va;
+    normBSum += vb * vb;
+  }
+  *dot = dotSum;
+  *normA = normASum;
+  *normB = normBSum;
+}
+
+} // namespace vector
+
+namespace {
+
+enum class ElementType { Float32, Int8 };
+
+enum class Metric { Cosine, L2, Dot };
+
+struct VectorArgs {
+  ElementType type;
+  const void *a;
+  const void *b;
+  size_t size;
+};
+
+// Reads the arguments shared by all the scalar functions. Returns false if a
+// result has already been set, either NULL for NULL inputs or an error.
+bool readVectorArgs(exsqlite3_context *context, int argc,
+                    exsqlite3_value **argv, VectorArgs *args) {
+  args->type = ElementType::Float32;
+  if (argc == 3) {
+    auto type =
+        reinterpret_cast<const char *>(::exsqlite3_value_text(argv[2]));
+    if (type == nullptr || std::strcmp(type, "float32") == 0) {
+      args->type = ElementType::Float32;
+    } else if (std::strcmp(type, "int8") == 0) {
+      args->type = ElementType::Int8;
+    } else {
+      ::exsqlite3_result_error(
+          context, "Vector element type must be 'float32' or 'int8'", -1);
+      return false;
+    }
+  }
+
+  if (::exsqlite3_value_type(argv[0]) == SQLITE_NULL ||
+      ::exsqlite3_value_type(argv[1]) == SQLITE_NULL) {
+    ::exsqlite3_result_null(context);
+    return false;
+  }
+  if (::exsqlite3_value_type(argv[0]) != SQLITE_BLOB ||
+      ::exsqlite3_value_type(argv[1]) != SQLITE_BLOB) {
+    ::exsqlite3_result_error(context, "Vectors must be blobs", -1);
+    return false;
+  }
+
+  args->a = ::exsqlite3_value_blob(argv[0]);
+  args->b = ::exsqlite3_value_blob(argv[1]);
+  int bytesA = ::exsqlite3_value_bytes(argv[0]);
+  int bytesB = ::exsqlite3_value_bytes(argv[1]);
+  if (bytesA != bytesB) {
+    ::exsqlite3_result_error(context, "Vector dimensions do not match", -1);
+    return false;
+  }
+  size_t elementSize = args->type == ElementType::Float32 ? sizeof(float) : 1;
+  if (bytesA % elementSize != 0) {
+    ::exsqlite3_result_error(
+        context, "Blob size is not a multiple of the float32 size", -1);
+    return false;
+  }
+  args->size = bytesA / elementSize;
+  return true;
+}
+
+// Blobs may point into the middle of a database page, so floats are copied
+// to aligned storage when needed.
+const float *alignedFloats(const void *data, size_t size,
+                           std::vector<float> &storage) {
+  if (reinterpret_cast<uintptr_t>(data) % alignof(float) == 0) {
+    return static_cast<const float *>(data);
+  }
+  storage.resize(size);
+  std::memcpy(storage.data(), data, size * sizeof(float));
+  return storage.data();
+}
+
+void setCosineDistance(exsqlite3_context *context, double dot, double normA,
+                       double normB) {
+  if (normA == 0.0 || normB == 0.0) {
+    // The distance is undefined for zero vectors.
+    ::exsqlite3_result_null(context);
+    return;
+  }
+  ::exsqlite3_result_double(context,
+                            1.0 - dot / (std::sqrt(normA) * std::sqrt(normB)));
+}
+
+template <Metric metric>
+void vectorFunction(exsqlite3_context *context, int argc,
+                    exsqlite3_value **argv) {
+  VectorArgs args;
+  if (!readVectorArgs(context, argc, argv, &args)) {
+    return;
+  }
+
+  if (args.type == ElementType::Int8) {
+    auto a = static_cast<const int8_t *>(args.a);
+    auto b = static_cast<const int8_t *>(args.b);
+    if constexpr (metric == Metric::Cosine) {
+      int64_t dot, normA, normB;
+      vector::cosineTermsInt8(a, b, args.size, &dot, &normA, &normB);
+      setCosineDistance(context, static_cast<double>(dot),
+                        static_cast<double>(normA), static_cast<double>(normB));
+    } else if constexpr (metric == Metric::L2) {
+      ::exsqlite3_result_double(
+          context,
+          std::sqrt(static_cast<double>(vector::squaredL2Int8(a, b, args.size))));
+    } else {
+      ::exsqlite3_result_int64(context, vector::dotInt8(a, b, args.size));
+    }
+    return;
+  }
+
+  std::vector<float> storageA;
+  std::vector<float> storageB;
+  const float *a = alignedFloats(args.a, args.size, storageA);
+  const float *b = alignedFloats(args.b, args.size, storageB);
+  if constexpr (metric == Metric::Cosine) {
+    float dot, normA, normB;
+    vector::cosineTermsFloat32(a, b, args.size, &dot, &normA, &normB);
+    setCosineDistance(context, dot, normA, normB);
+  } else if constexpr (metric == Metric::L2) {
+    ::exsqlite3_result_double(
+        context, std::sqrt(vector::squaredL2Float32(a, b, args.size)));
+  } else {
+    ::exsqlite3_result_double(context, vector::dotFloat32(a, b, args.size));
+  }
+}
+
+/**
+ * The state of `vec_top_k()`. A max-heap of the `k` best candidates so far,
+ * so that each row is compared against the worst one in O(1) and replaces it
+ * in O(log k).
+ */
+struct TopKState {
+  size_t k = 0;
+  std::vector<std::pair<double, sqlite3_int64>> heap;
+};
+
+void topKStep(exsqlite3_context *context, int /* argc */,
+              exsqlite3_value **argv) {
+  auto state = static_cast<TopKState **>(
+      ::exsqlite3_aggregate_context(context, sizeof(TopKState *)));
+  if (state == nullptr) {
+    ::exsqlite3_result_error_nomem(context);
+    return;
+  }
+  if (*state == nullptr) {
+    sqlite3_int64 k = ::exsqlite3_value_int64(argv[2]);
+    if (k <= 0) {
+      ::exsqlite3_result_error(context, "k must be a positive integer", -1);
+      return;
+    }
+    *state = new TopKState();
+    (*state)->k = static_cast<size_t>(k);
+    (*state)->heap.reserve(std::min<size_t>((*state)->k, 1024));
+  }
+
+  if (::exsqlite3_value_type(argv[0]) == SQLITE_NULL ||
+      ::exsqlite3_value_type(argv[1]) == SQLITE_NULL) {
+    return;
+  }
+  double distance = ::exsqlite3_value_double(argv[1]);
+  if (std::isnan(distance)) {
+    return;
+  }
+  std::pair<double, sqlite3_int64> candidate(distance,
+                                             ::exsqlite3_value_int64(argv[0]));
+  auto &heap = (*state)->heap;
+  if (heap.size() < (*state)->k) {
+    heap.push_back(candidate);
+    std::push_heap(heap.begin(), heap.end());
+  } else if (candidate < heap.front()) {
+    std::pop_heap(heap.begin(), heap.end());
+    heap.back() = candidate;
+    std::push_heap(heap.begin(), heap.end());
+  }
+}
+
+void topKFinal(exsqlite3_context *context) {
+  auto state =
+      static_cast<TopKState **>(::exsqlite3_aggregate_context(context, 0));
+  std::string result("[");
+  if (state != nullptr && *state != nullptr) {
+    auto &heap = (*state)->heap;
+    std::sort_heap(heap.begin(), heap.end());
+    for (size_t i = 0; i < heap.size(); ++i) {
+      if (i > 0) {
+        result += ',';
+      }
+      result += std::to_string(heap[i].second);
+    }
+    delete *state;
+    *state = nullptr;
+  }
+  result += ']';
+  ::exsqlite3_result_text(context, result.c_str(),
+                          static_cast<int>(result.size()), SQLITE_TRANSIENT);
+}
+
+} // namespace
+
+int registerVectorFunctions(sqlite3 *db) {
+  constexpr int kFlags = SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS;
+  const std::pair<const char *, void (*)(exsqlite3_context *, int,
+                                         exsqlite3_value **)>
+      functions[] = {
+          {"vec_distance_cosine", vectorFunction<Metric::Cosine>},
+          {"vec_distance_l2", vectorFunction<Metric::L2>},
+          {"vec_dot", vectorFunction<Metric::Dot>},
+      };
+  for (const auto &[name, function] : functions) {
+    for (int argc = 2; argc <= 3; ++argc) {
+      int ret = ::exsqlite3_create_function_v2(db, name, argc, kFlags, nullptr,
+                                             function, nullptr, nullptr,
+                                             nullptr);
+      if (ret != SQLITE_OK) {
+        return ret;
+      }
+    }
+  }
+  return ::exsqlite3_create_function_v2(db, "vec_top_k", 3, kFlags, nullptr,
+                                      nullptr, topKStep, topKFinal, nullptr);
+}
+
+} // namespace expo
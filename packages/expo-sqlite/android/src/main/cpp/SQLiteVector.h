@@ -0,0 +1,43 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sqlite3.h"
+
+namespace expo {
+
+/**
+ * Vector similarity functions for embeddings stored as blobs.
+ *
+ * - `vec_distance_cosine(a, b [, type])`
+ * - `vec_distance_l2(a, b [, type])`
+ * - `vec_dot(a, b [, type])`
+ * - `vec_top_k(id, distance, k)` aggregate, returning a JSON array of the `k`
+ *   ids with the smallest distances in ascending order.
+ *
+ * `type` is either `'float32'` (default) or `'int8'`, and describes the
+ * element type of both blobs. The kernels use NEON or SSE2 when available and
+ * fall back to scalar loops otherwise.
+ */
+int registerVectorFunctions(sqlite3 *db);
+
+namespace vector {
+
+// Raw kernels over `size` elements, exposed for benchmarking.
+float dotFloat32(const float *a, const float *b, size_t size);
+float squaredL2Float32(const float *a, const float *b, size_t size);
+// Computes the dot product and both squared norms in a single pass.
+void cosineTermsFloat32(const float *a, const float *b, size_t size,
+                        float *dot, float *normA, float *normB);
+
+int64_t dotInt8(const int8_t *a, const int8_t *b, size_t size);
+int64_t squaredL2Int8(const int8_t *a, const int8_t *b, size_t size);
+void cosineTermsInt8(const int8_t *a, const int8_t *b, size_t size,
+                     int64_t *dot, int64_t *normA, int64_t *normB);
+
+} // namespace vector
+
+} // namespace expo
@@ -0,0 +1,37 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+package expo.modules.sqlite
+
+import com.facebook.jni.HybridData
+import expo.modules.core.interfaces.DoNotStrip
+import java.io.Closeable
+
+@Suppress("KotlinJniMissingFunction")
+@DoNotStrip
+internal class NativeBackupBinding : Closeable {
+  @DoNotStrip
+  private val mHybridData: HybridData
+
+  init {
+    mHybridData = initHybrid()
+  }
+
+  override fun close() {
+    mHybridData.resetNative()
+  }
+
+  // region sqlite3 bindings
+
+  external fun sqlite3_backup_finish(): Int
+  external fun sqlite3_backup_pagecount(): Int
+  external fun sqlite3_backup_remaining(): Int
+  external fun sqlite3_backup_step(pages: Int): Int
+
+  // endregion
+
+  // region internals
+
+  private external fun initHybrid(): HybridData
+
+  // endregion
+}
@@ -0,0 +1,20 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+package expo.modules.sqlite
+
+import expo.modules.kotlin.sharedobjects.SharedRef
+
+internal class NativeBlob : SharedRef<NativeBlobBinding>(NativeBlobBinding()) {
+  var isOpened = false
+  var isClosed = false
+
+  override fun deallocate() {
+    super.deallocate()
+    isClosed = true
+    this.ref.close()
+  }
+
+  override fun equals(other: Any?): Boolean {
+    return other is NativeBlob && this.ref == other.ref
+  }
+}
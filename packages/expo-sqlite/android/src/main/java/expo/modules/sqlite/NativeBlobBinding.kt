@@ -0,0 +1,42 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+package expo.modules.sqlite
+
+import com.facebook.jni.HybridData
+import expo.modules.core.interfaces.DoNotStrip
+import java.io.Closeable
+import java.nio.ByteBuffer
+
+@Suppress("KotlinJniMissingFunction")
+@DoNotStrip
+internal class NativeBlobBinding : Closeable {
+  @DoNotStrip
+  private val mHybridData: HybridData
+
+  init {
+    mHybridData = initHybrid()
+  }
+
+  override fun close() {
+    mHybridData.resetNative()
+  }
+
+  // region sqlite3 bindings
+
+  external fun sqlite3_blob_bytes(): Int
+  external fun sqlite3_blob_close(): Int
+  external fun sqlite3_blob_read(buffer: ByteBuffer, length: Int, offset: Int): Int
+  external fun sqlite3_blob_reopen(rowId: Long): Int
+  external fun sqlite3_blob_write(buffer: ByteBuffer, length: Int, offset: Int): Int
+
+  external fun readBytes(offset: Int, length: Int): ByteArray
+  external fun writeBytes(data: ByteArray, offset: Int): Int
+
+  // endregion
+
+  // region internals
+
+  private external fun initHybrid(): HybridData
+
+  // endregion
+}
@@ -42,9 +42,13 @@ internal class NativeDatabaseBinding : Closeable {
 
   // region sqlite3 bindings
 
+  external fun sqlite3_backup_init(destDatabaseName: String, source: NativeDatabaseBinding, sourceDatabaseName: String, backup: NativeBackupBinding): Int
+  external fun sqlite3_blob_open(databaseName: String, tableName: String, columnName: String, rowId: Long, flags: Int, blob: NativeBlobBinding): Int
   external fun sqlite3_changes(): Int
   external fun sqlite3_close(): Int
   external fun sqlite3_db_filename(databaseName: String): String
+  external fun sqlite3_db_release_memory(): Int
+  external fun sqlite3_db_status(op: Int, reset: Boolean): IntArray?
   external fun sqlite3_enable_load_extension(onoff: Int): Int
   external fun sqlite3_exec(source: String): Int
   external fun sqlite3_get_autocommit(): Int
@@ -57,6 +61,25 @@ internal class NativeDatabaseBinding : Closeable {
   private external fun sqlite3_update_hook(enabled: Boolean) // Keeps it private internally and uses `enableUpdateHook` publicly
 
   external fun convertSqlLiteErrorToString(): String
+  external fun openKVStore(tableName: String, kvStore: NativeKVStoreBinding): Int
+
+  // endregion
+
+  // region execution control
+
+  external fun beginExecution(statement: NativeStatementBinding, timeoutMs: Double)
+  external fun endExecution(statement: NativeStatementBinding)
+  external fun interruptExecution(statement: NativeStatementBinding)
+
+  // endregion
+
+  // region profiler
+
+  external fun enableProfiler(slowQueryThresholdMs: Double, slowQueryLogSize: Int)
+  external fun disableProfiler()
+  external fun getSlowQueries(): ArrayList<SlowQuery>
+  external fun getStatementProfiles(): ArrayList<StatementProfile>
+  external fun resetProfiler()
 
   // endregion
 
@@ -79,8 +102,36 @@ internal class NativeDatabaseBinding : Closeable {
 
     // These error code should be synced with sqlite3.h
     const val SQLITE_OK = 0
+    const val SQLITE_BUSY = 5
+    const val SQLITE_LOCKED = 6
+    const val SQLITE_INTERRUPT = 9
 
     const val SQLITE_ROW = 100
     const val SQLITE_DONE = 101
+
+    // These status parameters should be synced with sqlite3.h
+    const val SQLITE_STATUS_MEMORY_USED = 0
+    const val SQLITE_STATUS_PAGECACHE_OVERFLOW = 2
+    const val SQLITE_STATUS_MALLOC_SIZE = 5
+    const val SQLITE_STATUS_MALLOC_COUNT = 9
+
+    const val SQLITE_DBSTATUS_LOOKASIDE_USED = 0
+    const val SQLITE_DBSTATUS_CACHE_USED = 1
+    const val SQLITE_DBSTATUS_SCHEMA_USED = 2
+    const val SQLITE_DBSTATUS_STMT_USED = 3
+    const val SQLITE_DBSTATUS_CACHE_HIT = 7
+    const val SQLITE_DBSTATUS_CACHE_MISS = 8
+    const val SQLITE_DBSTATUS_CACHE_WRITE = 9
+    const val SQLITE_DBSTATUS_CACHE_SPILL = 12
+
+    // region process-wide sqlite3 bindings
+
+    @JvmStatic
+    external fun sqlite3_soft_heap_limit64(limit: Long): Long
+
+    @JvmStatic
+    external fun sqlite3_status64(op: Int, reset: Boolean): LongArray?
+
+    // endregion
   }
 }
@@ -0,0 +1,18 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+package expo.modules.sqlite
+
+import expo.modules.kotlin.sharedobjects.SharedRef
+
+internal class NativeKVStore : SharedRef<NativeKVStoreBinding>(NativeKVStoreBinding()) {
+  var isClosed = false
+
+  override fun deallocate() {
+    super.deallocate()
+    this.ref.close()
+  }
+
+  override fun equals(other: Any?): Boolean {
+    return other is NativeKVStore && this.ref == other.ref
+  }
+}
@@ -0,0 +1,44 @@
+// Copyright 2015-present 650 Industries. All rights reserved.
+
+package expo.modules.sqlite
+
+import com.facebook.jni.HybridData
+import expo.modules.core.interfaces.DoNotStrip
+import java.io.Closeable
+
+@Suppress("KotlinJniMissingFunction")
+@DoNotStrip
+internal class NativeKVStoreBinding : Closeable {
+  @DoNotStrip
+  private val mHybridData: HybridData
+
+  init {
+    mHybridData = initHybrid()
+  }
+
+  override fun close() {
+    mHybridData.resetNative()
+  }
+
+  // region key-value operations
+
+  external fun getItem(key: String): String?
+  external fun multiGet(keys: Array<String>): Array<String?>
+  external fun setItem(key: String, value: String)
+  external fun multiSet(keys: Array<String>, values: Array<String>)
+  external fun removeItem(key: String): Boolean
+  external fun multiRemove(keys: Array<String>)
+  external fun getAllKeys(): Array<String>
+  external fun clear(): Boolean
+  external fun hasPendingWrites(): Boolean
+  external fun flush(): Int
+  external fun closeKVStore(): Int
+
+  // endregion
+
+  // region internals
+
+  private external fun initHybrid(): HybridData
+
+  // endregion
+}
@@ -4,9 +4,32 @@ package expo.modules.sqlite
 
 import expo.modules.kotlin.sharedobjects.SharedRef
 
-internal class NativeStatement : SharedRef<NativeStatementBinding>(NativeStatementBinding()) {
+internal class NativeStatement(val timeout: Double = 0.0) : SharedRef<NativeStatementBinding>(NativeStatementBinding()) {
   var isFinalized = false
 
+  /**
+   * Whether the statement was aborted from JavaScript. Once set, any further execution is rejected.
+   */
+  @Volatile
+  var isInterrupted = false
+
+  /**
+   * The bind plan of the prepared statement, mapping named parameters to their indices.
+   * It is resolved once by [resolveBindPlan] after preparing, so running the statement does not look up every parameter name through JNI.
+   */
+  var bindParameterIndices: Map<String, Int> = emptyMap()
+    private set
+
+  fun resolveBindPlan() {
+    bindParameterIndices = buildMap {
+      this@NativeStatement.ref.getBindParameterNames().forEachIndexed { i, name ->
+        if (name != null) {
+          put(name, i + 1)
+        }
+      }
+    }
+  }
+
   override fun deallocate() {
     super.deallocate()
     this.ref.close()
@@ -6,6 +6,7 @@ import com.facebook.jni.HybridData
 import expo.modules.core.interfaces.DoNotStrip
 import java.io.Closeable
 
+internal typealias SQLiteBindParameterNames = ArrayList<String?>
 internal typealias SQLiteColumnNames = ArrayList<String>
 internal typealias SQLiteColumnValues = ArrayList<Any>
 
@@ -25,7 +26,12 @@ internal class NativeStatementBinding : Closeable {
 
   // region sqlite3 bindings
 
+  external fun sqlite3_bind_blob(index: Int, value: ByteArray): Int
+  external fun sqlite3_bind_double(index: Int, value: Double): Int
+  external fun sqlite3_bind_int64(index: Int, value: Long): Int
+  external fun sqlite3_bind_null(index: Int): Int
   external fun sqlite3_bind_parameter_index(name: String): Int
+  external fun sqlite3_bind_text(index: Int, value: String): Int
   external fun sqlite3_clear_bindings(): Int
   external fun sqlite3_column_count(): Int
   external fun sqlite3_column_name(index: Int): String
@@ -33,7 +39,7 @@ internal class NativeStatementBinding : Closeable {
   external fun sqlite3_reset(): Int
   external fun sqlite3_step(): Int
 
-  external fun bindStatementParam(index: Int, param: Any): Int
+  external fun getBindParameterNames(): SQLiteBindParameterNames
   external fun getColumnNames(): SQLiteColumnNames
   external fun getColumnValues(): SQLiteColumnValues
 
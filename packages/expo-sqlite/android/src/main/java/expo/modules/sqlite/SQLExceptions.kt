@@ -30,3 +30,21 @@ internal class AccessClosedResourceException :
 
 internal class InvalidBindParameterException :
   CodedException("Invalid bind parameter")
+
+internal class InvalidBlobOffsetException(offset: Int, size: Int) :
+  CodedException("Offset $offset is out of range of the blob with size $size")
+
+internal class BlobAlreadyOpenedException :
+  CodedException("The blob handle is already opened. Use reopen to move it to another row")
+
+internal class InvalidBlobLengthException(length: Int) :
+  CodedException("Length $length must not be negative")
+
+internal class QueryAbortedException :
+  CodedException("ERR_SQLITE_QUERY_ABORTED", "The query was aborted", null)
+
+internal class QueryTimeoutException(timeout: Double) :
+  CodedException("ERR_SQLITE_QUERY_TIMEOUT", "The query timed out after $timeout ms", null)
+
+internal class InvalidBackupDestinationException :
+  CodedException("Either a destination database or a destination database path is required for backup")
@@ -2,6 +2,7 @@
 
 package expo.modules.sqlite
 
+import expo.modules.core.interfaces.DoNotStrip
 import expo.modules.kotlin.records.Field
 import expo.modules.kotlin.records.Record
 import expo.modules.kotlin.types.Enumerable
@@ -13,6 +14,47 @@ internal data class Query(
   val args: List<Any?>
 ) : Record
 
+/**
+ * A slow statement execution recorded by the native profiler.
+ */
+@DoNotStrip
+internal class SlowQuery @DoNotStrip constructor(
+  @Field
+  val sql: String,
+  @Field
+  val duration: Double,
+  @Field
+  val fullscanSteps: Int,
+  @Field
+  val sorts: Int,
+  @Field
+  val autoindexes: Int,
+  @Field
+  val vmSteps: Int
+) : Record
+
+/**
+ * The aggregated timings of a statement recorded by the native profiler.
+ */
+@DoNotStrip
+internal class StatementProfile @DoNotStrip constructor(
+  @Field
+  val sql: String,
+  @Field
+  val count: Int,
+  @Field
+  val totalDuration: Double,
+  @Field
+  val histogram: IntArray
+) : Record
+
+internal class ProfilerReport(
+  @Field
+  val slowQueries: List<SlowQuery>,
+  @Field
+  val statements: List<StatementProfile>
+) : Record
+
 internal enum class SQLAction(val value: String) : Enumerable {
   INSERT("insert"),
   UPDATE("update"),
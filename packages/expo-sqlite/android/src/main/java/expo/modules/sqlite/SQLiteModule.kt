@@ -2,14 +2,23 @@
 
 package expo.modules.sqlite
 
+import android.app.ActivityManager
+import android.content.ComponentCallbacks2
 import android.content.Context
+import android.content.res.Configuration
 import android.net.Uri
 import android.util.Log
 import androidx.core.net.toFile
 import androidx.core.os.bundleOf
+import expo.modules.kotlin.exception.CodedException
 import expo.modules.kotlin.exception.Exceptions
+import expo.modules.kotlin.functions.Coroutine
 import expo.modules.kotlin.modules.Module
 import expo.modules.kotlin.modules.ModuleDefinition
+import expo.modules.kotlin.typedarray.Uint8Array
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.yield
 import java.io.File
 import java.io.IOException
 
@@ -19,8 +28,31 @@ private const val MEMORY_DB_NAME = ":memory:"
 class SQLiteModule : Module() {
   private val cachedDatabases: MutableList<NativeDatabase> = mutableListOf()
   private val cachedStatements: MutableMap<NativeDatabase, MutableList<NativeStatement>> = mutableMapOf()
+  private val cachedBlobs: MutableMap<NativeDatabase, MutableList<NativeBlob>> = mutableMapOf()
+  private val cachedKVStores: MutableMap<NativeDatabase, MutableList<NativeKVStore>> = mutableMapOf()
   private var hasListeners = false
 
+  private val isLowRamDevice by lazy {
+    val activityManager = context.getSystemService(Context.ACTIVITY_SERVICE) as? ActivityManager
+    activityManager?.isLowRamDevice == true
+  }
+
+  private val memoryCallbacks = object : ComponentCallbacks2 {
+    override fun onTrimMemory(level: Int) {
+      // Ignores the levels where the app is neither running low on memory nor in the background.
+      if (level == ComponentCallbacks2.TRIM_MEMORY_RUNNING_MODERATE || level == ComponentCallbacks2.TRIM_MEMORY_UI_HIDDEN) {
+        return
+      }
+      releaseMemoryOfAllDatabases()
+    }
+
+    override fun onLowMemory() {
+      releaseMemoryOfAllDatabases()
+    }
+
+    override fun onConfigurationChanged(newConfig: Configuration) = Unit
+  }
+
   private val context: Context
     get() = appContext.reactContext ?: throw Exceptions.ReactContextLost()
 
@@ -34,7 +66,7 @@ class SQLiteModule : Module() {
       )
     }
 
-    Events("onDatabaseChange")
+    Events("onDatabaseChange", "onBackupProgress")
 
     OnStartObserving {
       hasListeners = true
@@ -44,7 +76,24 @@ class SQLiteModule : Module() {
       hasListeners = false
     }
 
+    OnCreate {
+      context.applicationContext.registerComponentCallbacks(memoryCallbacks)
+    }
+
+    OnActivityEntersBackground {
+      // Pending key-value writes are only kept in memory, persist them before the process may be killed.
+      val kvStores = getAllCachedKVStores()
+      if (kvStores.isNotEmpty()) {
+        appContext.modulesQueue.launch {
+          kvStores.forEach {
+            it.ref.flush()
+          }
+        }
+      }
+    }
+
     OnDestroy {
+      appContext.reactContext?.applicationContext?.unregisterComponentCallbacks(memoryCallbacks)
       try {
         removeAllCachedDatabases().forEach {
           closeDatabase(it)
@@ -71,6 +120,14 @@ class SQLiteModule : Module() {
       assetFile.copyTo(dbFile, forceOverwrite)
     }
 
+    Function("setSoftHeapLimit") { limit: Long ->
+      return@Function NativeDatabaseBinding.sqlite3_soft_heap_limit64(limit)
+    }
+
+    Function("getMemoryStatus") { reset: Boolean ->
+      return@Function getMemoryStatus(reset)
+    }
+
     AsyncFunction("ensureDatabasePathExistsAsync") { databasePath: String ->
       ensureDatabasePathExists(databasePath)
     }
@@ -140,17 +197,91 @@ class SQLiteModule : Module() {
         return@Function serialize(database, databaseName)
       }
 
+      AsyncFunction("backupAsync") Coroutine { database: NativeDatabase, destDatabase: NativeDatabase?, destDatabasePath: String?, backupId: Int, options: BackupOptions ->
+        backup(database, destDatabase, destDatabasePath, backupId, options)
+      }
+
+      AsyncFunction("enableProfilerAsync") { database: NativeDatabase, options: ProfilerOptions ->
+        enableProfiler(database, options)
+      }
+      Function("enableProfilerSync") { database: NativeDatabase, options: ProfilerOptions ->
+        enableProfiler(database, options)
+      }
+
+      AsyncFunction("disableProfilerAsync") { database: NativeDatabase ->
+        maybeThrowForClosedDatabase(database)
+        database.ref.disableProfiler()
+      }
+      Function("disableProfilerSync") { database: NativeDatabase ->
+        maybeThrowForClosedDatabase(database)
+        database.ref.disableProfiler()
+      }
+
+      AsyncFunction("getProfilerReportAsync") { database: NativeDatabase ->
+        return@AsyncFunction getProfilerReport(database)
+      }
+      Function("getProfilerReportSync") { database: NativeDatabase ->
+        return@Function getProfilerReport(database)
+      }
+
+      AsyncFunction("resetProfilerAsync") { database: NativeDatabase ->
+        maybeThrowForClosedDatabase(database)
+        database.ref.resetProfiler()
+      }
+      Function("resetProfilerSync") { database: NativeDatabase ->
+        maybeThrowForClosedDatabase(database)
+        database.ref.resetProfiler()
+      }
+
       AsyncFunction("prepareAsync") { database: NativeDatabase, statement: NativeStatement, source: String ->
         prepareStatement(database, statement, source)
       }
       Function("prepareSync") { database: NativeDatabase, statement: NativeStatement, source: String ->
         prepareStatement(database, statement, source)
       }
+
+      AsyncFunction("openBlobAsync") { database: NativeDatabase, blob: NativeBlob, databaseName: String, tableName: String, columnName: String, rowId: Long, readOnly: Boolean ->
+        openBlob(database, blob, databaseName, tableName, columnName, rowId, readOnly)
+      }
+      Function("openBlobSync") { database: NativeDatabase, blob: NativeBlob, databaseName: String, tableName: String, columnName: String, rowId: Long, readOnly: Boolean ->
+        openBlob(database, blob, databaseName, tableName, columnName, rowId, readOnly)
+      }
+
+      AsyncFunction("releaseMemoryAsync") { database: NativeDatabase ->
+        maybeThrowForClosedDatabase(database)
+        database.ref.sqlite3_db_release_memory()
+      }
+      Function("releaseMemorySync") { database: NativeDatabase ->
+        maybeThrowForClosedDatabase(database)
+        database.ref.sqlite3_db_release_memory()
+      }
+
+      AsyncFunction("getStatusAsync") { database: NativeDatabase, reset: Boolean ->
+        return@AsyncFunction getDatabaseStatus(database, reset)
+      }
+      Function("getStatusSync") { database: NativeDatabase, reset: Boolean ->
+        return@Function getDatabaseStatus(database, reset)
+      }
+
+      AsyncFunction("openKVStoreAsync") { database: NativeDatabase, kvStore: NativeKVStore, tableName: String ->
+        openKVStore(database, kvStore, tableName)
+      }
+      Function("openKVStoreSync") { database: NativeDatabase, kvStore: NativeKVStore, tableName: String ->
+        openKVStore(database, kvStore, tableName)
+      }
     }
 
     Class(NativeStatement::class) {
-      Constructor {
-        return@Constructor NativeStatement()
+      Constructor { timeout: Double? ->
+        return@Constructor NativeStatement(timeout ?: 0.0)
+      }
+
+      // Only a synchronous variant, because the module queue may be busy running the statement to interrupt.
+      Function("interruptSync") { statement: NativeStatement, database: NativeDatabase ->
+        statement.isInterrupted = true
+        if (!database.isClosed && !statement.isFinalized) {
+          database.ref.interruptExecution(statement.ref)
+        }
       }
 
       AsyncFunction("runAsync") { statement: NativeStatement, database: NativeDatabase, bindParams: Map<String, Any>, bindBlobParams: Map<String, ByteArray>, shouldPassAsArray: Boolean ->
@@ -197,6 +328,108 @@ class SQLiteModule : Module() {
         return@Function finalize(statement, database)
       }
     }
+
+    Class(NativeBlob::class) {
+      Constructor {
+        return@Constructor NativeBlob()
+      }
+
+      AsyncFunction("getSizeAsync") { blob: NativeBlob ->
+        maybeThrowForClosedBlob(blob)
+        return@AsyncFunction blob.ref.sqlite3_blob_bytes()
+      }
+      Function("getSizeSync") { blob: NativeBlob ->
+        maybeThrowForClosedBlob(blob)
+        return@Function blob.ref.sqlite3_blob_bytes()
+      }
+
+      // The async variant reads into a chunk sized array because the JS buffer cannot be accessed from the background thread.
+      AsyncFunction("readAsync") { blob: NativeBlob, database: NativeDatabase, offset: Int, length: Int ->
+        return@AsyncFunction readBlob(blob, database, offset, length)
+      }
+      Function("readSync") { blob: NativeBlob, database: NativeDatabase, buffer: Uint8Array, offset: Int ->
+        return@Function readBlob(blob, database, buffer, offset)
+      }
+
+      AsyncFunction("writeAsync") { blob: NativeBlob, database: NativeDatabase, data: ByteArray, offset: Int ->
+        writeBlob(blob, database, data, offset)
+      }
+      Function("writeSync") { blob: NativeBlob, database: NativeDatabase, data: Uint8Array, offset: Int ->
+        writeBlob(blob, database, data, offset)
+      }
+
+      AsyncFunction("reopenAsync") { blob: NativeBlob, database: NativeDatabase, rowId: Long ->
+        reopenBlob(blob, database, rowId)
+      }
+      Function("reopenSync") { blob: NativeBlob, database: NativeDatabase, rowId: Long ->
+        reopenBlob(blob, database, rowId)
+      }
+
+      AsyncFunction("closeAsync") { blob: NativeBlob, database: NativeDatabase ->
+        closeBlob(blob, database)
+      }
+      Function("closeSync") { blob: NativeBlob, database: NativeDatabase ->
+        closeBlob(blob, database)
+      }
+    }
+
+    Class(NativeKVStore::class) {
+      Constructor {
+        return@Constructor NativeKVStore()
+      }
+
+      // Reads and writes only touch the in-memory index, so there are no asynchronous variants of them.
+      Function("getItem") { kvStore: NativeKVStore, key: String ->
+        maybeThrowForClosedKVStore(kvStore)
+        return@Function kvStore.ref.getItem(key)
+      }
+      Function("multiGet") { kvStore: NativeKVStore, keys: List<String> ->
+        maybeThrowForClosedKVStore(kvStore)
+        return@Function kvStore.ref.multiGet(keys.toTypedArray()).toList()
+      }
+      Function("setItem") { kvStore: NativeKVStore, key: String, value: String ->
+        maybeThrowForClosedKVStore(kvStore)
+        kvStore.ref.setItem(key, value)
+      }
+      Function("multiSet") { kvStore: NativeKVStore, keys: List<String>, values: List<String> ->
+        maybeThrowForClosedKVStore(kvStore)
+        kvStore.ref.multiSet(keys.toTypedArray(), values.toTypedArray())
+      }
+      Function("removeItem") { kvStore: NativeKVStore, key: String ->
+        maybeThrowForClosedKVStore(kvStore)
+        return@Function kvStore.ref.removeItem(key)
+      }
+      Function("multiRemove") { kvStore: NativeKVStore, keys: List<String> ->
+        maybeThrowForClosedKVStore(kvStore)
+        kvStore.ref.multiRemove(keys.toTypedArray())
+      }
+      Function("getAllKeys") { kvStore: NativeKVStore ->
+        maybeThrowForClosedKVStore(kvStore)
+        return@Function kvStore.ref.getAllKeys().toList()
+      }
+      Function("clear") { kvStore: NativeKVStore ->
+        maybeThrowForClosedKVStore(kvStore)
+        return@Function kvStore.ref.clear()
+      }
+      Function("hasPendingWrites") { kvStore: NativeKVStore ->
+        maybeThrowForClosedKVStore(kvStore)
+        return@Function kvStore.ref.hasPendingWrites()
+      }
+
+      AsyncFunction("flushAsync") { kvStore: NativeKVStore, database: NativeDatabase ->
+        flushKVStore(kvStore, database)
+      }
+      Function("flushSync") { kvStore: NativeKVStore, database: NativeDatabase ->
+        flushKVStore(kvStore, database)
+      }
+
+      AsyncFunction("closeAsync") { kvStore: NativeKVStore, database: NativeDatabase ->
+        closeKVStore(kvStore, database)
+      }
+      Function("closeSync") { kvStore: NativeKVStore, database: NativeDatabase ->
+        closeKVStore(kvStore, database)
+      }
+    }
   }
 
   @Throws(OpenDatabaseException::class)
@@ -237,6 +470,70 @@ class SQLiteModule : Module() {
     if (database.openOptions.enableChangeListener) {
       addUpdateHook(database)
     }
+    val cacheSize = if (isLowRamDevice) {
+      database.openOptions.lowRamCacheSize ?: database.openOptions.cacheSize
+    } else {
+      database.openOptions.cacheSize
+    }
+    cacheSize?.let {
+      // A negative value sets the cache size in KiB rather than in pages.
+      execPragma(database, "PRAGMA cache_size = ${-it}")
+    }
+    database.openOptions.mmapSize?.let {
+      execPragma(database, "PRAGMA mmap_size = $it")
+    }
+  }
+
+  @Throws(SQLiteErrorException::class)
+  private fun execPragma(database: NativeDatabase, source: String) {
+    if (database.ref.sqlite3_exec(source) != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+  }
+
+  private fun getMemoryStatus(reset: Boolean): Map<String, Long> {
+    fun status(op: Int) = NativeDatabaseBinding.sqlite3_status64(op, reset) ?: longArrayOf(0, 0)
+    val memoryUsed = status(NativeDatabaseBinding.SQLITE_STATUS_MEMORY_USED)
+    return mapOf(
+      "memoryUsed" to memoryUsed[0],
+      "memoryHighwater" to memoryUsed[1],
+      "pageCacheOverflow" to status(NativeDatabaseBinding.SQLITE_STATUS_PAGECACHE_OVERFLOW)[0],
+      "largestAllocation" to status(NativeDatabaseBinding.SQLITE_STATUS_MALLOC_SIZE)[1],
+      "allocationCount" to status(NativeDatabaseBinding.SQLITE_STATUS_MALLOC_COUNT)[0]
+    )
+  }
+
+  @Throws(AccessClosedResourceException::class)
+  private fun getDatabaseStatus(database: NativeDatabase, reset: Boolean): Map<String, Int> {
+    maybeThrowForClosedDatabase(database)
+    fun status(op: Int) = database.ref.sqlite3_db_status(op, reset)?.get(0) ?: 0
+    return mapOf(
+      "cacheUsed" to status(NativeDatabaseBinding.SQLITE_DBSTATUS_CACHE_USED),
+      "cacheHit" to status(NativeDatabaseBinding.SQLITE_DBSTATUS_CACHE_HIT),
+      "cacheMiss" to status(NativeDatabaseBinding.SQLITE_DBSTATUS_CACHE_MISS),
+      "cacheWrite" to status(NativeDatabaseBinding.SQLITE_DBSTATUS_CACHE_WRITE),
+      "cacheSpill" to status(NativeDatabaseBinding.SQLITE_DBSTATUS_CACHE_SPILL),
+      "lookasideUsed" to status(NativeDatabaseBinding.SQLITE_DBSTATUS_LOOKASIDE_USED),
+      "schemaUsed" to status(NativeDatabaseBinding.SQLITE_DBSTATUS_SCHEMA_USED),
+      "statementUsed" to status(NativeDatabaseBinding.SQLITE_DBSTATUS_STMT_USED)
+    )
+  }
+
+  /**
+   * Frees the page cache of every open database, on the module queue so it does not race with closing them.
+   */
+  private fun releaseMemoryOfAllDatabases() {
+    val databases = getAllCachedDatabases()
+    if (databases.isEmpty()) {
+      return
+    }
+    appContext.modulesQueue.launch {
+      databases.forEach {
+        if (!it.isClosed) {
+          it.ref.sqlite3_db_release_memory()
+        }
+      }
+    }
   }
 
   @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
@@ -251,6 +548,97 @@ class SQLiteModule : Module() {
     return database.ref.sqlite3_serialize(databaseName)
   }
 
+  /**
+   * Copies the database page by page with the online backup API.
+   * The function suspends between steps, so other queries, including writes to the source database, can run in between.
+   */
+  @Throws(AccessClosedResourceException::class, InvalidBackupDestinationException::class, OpenDatabaseException::class, SQLiteErrorException::class)
+  private suspend fun backup(database: NativeDatabase, destDatabase: NativeDatabase?, destDatabasePath: String?, backupId: Int, options: BackupOptions) {
+    maybeThrowForClosedDatabase(database)
+    val destination = if (destDatabase != null) {
+      maybeThrowForClosedDatabase(destDatabase)
+      destDatabase.ref
+    } else {
+      val dbPath = ensureDatabasePathExists(destDatabasePath ?: throw InvalidBackupDestinationException())
+      NativeDatabaseBinding().also {
+        if (it.sqlite3_open(dbPath) != NativeDatabaseBinding.SQLITE_OK) {
+          it.sqlite3_close()
+          it.close()
+          throw OpenDatabaseException(dbPath)
+        }
+      }
+    }
+
+    val backup = NativeBackupBinding()
+    try {
+      if (destination.sqlite3_backup_init(options.destDatabaseName, database.ref, options.sourceDatabaseName, backup) != NativeDatabaseBinding.SQLITE_OK) {
+        throw SQLiteErrorException(destination.convertSqlLiteErrorToString())
+      }
+      var isFinished = false
+      var busyRetries = 0
+      try {
+        while (true) {
+          val ret = backup.sqlite3_backup_step(options.pagesPerStep)
+          if (hasListeners) {
+            sendEvent(
+              "onBackupProgress",
+              bundleOf(
+                "backupId" to backupId,
+                "remaining" to backup.sqlite3_backup_remaining(),
+                "pageCount" to backup.sqlite3_backup_pagecount()
+              )
+            )
+          }
+          if (ret != NativeDatabaseBinding.SQLITE_OK && ret != NativeDatabaseBinding.SQLITE_BUSY && ret != NativeDatabaseBinding.SQLITE_LOCKED) {
+            // Either `SQLITE_DONE` or an error that `sqlite3_backup_finish` reports below.
+            break
+          }
+          if (ret != NativeDatabaseBinding.SQLITE_OK) {
+            // The source is locked by another connection. Backs off exponentially instead of spinning until it is released.
+            val backoff = minOf(BACKUP_MIN_BUSY_BACKOFF_MS shl minOf(busyRetries, 16), BACKUP_MAX_BUSY_BACKOFF_MS)
+            busyRetries++
+            delay(maxOf(options.stepInterval, backoff))
+          } else if (options.stepInterval > 0) {
+            busyRetries = 0
+            delay(options.stepInterval)
+          } else {
+            busyRetries = 0
+            yield()
+          }
+        }
+        isFinished = true
+        if (backup.sqlite3_backup_finish() != NativeDatabaseBinding.SQLITE_OK) {
+          throw SQLiteErrorException(destination.convertSqlLiteErrorToString())
+        }
+      } finally {
+        if (!isFinished) {
+          backup.sqlite3_backup_finish()
+        }
+      }
+    } finally {
+      backup.close()
+      if (destDatabase == null) {
+        destination.sqlite3_close()
+        destination.close()
+      }
+    }
+  }
+
+  @Throws(AccessClosedResourceException::class)
+  private fun enableProfiler(database: NativeDatabase, options: ProfilerOptions) {
+    maybeThrowForClosedDatabase(database)
+    database.ref.enableProfiler(options.slowQueryThreshold, options.slowQueryLogSize)
+  }
+
+  @Throws(AccessClosedResourceException::class)
+  private fun getProfilerReport(database: NativeDatabase): ProfilerReport {
+    maybeThrowForClosedDatabase(database)
+    return ProfilerReport(
+      slowQueries = database.ref.getSlowQueries(),
+      statements = database.ref.getStatementProfiles()
+    )
+  }
+
   @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
   private fun prepareStatement(database: NativeDatabase, statement: NativeStatement, source: String) {
     maybeThrowForClosedDatabase(database)
@@ -258,39 +646,30 @@ class SQLiteModule : Module() {
     if (database.ref.sqlite3_prepare_v2(source, statement.ref) != NativeDatabaseBinding.SQLITE_OK) {
       throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
     }
+    statement.resolveBindPlan()
     maybeAddCachedStatement(database, statement)
   }
 
-  @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
-  private fun run(statement: NativeStatement, database: NativeDatabase, bindParams: Map<String, Any>, bindBlobParams: Map<String, ByteArray>, shouldPassAsArray: Boolean): Map<String, Any> {
-    maybeThrowForClosedDatabase(database)
-    maybeThrowForFinalizedStatement(statement)
+  @Throws(AccessClosedResourceException::class, QueryAbortedException::class, QueryTimeoutException::class, SQLiteErrorException::class)
+  private fun run(statement: NativeStatement, database: NativeDatabase, bindParams: Map<String, Any>, bindBlobParams: Map<String, ByteArray>, shouldPassAsArray: Boolean): Map<String, Any> = withExecution(statement, database) {
     statement.ref.sqlite3_reset()
     statement.ref.sqlite3_clear_bindings()
     for ((key, param) in bindParams) {
       val index = getBindParamIndex(statement, key, shouldPassAsArray)
       if (index > 0) {
-        // expo-modules-core AnyTypeConverter casts JavaScript Number to Kotlin Double,
-        // here to cast as Long if the value is an integer.
-        val normalizedParam =
-          if (param is Double && param.toDouble() % 1.0 == 0.0) {
-            param.toLong()
-          } else {
-            param
-          }
-        statement.ref.bindStatementParam(index, normalizedParam)
+        bindParam(statement, index, param)
       }
     }
     for ((key, param) in bindBlobParams) {
       val index = getBindParamIndex(statement, key, shouldPassAsArray)
       if (index > 0) {
-        statement.ref.bindStatementParam(index, param)
+        statement.ref.sqlite3_bind_blob(index, param)
       }
     }
 
     val ret = statement.ref.sqlite3_step()
     if (ret != NativeDatabaseBinding.SQLITE_ROW && ret != NativeDatabaseBinding.SQLITE_DONE) {
-      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+      throw createStepException(statement, database, ret)
     }
     val firstRowValues: SQLiteColumnValues =
       if (ret == NativeDatabaseBinding.SQLITE_ROW) {
@@ -298,31 +677,47 @@ class SQLiteModule : Module() {
       } else {
         arrayListOf()
       }
-    return mapOf(
+    return@withExecution mapOf(
       "lastInsertRowId" to database.ref.sqlite3_last_insert_rowid().toInt(),
       "changes" to database.ref.sqlite3_changes(),
       "firstRowValues" to firstRowValues
     )
   }
 
-  @Throws(AccessClosedResourceException::class, InvalidConvertibleException::class, SQLiteErrorException::class)
-  private fun step(statement: NativeStatement, database: NativeDatabase): SQLiteColumnValues? {
-    maybeThrowForClosedDatabase(database)
-    maybeThrowForFinalizedStatement(statement)
+  private fun bindParam(statement: NativeStatement, index: Int, param: Any?): Int {
+    return when (param) {
+      null -> statement.ref.sqlite3_bind_null(index)
+      // expo-modules-core AnyTypeConverter casts JavaScript Number to Kotlin Double,
+      // here to bind as integer if the value is an integer.
+      is Double ->
+        if (param % 1.0 == 0.0) {
+          statement.ref.sqlite3_bind_int64(index, param.toLong())
+        } else {
+          statement.ref.sqlite3_bind_double(index, param)
+        }
+      is Long -> statement.ref.sqlite3_bind_int64(index, param)
+      is Int -> statement.ref.sqlite3_bind_int64(index, param.toLong())
+      is Boolean -> statement.ref.sqlite3_bind_int64(index, if (param) 1 else 0)
+      is ByteArray -> statement.ref.sqlite3_bind_blob(index, param)
+      is String -> statement.ref.sqlite3_bind_text(index, param)
+      else -> statement.ref.sqlite3_bind_text(index, param.toString())
+    }
+  }
+
+  @Throws(AccessClosedResourceException::class, InvalidConvertibleException::class, QueryAbortedException::class, QueryTimeoutException::class, SQLiteErrorException::class)
+  private fun step(statement: NativeStatement, database: NativeDatabase): SQLiteColumnValues? = withExecution(statement, database) {
     val ret = statement.ref.sqlite3_step()
     if (ret == NativeDatabaseBinding.SQLITE_ROW) {
-      return statement.ref.getColumnValues()
+      return@withExecution statement.ref.getColumnValues()
     }
     if (ret != NativeDatabaseBinding.SQLITE_DONE) {
-      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+      throw createStepException(statement, database, ret)
     }
-    return null
+    return@withExecution null
   }
 
-  @Throws(AccessClosedResourceException::class, InvalidConvertibleException::class, SQLiteErrorException::class)
-  private fun getAll(statement: NativeStatement, database: NativeDatabase): List<SQLiteColumnValues> {
-    maybeThrowForClosedDatabase(database)
-    maybeThrowForFinalizedStatement(statement)
+  @Throws(AccessClosedResourceException::class, InvalidConvertibleException::class, QueryAbortedException::class, QueryTimeoutException::class, SQLiteErrorException::class)
+  private fun getAll(statement: NativeStatement, database: NativeDatabase): List<SQLiteColumnValues> = withExecution(statement, database) {
     val columnValuesList = mutableListOf<SQLiteColumnValues>()
     while (true) {
       val ret = statement.ref.sqlite3_step()
@@ -332,9 +727,41 @@ class SQLiteModule : Module() {
       } else if (ret == NativeDatabaseBinding.SQLITE_DONE) {
         break
       }
-      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+      throw createStepException(statement, database, ret)
+    }
+    return@withExecution columnValuesList
+  }
+
+  /**
+   * Runs the [block] executing the [statement], so that it can be interrupted from JavaScript or by its timeout.
+   */
+  @Throws(AccessClosedResourceException::class, QueryAbortedException::class)
+  private inline fun <T> withExecution(statement: NativeStatement, database: NativeDatabase, block: () -> T): T {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForFinalizedStatement(statement)
+    database.ref.beginExecution(statement.ref, statement.timeout)
+    try {
+      // Checked after `beginExecution`, so that an interruption either rejects here or reaches the running statement.
+      if (statement.isInterrupted) {
+        throw QueryAbortedException()
+      }
+      return block()
+    } finally {
+      database.ref.endExecution(statement.ref)
+    }
+  }
+
+  private fun createStepException(statement: NativeStatement, database: NativeDatabase, ret: Int): CodedException {
+    if (ret != NativeDatabaseBinding.SQLITE_INTERRUPT) {
+      return SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+    // Resets the interrupted statement, so that it releases its locks and can run again.
+    statement.ref.sqlite3_reset()
+    return if (statement.isInterrupted) {
+      QueryAbortedException()
+    } else {
+      QueryTimeoutException(statement.timeout)
     }
-    return columnValuesList
   }
 
   @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
@@ -357,6 +784,123 @@ class SQLiteModule : Module() {
     statement.isFinalized = true
   }
 
+  @Throws(AccessClosedResourceException::class, BlobAlreadyOpenedException::class, SQLiteErrorException::class)
+  private fun openBlob(database: NativeDatabase, blob: NativeBlob, databaseName: String, tableName: String, columnName: String, rowId: Long, readOnly: Boolean) {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedBlob(blob)
+    if (blob.isOpened) {
+      throw BlobAlreadyOpenedException()
+    }
+    val flags = if (readOnly) 0 else 1
+    if (database.ref.sqlite3_blob_open(databaseName, tableName, columnName, rowId, flags, blob.ref) != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+    blob.isOpened = true
+    addCachedBlob(database, blob)
+  }
+
+  @Throws(AccessClosedResourceException::class, InvalidBlobOffsetException::class, InvalidBlobLengthException::class, SQLiteErrorException::class)
+  private fun readBlob(blob: NativeBlob, database: NativeDatabase, offset: Int, length: Int): ByteArray {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedBlob(blob)
+    val readLength = getBlobReadLength(blob, offset, length)
+    return blob.ref.readBytes(offset, readLength)
+  }
+
+  @Throws(AccessClosedResourceException::class, InvalidBlobOffsetException::class, SQLiteErrorException::class)
+  private fun readBlob(blob: NativeBlob, database: NativeDatabase, buffer: Uint8Array, offset: Int): Int {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedBlob(blob)
+    val readLength = getBlobReadLength(blob, offset, buffer.byteLength)
+    if (blob.ref.sqlite3_blob_read(buffer.toDirectBuffer(), readLength, offset) != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+    return readLength
+  }
+
+  @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
+  private fun writeBlob(blob: NativeBlob, database: NativeDatabase, data: ByteArray, offset: Int) {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedBlob(blob)
+    if (blob.ref.writeBytes(data, offset) != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+  }
+
+  @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
+  private fun writeBlob(blob: NativeBlob, database: NativeDatabase, data: Uint8Array, offset: Int) {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedBlob(blob)
+    if (blob.ref.sqlite3_blob_write(data.toDirectBuffer(), data.byteLength, offset) != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+  }
+
+  @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
+  private fun reopenBlob(blob: NativeBlob, database: NativeDatabase, rowId: Long) {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedBlob(blob)
+    if (blob.ref.sqlite3_blob_reopen(rowId) != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+  }
+
+  @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
+  private fun closeBlob(blob: NativeBlob, database: NativeDatabase) {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedBlob(blob)
+    removeCachedBlob(database, blob)
+    val ret = blob.ref.sqlite3_blob_close()
+    blob.isClosed = true
+    if (ret != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+  }
+
+  @Throws(InvalidBlobOffsetException::class, InvalidBlobLengthException::class)
+  private fun getBlobReadLength(blob: NativeBlob, offset: Int, length: Int): Int {
+    if (length < 0) {
+      throw InvalidBlobLengthException(length)
+    }
+    val size = blob.ref.sqlite3_blob_bytes()
+    if (offset < 0 || offset > size) {
+      throw InvalidBlobOffsetException(offset, size)
+    }
+    return minOf(length, size - offset)
+  }
+
+  @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
+  private fun openKVStore(database: NativeDatabase, kvStore: NativeKVStore, tableName: String) {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedKVStore(kvStore)
+    if (database.ref.openKVStore(tableName, kvStore.ref) != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+    addCachedKVStore(database, kvStore)
+  }
+
+  @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
+  private fun flushKVStore(kvStore: NativeKVStore, database: NativeDatabase) {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedKVStore(kvStore)
+    if (kvStore.ref.flush() != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+  }
+
+  @Throws(AccessClosedResourceException::class, SQLiteErrorException::class)
+  private fun closeKVStore(kvStore: NativeKVStore, database: NativeDatabase) {
+    maybeThrowForClosedDatabase(database)
+    maybeThrowForClosedKVStore(kvStore)
+    removeCachedKVStore(database, kvStore)
+    val ret = kvStore.ref.flush()
+    kvStore.ref.closeKVStore()
+    kvStore.isClosed = true
+    if (ret != NativeDatabaseBinding.SQLITE_OK) {
+      throw SQLiteErrorException(database.ref.convertSqlLiteErrorToString())
+    }
+  }
+
   private fun loadCRSQLiteExtension(database: NativeDatabase) {
     var errCode = database.ref.sqlite3_enable_load_extension(1)
     if (errCode != NativeDatabaseBinding.SQLITE_OK) {
@@ -394,6 +938,17 @@ class SQLiteModule : Module() {
     maybeRemoveAllCachedStatements(database).forEach {
       it.ref.sqlite3_finalize()
     }
+    removeAllCachedBlobs(database).forEach {
+      if (!it.isClosed) {
+        it.ref.sqlite3_blob_close()
+        it.isClosed = true
+      }
+    }
+    removeAllCachedKVStores(database).forEach {
+      it.ref.flush()
+      it.ref.closeKVStore()
+      it.isClosed = true
+    }
     if (database.openOptions.enableCRSQLite) {
       database.ref.sqlite3_exec("SELECT crsql_finalize()")
     }
@@ -435,12 +990,26 @@ class SQLiteModule : Module() {
     }
   }
 
+  @Throws(AccessClosedResourceException::class)
+  private fun maybeThrowForClosedBlob(blob: NativeBlob) {
+    if (blob.isClosed) {
+      throw AccessClosedResourceException()
+    }
+  }
+
+  @Throws(AccessClosedResourceException::class)
+  private fun maybeThrowForClosedKVStore(kvStore: NativeKVStore) {
+    if (kvStore.isClosed) {
+      throw AccessClosedResourceException()
+    }
+  }
+
   @Throws(InvalidBindParameterException::class)
   private fun getBindParamIndex(statement: NativeStatement, key: String, shouldPassAsArray: Boolean): Int =
     if (shouldPassAsArray) {
       (key.toIntOrNull() ?: throw InvalidBindParameterException()) + 1
     } else {
-      statement.ref.sqlite3_bind_parameter_index(key)
+      statement.bindParameterIndices[key] ?: 0
     }
 
   // region cachedDatabases managements
@@ -464,6 +1033,11 @@ class SQLiteModule : Module() {
     return cachedDatabases.find(predicate)
   }
 
+  @Synchronized
+  private fun getAllCachedDatabases(): List<NativeDatabase> {
+    return cachedDatabases.toList()
+  }
+
   @Synchronized
   private fun removeAllCachedDatabases(): List<NativeDatabase> {
     val databases = cachedDatabases
@@ -506,7 +1080,64 @@ class SQLiteModule : Module() {
 
   // endregion
 
+  // region cachedBlobs managements
+
+  @Synchronized
+  private fun addCachedBlob(database: NativeDatabase, blob: NativeBlob) {
+    val blobs = cachedBlobs[database]
+    if (blobs != null) {
+      blobs.add(blob)
+    } else {
+      cachedBlobs[database] = mutableListOf(blob)
+    }
+  }
+
+  @Synchronized
+  private fun removeCachedBlob(database: NativeDatabase, blob: NativeBlob) {
+    cachedBlobs[database]?.remove(blob)
+  }
+
+  @Synchronized
+  private fun removeAllCachedBlobs(database: NativeDatabase): List<NativeBlob> {
+    return cachedBlobs.remove(database) ?: emptyList()
+  }
+
+  // endregion
+
+  // region cachedKVStores managements
+
+  @Synchronized
+  private fun addCachedKVStore(database: NativeDatabase, kvStore: NativeKVStore) {
+    val kvStores = cachedKVStores[database]
+    if (kvStores != null) {
+      kvStores.add(kvStore)
+    } else {
+      cachedKVStores[database] = mutableListOf(kvStore)
+    }
+  }
+
+  @Synchronized
+  private fun removeCachedKVStore(database: NativeDatabase, kvStore: NativeKVStore) {
+    cachedKVStores[database]?.remove(kvStore)
+  }
+
+  @Synchronized
+  private fun removeAllCachedKVStores(database: NativeDatabase): List<NativeKVStore> {
+    return cachedKVStores.remove(database) ?: emptyList()
+  }
+
+  @Synchronized
+  private fun getAllCachedKVStores(): List<NativeKVStore> {
+    return cachedKVStores.values.flatten()
+  }
+
+  // endregion
+
   companion object {
     private val TAG = SQLiteModule::class.java.simpleName
+
+    // Bounds of the delay between backup steps while the source database is busy or locked.
+    private const val BACKUP_MIN_BUSY_BACKOFF_MS = 1L
+    private const val BACKUP_MAX_BUSY_BACKOFF_MS = 100L
   }
 }
@@ -16,5 +16,36 @@ internal data class OpenDatabaseOptions(
   val useNewConnection: Boolean = false,
 
   @Field
-  val finalizeUnusedStatementsBeforeClosing: Boolean = true
+  val finalizeUnusedStatementsBeforeClosing: Boolean = true,
+
+  @Field
+  val cacheSize: Int? = null,
+
+  @Field
+  val lowRamCacheSize: Int? = null,
+
+  @Field
+  val mmapSize: Long? = null
+) : Record
+
+internal data class BackupOptions(
+  @Field
+  val sourceDatabaseName: String = "main",
+
+  @Field
+  val destDatabaseName: String = "main",
+
+  @Field
+  val pagesPerStep: Int = 100,
+
+  @Field
+  val stepInterval: Long = 0
+) : Record
+
+internal data class ProfilerOptions(
+  @Field
+  val slowQueryThreshold: Double = 100.0,
+
+  @Field
+  val slowQueryLogSize: Int = 50
 ) : Record
@@ -147,7 +147,8 @@ public final class SQLiteModule: Module {
 
     // swiftlint:disable:next closure_body_length
     Class(NativeStatement.self) {
-      Constructor {
+      // The timeout is only supported on Android, it is accepted so that the constructor takes the same arguments.
+      Constructor { (_: Double?) -> NativeStatement in
         return NativeStatement()
       }
 
@@ -67,8 +67,13 @@ async function replaceIosSymbolsAsync(apiSet: Set<string>): Promise<void> {
 async function replaceAndroidSymbolsAsync(apiSet: Set<string>): Promise<void> {
   const androidSrcRoot = path.join(PACKAGE_ROOT, 'android/src/main/cpp');
   const files = [
+    path.join(androidSrcRoot, 'NativeBackupBinding.cpp'),
+    path.join(androidSrcRoot, 'NativeBlobBinding.cpp'),
     path.join(androidSrcRoot, 'NativeDatabaseBinding.cpp'),
+    path.join(androidSrcRoot, 'NativeKVStoreBinding.cpp'),
     path.join(androidSrcRoot, 'NativeStatementBinding.cpp'),
+    path.join(androidSrcRoot, 'SQLiteProfiler.cpp'),
+    path.join(androidSrcRoot, 'SQLiteVector.cpp'),
   ];
   await Promise.all(
     files.map((file) =>
@@ -78,10 +83,15 @@ async function replaceAndroidSymbolsAsync(apiSet: Set<string>): Promise<void> {
     )
   );
 
-  const headerApiSet = new Set(['sqlite3_stmt']);
+  const headerApiSet = new Set(['sqlite3_backup', 'sqlite3_blob', 'sqlite3_stmt']);
   const headerFiles = [
+    path.join(androidSrcRoot, 'NativeBackupBinding.h'),
+    path.join(androidSrcRoot, 'NativeBlobBinding.h'),
     path.join(androidSrcRoot, 'NativeDatabaseBinding.h'),
+    path.join(androidSrcRoot, 'NativeKVStoreBinding.h'),
     path.join(androidSrcRoot, 'NativeStatementBinding.h'),
+    path.join(androidSrcRoot, 'SQLiteProfiler.h'),
+    path.join(androidSrcRoot, 'SQLiteVector.h'),
   ];
   await Promise.all(headerFiles.map((file) => replaceSqlite3SymbolsAsync(headerApiSet, file)));
 }
@@ -0,0 +1,26 @@
+import { NativeDatabase } from './NativeDatabase';
+
+/**
+ * A class that represents an instance of the SQLite incremental blob I/O handle.
+ */
+export declare class NativeBlob {
+  //#region Asynchronous API
+
+  public getSizeAsync(): Promise<number>;
+  public readAsync(database: NativeDatabase, offset: number, length: number): Promise<Uint8Array>;
+  public writeAsync(database: NativeDatabase, data: Uint8Array, offset: number): Promise<void>;
+  public reopenAsync(database: NativeDatabase, rowId: number): Promise<void>;
+  public closeAsync(database: NativeDatabase): Promise<void>;
+
+  //#endregion
+
+  //#region Synchronous API
+
+  public getSizeSync(): number;
+  public readSync(database: NativeDatabase, buffer: Uint8Array, offset: number): number;
+  public writeSync(database: NativeDatabase, data: Uint8Array, offset: number): void;
+  public reopenSync(database: NativeDatabase, rowId: number): void;
+  public closeSync(database: NativeDatabase): void;
+
+  //#endregion
+}
@@ -1,3 +1,5 @@
+import { NativeBlob } from './NativeBlob';
+import { NativeKVStore } from './NativeKVStore';
 import { NativeStatement } from './NativeStatement';
 
 /**
@@ -13,7 +15,28 @@ export declare class NativeDatabase {
   public closeAsync(): Promise<void>;
   public execAsync(source: string): Promise<void>;
   public serializeAsync(databaseName: string): Promise<Uint8Array>;
+  public backupAsync(
+    destDatabase: NativeDatabase | null,
+    destDatabasePath: string | null,
+    backupId: number,
+    options: SQLiteNativeBackupOptions
+  ): Promise<void>;
   public prepareAsync(nativeStatement: NativeStatement, source: string): Promise<NativeStatement>;
+  public enableProfilerAsync(options: SQLiteProfilerOptions): Promise<void>;
+  public disableProfilerAsync(): Promise<void>;
+  public getProfilerReportAsync(): Promise<SQLiteProfilerReport>;
+  public resetProfilerAsync(): Promise<void>;
+  public openBlobAsync(
+    nativeBlob: NativeBlob,
+    databaseName: string,
+    tableName: string,
+    columnName: string,
+    rowId: number,
+    readOnly: boolean
+  ): Promise<void>;
+  public openKVStoreAsync(nativeKVStore: NativeKVStore, tableName: string): Promise<void>;
+  public releaseMemoryAsync(): Promise<void>;
+  public getStatusAsync(reset: boolean): Promise<SQLiteDatabaseStatus>;
 
   //#endregion
 
@@ -25,10 +48,108 @@ export declare class NativeDatabase {
   public execSync(source: string): void;
   public serializeSync(databaseName: string): Uint8Array;
   public prepareSync(nativeStatement: NativeStatement, source: string): NativeStatement;
+  public enableProfilerSync(options: SQLiteProfilerOptions): void;
+  public disableProfilerSync(): void;
+  public getProfilerReportSync(): SQLiteProfilerReport;
+  public resetProfilerSync(): void;
+  public openBlobSync(
+    nativeBlob: NativeBlob,
+    databaseName: string,
+    tableName: string,
+    columnName: string,
+    rowId: number,
+    readOnly: boolean
+  ): void;
+  public openKVStoreSync(nativeKVStore: NativeKVStore, tableName: string): void;
+  public releaseMemorySync(): void;
+  public getStatusSync(reset: boolean): SQLiteDatabaseStatus;
 
   //#endregion
 }
 
+/**
+ * Options for [`SQLiteDatabase.enableProfilerAsync()`](#enableprofilerasyncoptions).
+ */
+export interface SQLiteProfilerOptions {
+  /**
+   * The duration in milliseconds from which a statement execution is recorded as a slow query.
+   * @default 100
+   */
+  slowQueryThreshold?: number;
+
+  /**
+   * The maximum number of slow queries to keep. The oldest entries are dropped first.
+   * @default 50
+   */
+  slowQueryLogSize?: number;
+}
+
+/**
+ * A slow statement execution recorded by the profiler.
+ */
+export interface SQLiteSlowQuery {
+  /** The SQL with the bound parameters expanded. */
+  sql: string;
+
+  /** The execution time in milliseconds. */
+  duration: number;
+
+  /** The number of times that SQLite stepped forward in a table as part of a full table scan. A large number may indicate a missing index. */
+  fullscanSteps: number;
+
+  /** The number of sort operations. */
+  sorts: number;
+
+  /** The number of rows inserted into automatic indexes, which are a hint for missing indexes. */
+  autoindexes: number;
+
+  /** The number of virtual machine operations. */
+  vmSteps: number;
+}
+
+/**
+ * The aggregated timings of a statement recorded by the profiler.
+ */
+export interface SQLiteStatementProfile {
+  /** The SQL of the prepared statement. */
+  sql: string;
+
+  /** The number of executions. */
+  count: number;
+
+  /** The total execution time in milliseconds. */
+  totalDuration: number;
+
+  /**
+   * The latency histogram of the executions.
+   * The item at index `i` is the number of executions that took between `2^i` and `2^(i+1)` microseconds.
+   * The first item also counts faster executions and the last item slower ones.
+   */
+  histogram: number[];
+}
+
+/**
+ * A report returned by [`SQLiteDatabase.getProfilerReportAsync()`](#getprofilerreportasync).
+ */
+export interface SQLiteProfilerReport {
+  /** The slowest recent statement executions, from the oldest to the newest. */
+  slowQueries: SQLiteSlowQuery[];
+
+  /** The aggregated timings per statement. */
+  statements: SQLiteStatementProfile[];
+}
+
+/**
+ * Backup options passed to the native module.
+ * @hidden
+ */
+export interface SQLiteNativeBackupOptions {
+  sourceDatabaseName?: string;
+  destDatabaseName?: string;
+  pagesPerStep?: number;
+  stepInterval?: number;
+}
+
 /**
  * Options for opening a database.
  */
@@ -58,4 +179,76 @@ export interface SQLiteOpenOptions {
    * @hidden
    */
   finalizeUnusedStatementsBeforeClosing?: boolean;
+
+  /**
+   * The maximum size of the page cache of the connection in KiB. Applied with [`PRAGMA cache_size`](https://www.sqlite.org/pragma.html#pragma_cache_size).
+   * Leave it unset to use the SQLite default.
+   * @platform android
+   */
+  cacheSize?: number;
+
+  /**
+   * The maximum size of the page cache of the connection in KiB on low RAM devices, where it takes precedence over `cacheSize`.
+   * Use it to cap the memory of a database on such devices only, without limiting the other connections of the process.
+   * @platform android
+   */
+  lowRamCacheSize?: number;
+
+  /**
+   * The maximum number of bytes of the database file to access with memory-mapped I/O. Applied with [`PRAGMA mmap_size`](https://www.sqlite.org/pragma.html#pragma_mmap_size).
+   * Memory-mapped I/O makes reads of read-mostly databases faster. Leave it unset to use the SQLite default.
+   * @platform android
+   */
+  mmapSize?: number;
+}
+
+/**
+ * The memory usage of a database connection, returned by [`SQLiteDatabase.getStatusAsync()`](#getstatusasyncreset).
+ * The values come from [`sqlite3_db_status()`](https://www.sqlite.org/c3ref/db_status.html).
+ */
+export interface SQLiteDatabaseStatus {
+  /** The bytes of heap memory used by the page cache. */
+  cacheUsed: number;
+
+  /** The number of page cache hits. */
+  cacheHit: number;
+
+  /** The number of page cache misses. */
+  cacheMiss: number;
+
+  /** The number of dirty cache entries written to disk. */
+  cacheWrite: number;
+
+  /** The number of dirty cache entries written to disk in the middle of a transaction because the cache was full. */
+  cacheSpill: number;
+
+  /** The number of lookaside memory slots in use. */
+  lookasideUsed: number;
+
+  /** The bytes of heap memory used to store the schemas. */
+  schemaUsed: number;
+
+  /** The bytes of heap memory used by the prepared statements. */
+  statementUsed: number;
+}
+
+/**
+ * The process-wide memory usage of SQLite, returned by [`getMemoryStatus()`](#sqlitegetmemorystatusreset).
+ * The values come from [`sqlite3_status64()`](https://www.sqlite.org/c3ref/status.html).
+ */
+export interface SQLiteMemoryStatus {
+  /** The bytes of memory currently allocated by SQLite. */
+  memoryUsed: number;
+
+  /** The highest number of bytes allocated by SQLite since the last reset. */
+  memoryHighwater: number;
+
+  /** The bytes of page cache allocations that did not fit in the preallocated page cache. */
+  pageCacheOverflow: number;
+
+  /** The size in bytes of the largest allocation since the last reset. */
+  largestAllocation: number;
+
+  /** The number of outstanding allocations. */
+  allocationCount: number;
 }
@@ -0,0 +1,29 @@
+import { NativeDatabase } from './NativeDatabase';
+
+/**
+ * A class that represents an instance of the native write-back key-value engine.
+ */
+export declare class NativeKVStore {
+  //#region Asynchronous API
+
+  public flushAsync(database: NativeDatabase): Promise<void>;
+  public closeAsync(database: NativeDatabase): Promise<void>;
+
+  //#endregion
+
+  //#region Synchronous API
+
+  public getItem(key: string): string | null;
+  public multiGet(keys: string[]): (string | null)[];
+  public setItem(key: string, value: string): void;
+  public multiSet(keys: string[], values: string[]): void;
+  public removeItem(key: string): boolean;
+  public multiRemove(keys: string[]): void;
+  public getAllKeys(): string[];
+  public clear(): boolean;
+  public hasPendingWrites(): boolean;
+  public flushSync(database: NativeDatabase): void;
+  public closeSync(database: NativeDatabase): void;
+
+  //#endregion
+}
@@ -57,6 +57,8 @@ export type SQLiteAnyDatabase = any;
  * A class that represents an instance of the SQLite statement.
  */
 export declare class NativeStatement {
+  constructor(timeout?: number);
+
   //#region Asynchronous API
 
   public runAsync(
@@ -86,6 +88,7 @@ export declare class NativeStatement {
   public resetSync(database: SQLiteAnyDatabase): void;
   public getColumnNamesSync(): string[];
   public finalizeSync(database: SQLiteAnyDatabase): void;
+  public interruptSync(database: SQLiteAnyDatabase): void;
 
   //#endregion
 }
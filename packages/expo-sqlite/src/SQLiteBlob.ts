@@ -0,0 +1,139 @@
+import { NativeBlob } from './NativeBlob';
+import { NativeDatabase } from './NativeDatabase';
+
+/**
+ * Options for opening a blob.
+ */
+export interface SQLiteOpenBlobOptions {
+  /**
+   * Whether to open the blob for reading only.
+   * @default false
+   */
+  readOnly?: boolean;
+
+  /**
+   * The name of the attached database where the table is located.
+   * @default 'main'
+   */
+  databaseName?: string;
+}
+
+/**
+ * A handle for [incremental blob I/O](https://www.sqlite.org/c3ref/blob_open.html) returned by [`SQLiteDatabase.openBlobAsync()`](#openblobasynctablename-columnname-rowid-options) or [`SQLiteDatabase.openBlobSync()`](#openblobsynctablename-columnname-rowid-options).
+ * It reads and writes a blob value in chunks, so large values never have to be fully loaded into memory.
+ *
+ * The size of the blob cannot be changed through this handle. To preallocate a blob, insert a [`zeroblob(N)`](https://www.sqlite.org/lang_corefunc.html#zeroblob) value and write into it afterward.
+ *
+ * @example
+ * ```ts
+ * const { lastInsertRowId } = await db.runAsync('INSERT INTO tiles (data) VALUES (zeroblob(?))', tile.byteLength);
+ * const blob = await db.openBlobAsync('tiles', 'data', lastInsertRowId);
+ * try {
+ *   const chunkSize = 64 * 1024;
+ *   for (let offset = 0; offset < tile.byteLength; offset += chunkSize) {
+ *     await blob.writeAsync(tile.subarray(offset, offset + chunkSize), offset);
+ *   }
+ * } finally {
+ *   await blob.closeAsync();
+ * }
+ * ```
+ * @platform android
+ */
+export class SQLiteBlob {
+  constructor(
+    private readonly nativeDatabase: NativeDatabase,
+    private readonly nativeBlob: NativeBlob
+  ) {}
+
+  //#region Asynchronous API
+
+  /**
+   * Get the size of the blob in bytes.
+   */
+  public getSizeAsync(): Promise<number> {
+    return this.nativeBlob.getSizeAsync();
+  }
+
+  /**
+   * Read bytes from the blob into the `buffer`.
+   * @param buffer The buffer to read into. At most `buffer.byteLength` bytes are read.
+   * @param offset The byte offset in the blob to start reading from.
+   * @returns The number of bytes read, which is smaller than `buffer.byteLength` when reaching the end of the blob.
+   */
+  public async readAsync(buffer: Uint8Array, offset: number = 0): Promise<number> {
+    const chunk = await this.nativeBlob.readAsync(this.nativeDatabase, offset, buffer.byteLength);
+    buffer.set(chunk);
+    return chunk.byteLength;
+  }
+
+  /**
+   * Write bytes to the blob. The write must fit into the existing size of the blob.
+   * @param data The bytes to write.
+   * @param offset The byte offset in the blob to start writing at.
+   */
+  public writeAsync(data: Uint8Array, offset: number = 0): Promise<void> {
+    return this.nativeBlob.writeAsync(this.nativeDatabase, data, offset);
+  }
+
+  /**
+   * Move the handle to another row of the same table and column, which is faster than opening a new handle.
+   * @param rowId The row ID to move to.
+   */
+  public reopenAsync(rowId: number): Promise<void> {
+    return this.nativeBlob.reopenAsync(this.nativeDatabase, rowId);
+  }
+
+  /**
+   * Close the blob handle. Attempting to access a closed handle will result in an error.
+   */
+  public closeAsync(): Promise<void> {
+    return this.nativeBlob.closeAsync(this.nativeDatabase);
+  }
+
+  //#endregion
+
+  //#region Synchronous API
+
+  /**
+   * Get the size of the blob in bytes.
+   */
+  public getSizeSync(): number {
+    return this.nativeBlob.getSizeSync();
+  }
+
+  /**
+   * Read bytes from the blob directly into the memory of `buffer`, without any intermediate copies.
+   * @param buffer The buffer to read into. At most `buffer.byteLength` bytes are read.
+   * @param offset The byte offset in the blob to start reading from.
+   * @returns The number of bytes read, which is smaller than `buffer.byteLength` when reaching the end of the blob.
+   */
+  public readSync(buffer: Uint8Array, offset: number = 0): number {
+    return this.nativeBlob.readSync(this.nativeDatabase, buffer, offset);
+  }
+
+  /**
+   * Write bytes to the blob directly from the memory of `data`. The write must fit into the existing size of the blob.
+   * @param data The bytes to write.
+   * @param offset The byte offset in the blob to start writing at.
+   */
+  public writeSync(data: Uint8Array, offset: number = 0): void {
+    this.nativeBlob.writeSync(this.nativeDatabase, data, offset);
+  }
+
+  /**
+   * Move the handle to another row of the same table and column, which is faster than opening a new handle.
+   * @param rowId The row ID to move to.
+   */
+  public reopenSync(rowId: number): void {
+    this.nativeBlob.reopenSync(this.nativeDatabase, rowId);
+  }
+
+  /**
+   * Close the blob handle. Attempting to access a closed handle will result in an error.
+   */
+  public closeSync(): void {
+    this.nativeBlob.closeSync(this.nativeDatabase);
+  }
+
+  //#endregion
+}
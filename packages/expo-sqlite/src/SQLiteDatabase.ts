@@ -1,20 +1,41 @@
 import { type EventSubscription } from 'expo-modules-core';
 
 import ExpoSQLite from './ExpoSQLite';
-import { NativeDatabase, SQLiteOpenOptions } from './NativeDatabase';
+import {
+  NativeDatabase,
+  SQLiteDatabaseStatus,
+  SQLiteMemoryStatus,
+  SQLiteOpenOptions,
+  SQLiteProfilerOptions,
+  SQLiteProfilerReport,
+  SQLiteSlowQuery,
+  SQLiteStatementProfile,
+} from './NativeDatabase';
+import { SQLiteBlob, SQLiteOpenBlobOptions } from './SQLiteBlob';
+import { SQLiteKVStore } from './SQLiteKVStore';
 import {
   SQLiteBindParams,
   SQLiteExecuteAsyncResult,
   SQLiteExecuteSyncResult,
   SQLiteRunResult,
   SQLiteStatement,
+  SQLiteStatementOptions,
   SQLiteVariadicBindParams,
 } from './SQLiteStatement';
 import { createDatabasePath } from './pathUtils';
 
-export { SQLiteOpenOptions };
+export {
+  SQLiteDatabaseStatus,
+  SQLiteMemoryStatus,
+  SQLiteOpenOptions,
+  SQLiteProfilerOptions,
+  SQLiteProfilerReport,
+  SQLiteSlowQuery,
+  SQLiteStatementProfile,
+};
 
 let memoWarnCRSQLiteDeprecation = false;
+let nextBackupId = 0;
 
 /**
  * A SQLite database.
@@ -59,15 +80,166 @@ export class SQLiteDatabase {
     return this.nativeDatabase.serializeAsync(databaseName);
   }
 
+  /**
+   * Copy the database into another database with the [online backup API](https://www.sqlite.org/backup.html).
+   * The pages are copied in steps on a background thread, and other queries can run between the steps, so the source database stays writable during the backup.
+   *
+   * @param destination The destination. Either an open `SQLiteDatabase` or the name of a database file, which is resolved in the same way as [`openDatabaseAsync()`](#sqliteopendatabaseasyncdatabasename-options-directory).
+   * @param options Backup options.
+   * @platform android
+   *
+   * @example
+   * ```ts
+   * await db.backupAsync('backup.db', {
+   *   pagesPerStep: 256,
+   *   onProgress: ({ remaining, pageCount }) => console.log(`${pageCount - remaining} / ${pageCount}`),
+   * });
+   * ```
+   */
+  public async backupAsync(
+    destination: SQLiteDatabase | string,
+    options?: SQLiteBackupOptions
+  ): Promise<void> {
+    const { directory, onProgress, ...nativeOptions } = options ?? {};
+    const backupId = nextBackupId++;
+    const subscription = onProgress
+      ? ExpoSQLite.addListener(
+          'onBackupProgress',
+          ({ backupId: id, ...progress }: { backupId: number } & SQLiteBackupProgress) => {
+            if (id === backupId) {
+              onProgress(progress);
+            }
+          }
+        )
+      : null;
+    try {
+      if (typeof destination === 'string') {
+        const destDatabasePath = createDatabasePath(destination, directory);
+        await this.nativeDatabase.backupAsync(null, destDatabasePath, backupId, nativeOptions);
+      } else {
+        await this.nativeDatabase.backupAsync(
+          destination.nativeDatabase,
+          null,
+          backupId,
+          nativeOptions
+        );
+      }
+    } finally {
+      subscription?.remove();
+    }
+  }
+
+  /**
+   * Serialize the database into a database file. This is a file-backed alternative to [`serializeAsync()`](#serializeasyncdatabasename) built on [`backupAsync()`](#backupasyncdestination-options),
+   * so the database is never loaded into memory as a whole. You can open the file with [`openDatabaseAsync()`](#sqliteopendatabaseasyncdatabasename-options-directory) afterward.
+   *
+   * @param destDatabaseName The name of the database file to write to.
+   * @param directory The directory of the database file. The default value is `defaultDatabaseDirectory`.
+   * @param databaseName The name of the current attached databases. The default value is `main` which is the default database name.
+   * @platform android
+   */
+  public serializeToFileAsync(
+    destDatabaseName: string,
+    directory?: string,
+    databaseName: string = 'main'
+  ): Promise<void> {
+    return this.backupAsync(destDatabaseName, { directory, sourceDatabaseName: databaseName });
+  }
+
+  /**
+   * Start profiling the statements executed on this database connection.
+   * The profiler records the latency of every statement with [`sqlite3_trace_v2()`](https://www.sqlite.org/c3ref/trace_v2.html), and keeps the slow ones with their [`sqlite3_stmt_status()`](https://www.sqlite.org/c3ref/stmt_status.html) counters.
+   * Calling it again restarts the profiler with the new options.
+   *
+   * @param options Profiler options.
+   * @platform android
+   */
+  public enableProfilerAsync(options?: SQLiteProfilerOptions): Promise<void> {
+    return this.nativeDatabase.enableProfilerAsync(options ?? {});
+  }
+
+  /**
+   * Stop profiling and discard the collected data.
+   * @platform android
+   */
+  public disableProfilerAsync(): Promise<void> {
+    return this.nativeDatabase.disableProfilerAsync();
+  }
+
+  /**
+   * Get the data collected by the profiler since it was enabled or last reset.
+   * @platform android
+   */
+  public getProfilerReportAsync(): Promise<SQLiteProfilerReport> {
+    return this.nativeDatabase.getProfilerReportAsync();
+  }
+
+  /**
+   * Discard the data collected by the profiler without stopping it.
+   * @platform android
+   */
+  public resetProfilerAsync(): Promise<void> {
+    return this.nativeDatabase.resetProfilerAsync();
+  }
+
+  /**
+   * Free as much heap memory as possible from the page cache of this database connection, with [`sqlite3_db_release_memory()`](https://www.sqlite.org/c3ref/db_release_memory.html).
+   * This is done automatically for all open databases when the system reports memory pressure.
+   * @platform android
+   */
+  public releaseMemoryAsync(): Promise<void> {
+    return this.nativeDatabase.releaseMemoryAsync();
+  }
+
+  /**
+   * Get the memory usage and the page cache statistics of this database connection.
+   * @param reset Whether to reset the counters after reading them.
+   * @platform android
+   */
+  public getStatusAsync(reset: boolean = false): Promise<SQLiteDatabaseStatus> {
+    return this.nativeDatabase.getStatusAsync(reset);
+  }
+
   /**
    * Create a [prepared SQLite statement](https://www.sqlite.org/c3ref/prepare.html).
    *
    * @param source A string containing the SQL query.
+   * @param options Options to abort or time out the executions of the statement.
    */
-  public async prepareAsync(source: string): Promise<SQLiteStatement> {
-    const nativeStatement = new ExpoSQLite.NativeStatement();
+  public async prepareAsync(
+    source: string,
+    options?: SQLiteStatementOptions
+  ): Promise<SQLiteStatement> {
+    const nativeStatement = new ExpoSQLite.NativeStatement(options?.timeout);
     await this.nativeDatabase.prepareAsync(nativeStatement, source);
-    return new SQLiteStatement(this.nativeDatabase, nativeStatement);
+    return new SQLiteStatement(this.nativeDatabase, nativeStatement, options?.signal);
+  }
+
+  /**
+   * Open a handle for [incremental blob I/O](https://www.sqlite.org/c3ref/blob_open.html) on a single blob value.
+   *
+   * @param tableName The name of the table containing the blob.
+   * @param columnName The name of the blob column.
+   * @param rowId The row ID of the row containing the blob.
+   * @param options Options for opening the blob.
+   * @platform android
+   */
+  public async openBlobAsync(
+    tableName: string,
+    columnName: string,
+    rowId: number,
+    options?: SQLiteOpenBlobOptions
+  ): Promise<SQLiteBlob> {
+    const nativeBlob = new ExpoSQLite.NativeBlob();
+    await this.nativeDatabase.openBlobAsync(
+      nativeBlob,
+      options?.databaseName ?? 'main',
+      tableName,
+      columnName,
+      rowId,
+      options?.readOnly ?? false
+    );
+    return new SQLiteBlob(this.nativeDatabase, nativeBlob);
   }
 
   /**
@@ -179,17 +351,113 @@ export class SQLiteDatabase {
     return this.nativeDatabase.serializeSync(databaseName);
   }
 
+  /**
+   * Start profiling the statements executed on this database connection.
+   * @see [`enableProfilerAsync()`](#enableprofilerasyncoptions)
+   *
+   * @param options Profiler options.
+   * @platform android
+   */
+  public enableProfilerSync(options?: SQLiteProfilerOptions): void {
+    this.nativeDatabase.enableProfilerSync(options ?? {});
+  }
+
+  /**
+   * Stop profiling and discard the collected data.
+   * @platform android
+   */
+  public disableProfilerSync(): void {
+    this.nativeDatabase.disableProfilerSync();
+  }
+
+  /**
+   * Get the data collected by the profiler since it was enabled or last reset.
+   * @platform android
+   */
+  public getProfilerReportSync(): SQLiteProfilerReport {
+    return this.nativeDatabase.getProfilerReportSync();
+  }
+
+  /**
+   * Discard the data collected by the profiler without stopping it.
+   * @platform android
+   */
+  public resetProfilerSync(): void {
+    this.nativeDatabase.resetProfilerSync();
+  }
+
+  /**
+   * Free as much heap memory as possible from the page cache of this database connection.
+   * @see [`releaseMemoryAsync()`](#releasememoryasync)
+   * @platform android
+   */
+  public releaseMemorySync(): void {
+    this.nativeDatabase.releaseMemorySync();
+  }
+
+  /**
+   * Get the memory usage and the page cache statistics of this database connection.
+   * @param reset Whether to reset the counters after reading them.
+   * @platform android
+   */
+  public getStatusSync(reset: boolean = false): SQLiteDatabaseStatus {
+    return this.nativeDatabase.getStatusSync(reset);
+  }
+
   /**
    * Create a [prepared SQLite statement](https://www.sqlite.org/c3ref/prepare.html).
    *
    * > **Note:** Running heavy tasks with this function can block the JavaScript thread and affect performance.
    *
    * @param source A string containing the SQL query.
+   * @param options Options to abort or time out the executions of the statement.
    */
-  public prepareSync(source: string): SQLiteStatement {
-    const nativeStatement = new ExpoSQLite.NativeStatement();
+  public prepareSync(source: string, options?: SQLiteStatementOptions): SQLiteStatement {
+    const nativeStatement = new ExpoSQLite.NativeStatement(options?.timeout);
     this.nativeDatabase.prepareSync(nativeStatement, source);
-    return new SQLiteStatement(this.nativeDatabase, nativeStatement);
+    return new SQLiteStatement(this.nativeDatabase, nativeStatement, options?.signal);
+  }
+
+  /**
+   * Open a handle for [incremental blob I/O](https://www.sqlite.org/c3ref/blob_open.html) on a single blob value.
+   *
+   * > **Note:** Running heavy tasks with this function can block the JavaScript thread and affect performance.
+   *
+   * @param tableName The name of the table containing the blob.
+   * @param columnName The name of the blob column.
+   * @param rowId The row ID of the row containing the blob.
+   * @param options Options for opening the blob.
+   * @platform android
+   */
+  public openBlobSync(
+    tableName: string,
+    columnName: string,
+    rowId: number,
+    options?: SQLiteOpenBlobOptions
+  ): SQLiteBlob {
+    const nativeBlob = new ExpoSQLite.NativeBlob();
+    this.nativeDatabase.openBlobSync(
+      nativeBlob,
+      options?.databaseName ?? 'main',
+      tableName,
+      columnName,
+      rowId,
+      options?.readOnly ?? false
+    );
+    return new SQLiteBlob(this.nativeDatabase, nativeBlob);
+  }
+
+  /**
+   * Open the native key-value engine on the given table, or return `null` if the platform does not support it.
+   * @hidden
+   */
+  public openKVStoreSync(tableName: string, flushInterval: number): SQLiteKVStore | null {
+    if (ExpoSQLite.NativeKVStore == null) {
+      return null;
+    }
+    const nativeKVStore = new ExpoSQLite.NativeKVStore();
+    this.nativeDatabase.openKVStoreSync(nativeKVStore, tableName);
+    return new SQLiteKVStore(this.nativeDatabase, nativeKVStore, flushInterval);
   }
 
   /**
@@ -213,7 +481,7 @@ export class SQLiteDatabase {
   //#region Statement API shorthands
 
   /**
-   * A convenience wrapper around [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource), [`SQLiteStatement.executeAsync()`](#executeasyncparams), and [`SQLiteStatement.finalizeAsync()`](#finalizeasync).
+   * A convenience wrapper around [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource-options), [`SQLiteStatement.executeAsync()`](#executeasyncparams), and [`SQLiteStatement.finalizeAsync()`](#finalizeasync).
    * @param source A string containing the SQL query.
    * @param params The parameters to bind to the prepared statement. You can pass values in array, object, or variadic arguments. See [`SQLiteBindValue`](#sqlitebindvalue) for more information about binding values.
    */
@@ -235,7 +503,7 @@ export class SQLiteDatabase {
   }
 
   /**
-   * A convenience wrapper around [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource), [`SQLiteStatement.executeAsync()`](#executeasyncparams), [`SQLiteExecuteAsyncResult.getFirstAsync()`](#getfirstasync), and [`SQLiteStatement.finalizeAsync()`](#finalizeasync).
+   * A convenience wrapper around [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource-options), [`SQLiteStatement.executeAsync()`](#executeasyncparams), [`SQLiteExecuteAsyncResult.getFirstAsync()`](#getfirstasync), and [`SQLiteStatement.finalizeAsync()`](#finalizeasync).
    * @param source A string containing the SQL query.
    * @param params The parameters to bind to the prepared statement. You can pass values in array, object, or variadic arguments. See [`SQLiteBindValue`](#sqlitebindvalue) for more information about binding values.
    */
@@ -257,7 +525,7 @@ export class SQLiteDatabase {
   }
 
   /**
-   * A convenience wrapper around [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource), [`SQLiteStatement.executeAsync()`](#executeasyncparams), [`SQLiteExecuteAsyncResult`](#sqliteexecuteasyncresult) `AsyncIterator`, and [`SQLiteStatement.finalizeAsync()`](#finalizeasync).
+   * A convenience wrapper around [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource-options), [`SQLiteStatement.executeAsync()`](#executeasyncparams), [`SQLiteExecuteAsyncResult`](#sqliteexecuteasyncresult) `AsyncIterator`, and [`SQLiteStatement.finalizeAsync()`](#finalizeasync).
    * @param source A string containing the SQL query.
    * @param params The parameters to bind to the prepared statement. You can pass values in array, object, or variadic arguments. See [`SQLiteBindValue`](#sqlitebindvalue) for more information about binding values.
    * @returns Rather than returning Promise, this function returns an [`AsyncIterableIterator`](https://developer.mozilla.org/en-US/docs/Web/JavaScript/Reference/Global_Objects/AsyncIterator). You can use `for await...of` to iterate over the rows from the SQLite query result.
@@ -283,7 +551,7 @@ export class SQLiteDatabase {
   }
 
   /**
-   * A convenience wrapper around [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource), [`SQLiteStatement.executeAsync()`](#executeasyncparams), [`SQLiteExecuteAsyncResult.getAllAsync()`](#getallasync), and [`SQLiteStatement.finalizeAsync()`](#finalizeasync).
+   * A convenience wrapper around [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource-options), [`SQLiteStatement.executeAsync()`](#executeasyncparams), [`SQLiteExecuteAsyncResult.getAllAsync()`](#getallasync), and [`SQLiteStatement.finalizeAsync()`](#finalizeasync).
    * @param source A string containing the SQL query.
    * @param params The parameters to bind to the prepared statement. You can pass values in array, object, or variadic arguments. See [`SQLiteBindValue`](#sqlitebindvalue) for more information about binding values.
    * @example
@@ -316,7 +584,7 @@ export class SQLiteDatabase {
   }
 
   /**
-   * A convenience wrapper around [`SQLiteDatabase.prepareSync()`](#preparesyncsource), [`SQLiteStatement.executeSync()`](#executesyncparams), and [`SQLiteStatement.finalizeSync()`](#finalizesync).
+   * A convenience wrapper around [`SQLiteDatabase.prepareSync()`](#preparesyncsource-options), [`SQLiteStatement.executeSync()`](#executesyncparams), and [`SQLiteStatement.finalizeSync()`](#finalizesync).
    * > **Note:** Running heavy tasks with this function can block the JavaScript thread and affect performance.
    * @param source A string containing the SQL query.
    * @param params The parameters to bind to the prepared statement. You can pass values in array, object, or variadic arguments. See [`SQLiteBindValue`](#sqlitebindvalue) for more information about binding values.
@@ -338,7 +606,7 @@ export class SQLiteDatabase {
   }
 
   /**
-   * A convenience wrapper around [`SQLiteDatabase.prepareSync()`](#preparesyncsource), [`SQLiteStatement.executeSync()`](#executesyncparams), [`SQLiteExecuteSyncResult.getFirstSync()`](#getfirstsync), and [`SQLiteStatement.finalizeSync()`](#finalizesync).
+   * A convenience wrapper around [`SQLiteDatabase.prepareSync()`](#preparesyncsource-options), [`SQLiteStatement.executeSync()`](#executesyncparams), [`SQLiteExecuteSyncResult.getFirstSync()`](#getfirstsync), and [`SQLiteStatement.finalizeSync()`](#finalizesync).
    * > **Note:** Running heavy tasks with this function can block the JavaScript thread and affect performance.
    * @param source A string containing the SQL query.
    * @param params The parameters to bind to the prepared statement. You can pass values in array, object, or variadic arguments. See [`SQLiteBindValue`](#sqlitebindvalue) for more information about binding values.
@@ -361,7 +629,7 @@ export class SQLiteDatabase {
   }
 
   /**
-   * A convenience wrapper around [`SQLiteDatabase.prepareSync()`](#preparesyncsource), [`SQLiteStatement.executeSync()`](#executesyncparams), [`SQLiteExecuteSyncResult`](#sqliteexecutesyncresult) `Iterator`, and [`SQLiteStatement.finalizeSync()`](#finalizesync).
+   * A convenience wrapper around [`SQLiteDatabase.prepareSync()`](#preparesyncsource-options), [`SQLiteStatement.executeSync()`](#executesyncparams), [`SQLiteExecuteSyncResult`](#sqliteexecutesyncresult) `Iterator`, and [`SQLiteStatement.finalizeSync()`](#finalizesync).
    * > **Note:** Running heavy tasks with this function can block the JavaScript thread and affect performance.
    * @param source A string containing the SQL query.
    * @param params The parameters to bind to the prepared statement. You can pass values in array, object, or variadic arguments. See [`SQLiteBindValue`](#sqlitebindvalue) for more information about binding values.
@@ -385,7 +653,7 @@ export class SQLiteDatabase {
   }
 
   /**
-   * A convenience wrapper around [`SQLiteDatabase.prepareSync()`](#preparesyncsource), [`SQLiteStatement.executeSync()`](#executesyncparams), [`SQLiteExecuteSyncResult.getAllSync()`](#getallsync), and [`SQLiteStatement.finalizeSync()`](#finalizesync).
+   * A convenience wrapper around [`SQLiteDatabase.prepareSync()`](#preparesyncsource-options), [`SQLiteStatement.executeSync()`](#executesyncparams), [`SQLiteExecuteSyncResult.getAllSync()`](#getallsync), and [`SQLiteStatement.finalizeSync()`](#finalizesync).
    * > **Note:** Running heavy tasks with this function can block the JavaScript thread and affect performance.
    * @param source A string containing the SQL query.
    * @param params The parameters to bind to the prepared statement. You can pass values in array, object, or variadic arguments. See [`SQLiteBindValue`](#sqlitebindvalue) for more information about binding values.
@@ -519,6 +787,28 @@ export function deleteDatabaseSync(databaseName: string, directory?: string): vo
   return ExpoSQLite.deleteDatabaseSync(databasePath);
 }
 
+/**
+ * Set the process-wide soft limit on the heap memory used by SQLite, with [`sqlite3_soft_heap_limit64()`](https://www.sqlite.org/c3ref/hard_heap_limit64.html).
+ * When the limit is exceeded, SQLite recycles its page caches before allocating more memory.
+ * No limit is applied by default. Prefer the `cacheSize` and `lowRamCacheSize` open options to bound the memory of a single database.
+ *
+ * @param limit The limit in bytes. Pass `0` to disable the limit, or a negative value to only read the current limit.
+ * @returns The previous limit in bytes.
+ * @platform android
+ */
+export function setSoftHeapLimit(limit: number): number {
+  return ExpoSQLite.setSoftHeapLimit(limit);
+}
+
+/**
+ * Get the process-wide memory usage of SQLite.
+ * @param reset Whether to reset the highwater marks after reading them.
+ * @platform android
+ */
+export function getMemoryStatus(reset: boolean = false): SQLiteMemoryStatus {
+  return ExpoSQLite.getMemoryStatus(reset);
+}
+
 /**
  * The event payload for the listener of [`addDatabaseChangeListener`](#sqliteadddatabasechangelistenerlistener)
  */
@@ -536,6 +826,56 @@ export type DatabaseChangeEvent = {
   rowId: number;
 };
 
+/**
+ * The progress of a backup reported by [`SQLiteBackupOptions.onProgress`](#sqlitebackupoptions).
+ */
+export type SQLiteBackupProgress = {
+  /** The number of pages still to be copied. */
+  remaining: number;
+
+  /** The total number of pages in the source database. */
+  pageCount: number;
+};
+
+/**
+ * Options for [`SQLiteDatabase.backupAsync()`](#backupasyncdestination-options).
+ */
+export interface SQLiteBackupOptions {
+  /**
+   * The directory of the destination database file when the destination is a database name. The default value is `defaultDatabaseDirectory`.
+   */
+  directory?: string;
+
+  /**
+   * The name of the attached database to copy from.
+   * @default 'main'
+   */
+  sourceDatabaseName?: string;
+
+  /**
+   * The name of the attached database to copy into.
+   * @default 'main'
+   */
+  destDatabaseName?: string;
+
+  /**
+   * The number of pages to copy in each step. A negative value copies all the remaining pages in a single step.
+   * @default 100
+   */
+  pagesPerStep?: number;
+
+  /**
+   * The time in milliseconds to wait between steps, so that other queries have more time to access the source database.
+   * @default 0
+   */
+  stepInterval?: number;
+
+  /**
+   * A function called after each step.
+   */
+  onProgress?: (progress: SQLiteBackupProgress) => void;
+}
+
 /**
  * Add a listener for database changes.
  * > Note: to enable this feature, you must set [`enableChangeListener` to `true`](#sqliteopenoptions) when opening the database.
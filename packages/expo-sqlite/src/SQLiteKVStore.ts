@@ -0,0 +1,99 @@
+import { NativeDatabase } from './NativeDatabase';
+import { NativeKVStore } from './NativeKVStore';
+
+/**
+ * A key-value store on top of a `(key TEXT PRIMARY KEY, value TEXT)` table, backed by a native in-memory index.
+ * Reads are served from memory, and writes are coalesced until the next flush commits them in a single transaction.
+ * The table should not be modified by other connections or statements while the store is open.
+ * @hidden
+ */
+export class SQLiteKVStore {
+  private pendingFlush: Promise<void> | null = null;
+  private isClosed = false;
+
+  constructor(
+    private readonly nativeDatabase: NativeDatabase,
+    private readonly nativeKVStore: NativeKVStore,
+    private readonly flushInterval: number
+  ) {}
+
+  public getItem(key: string): string | null {
+    return this.nativeKVStore.getItem(key);
+  }
+
+  public multiGet(keys: string[]): (string | null)[] {
+    return this.nativeKVStore.multiGet(keys);
+  }
+
+  public setItem(key: string, value: string): void {
+    this.nativeKVStore.setItem(key, value);
+  }
+
+  public multiSet(keyValuePairs: [string, string][]): void {
+    this.nativeKVStore.multiSet(
+      keyValuePairs.map(([key]) => key),
+      keyValuePairs.map(([, value]) => value)
+    );
+  }
+
+  public removeItem(key: string): boolean {
+    return this.nativeKVStore.removeItem(key);
+  }
+
+  public multiRemove(keys: string[]): void {
+    this.nativeKVStore.multiRemove(keys);
+  }
+
+  public getAllKeys(): string[] {
+    return this.nativeKVStore.getAllKeys();
+  }
+
+  public clear(): boolean {
+    return this.nativeKVStore.clear();
+  }
+
+  /**
+   * Schedule a flush after the flush interval, unless one is already scheduled.
+   * All writes done until the flush starts are committed together.
+   * @returns A promise that resolves once the writes are committed.
+   */
+  public scheduleFlushAsync(): Promise<void> {
+    if (this.pendingFlush == null) {
+      this.pendingFlush = new Promise<void>((resolve) => setTimeout(resolve, this.flushInterval)).then(
+        () => {
+          // Writes from now on belong to the next batch.
+          this.pendingFlush = null;
+          if (this.isClosed) {
+            return;
+          }
+          return this.nativeKVStore.flushAsync(this.nativeDatabase);
+        }
+      );
+    }
+    return this.pendingFlush;
+  }
+
+  public flushAsync(): Promise<void> {
+    return this.nativeKVStore.flushAsync(this.nativeDatabase);
+  }
+
+  public flushSync(): void {
+    this.nativeKVStore.flushSync(this.nativeDatabase);
+  }
+
+  /**
+   * Flush the pending writes and release the native resources.
+   */
+  public async closeAsync(): Promise<void> {
+    this.isClosed = true;
+    await this.nativeKVStore.closeAsync(this.nativeDatabase);
+  }
+
+  /**
+   * Flush the pending writes and release the native resources.
+   */
+  public closeSync(): void {
+    this.isClosed = true;
+    this.nativeKVStore.closeSync(this.nativeDatabase);
+  }
+}
@@ -1,3 +1,5 @@
+import { Platform } from 'expo-modules-core';
+
 import { NativeDatabase } from './NativeDatabase';
 import {
   SQLiteBindParams,
@@ -16,13 +18,63 @@ export { SQLiteBindParams, SQLiteBindValue, SQLiteRunResult, SQLiteVariadicBindP
 type ValuesOf<T extends object> = T[keyof T][];
 
 /**
- * A prepared statement returned by [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource) or [`SQLiteDatabase.prepareSync()`](#preparesyncsource) that can be binded with parameters and executed.
+ * Options for [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource-options) and [`SQLiteDatabase.prepareSync()`](#preparesyncsource-options).
+ *
+ * @example
+ * ```ts
+ * const controller = new AbortController();
+ * const statement = await db.prepareAsync('SELECT * FROM items WHERE name LIKE ?', {
+ *   signal: controller.signal,
+ *   timeout: 1000,
+ * });
+ * try {
+ *   const result = await statement.executeAsync(`%${searchText}%`);
+ *   const rows = await result.getAllAsync();
+ * } finally {
+ *   await statement.finalizeAsync();
+ * }
+ * // Calling `controller.abort()` from elsewhere rejects the pending `getAllAsync()` with `ERR_SQLITE_QUERY_ABORTED`.
+ * ```
+ */
+export interface SQLiteStatementOptions {
+  /**
+   * A signal to abort the statement. The running execution is interrupted and its promise rejects with the `ERR_SQLITE_QUERY_ABORTED` error code.
+   * Once the signal is aborted, any further execution of the statement rejects the same way.
+   * @platform android
+   */
+  signal?: AbortSignal;
+
+  /**
+   * The maximum duration in milliseconds of each execution call, such as `executeAsync()` or `getAllAsync()`.
+   * An execution exceeding it is interrupted and rejects with the `ERR_SQLITE_QUERY_TIMEOUT` error code.
+   * The statement is reset and can be executed again.
+   * @platform android
+   */
+  timeout?: number;
+}
+
+/**
+ * A prepared statement returned by [`SQLiteDatabase.prepareAsync()`](#prepareasyncsource-options) or [`SQLiteDatabase.prepareSync()`](#preparesyncsource-options) that can be binded with parameters and executed.
  */
 export class SQLiteStatement {
+  private readonly interrupt = () => {
+    // Cancellation is only implemented on Android, the signal is ignored elsewhere.
+    if (Platform.OS === 'android') {
+      this.nativeStatement.interruptSync(this.nativeDatabase);
+    }
+  };
+
   constructor(
     private readonly nativeDatabase: NativeDatabase,
-    private readonly nativeStatement: NativeStatement
-  ) {}
+    private readonly nativeStatement: NativeStatement,
+    private readonly signal?: AbortSignal
+  ) {
+    if (signal?.aborted) {
+      this.interrupt();
+    } else {
+      signal?.addEventListener('abort', this.interrupt);
+    }
+  }
 
   //#region Asynchronous API
 
@@ -98,6 +150,7 @@ export class SQLiteStatement {
    * > **Note:** While expo-sqlite will automatically finalize any orphaned prepared statements upon closing the database, it is considered best practice to manually finalize prepared statements as soon as they are no longer needed. This helps to prevent resource leaks. You can use the `try...finally` statement to ensure that prepared statements are finalized even if an error occurs.
    */
   public async finalizeAsync(): Promise<void> {
+    this.signal?.removeEventListener('abort', this.interrupt);
     await this.nativeStatement.finalizeAsync(this.nativeDatabase);
   }
 
@@ -178,6 +231,7 @@ export class SQLiteStatement {
    * > **Note:** While expo-sqlite will automatically finalize any orphaned prepared statements upon closing the database, it is considered best practice to manually finalize prepared statements as soon as they are no longer needed. This helps to prevent resource leaks. You can use the `try...finally` statement to ensure that prepared statements are finalized even if an error occurs.
    */
   public finalizeSync(): void {
+    this.signal?.removeEventListener('abort', this.interrupt);
     this.nativeStatement.finalizeSync(this.nativeDatabase);
   }
 
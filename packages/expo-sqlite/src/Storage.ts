@@ -1,4 +1,5 @@
 import { openDatabaseSync, type SQLiteDatabase } from './index';
+import { type SQLiteKVStore } from './SQLiteKVStore';
 
 export function checkValidInput(...input: unknown[]) {
   const [key, value] = input;
@@ -23,6 +24,22 @@ export function checkValidInput(...input: unknown[]) {
  */
 export type SQLiteStorageSetItemUpdateFunction = (prevValue: string | null) => string;
 
+/**
+ * Options for the [`SQLiteStorage`](#sqlitestorage-1) constructor.
+ */
+export interface SQLiteStorageOptions {
+  /**
+   * The delay in milliseconds before the pending asynchronous writes are committed to the database in a single transaction.
+   * Writes done within the delay are coalesced, so only the last value of a key is written.
+   * The promises returned by the asynchronous write methods resolve after the commit.
+   * Synchronous writes are always committed before they return.
+   * Only applies to the platforms that serve the storage from the native in-memory engine.
+   * @default 0
+   * @platform android
+   */
+  flushInterval?: number;
+}
+
 const DATABASE_VERSION = 1;
 const STATEMENT_GET = 'SELECT value FROM storage WHERE key = ?;';
 const STATEMENT_SET =
@@ -30,17 +47,27 @@ const STATEMENT_SET =
 const STATEMENT_REMOVE = 'DELETE FROM storage WHERE key = ?;';
 const STATEMENT_GET_ALL_KEYS = 'SELECT key FROM storage;';
 const STATEMENT_CLEAR = 'DELETE FROM storage;';
+const TABLE_NAME = 'storage';
 
 const MIGRATION_STATEMENT_0 =
   'CREATE TABLE IF NOT EXISTS storage (key TEXT PRIMARY KEY NOT NULL, value TEXT);';
 
 /**
  * Key-value store backed by SQLite. This class accepts a `databaseName` parameter in its constructor, which is the name of the database file to use for the storage.
+ *
+ * On Android, the storage is served from a native in-memory index which is loaded on first access.
+ * Reads do not hit the database, and asynchronous writes are committed in batches. Use [`flushAsync()`](#flushasync) to commit the pending writes immediately.
+ * Synchronous writes commit the pending writes before returning, so they are durable like on the other platforms.
+ * The `storage` table should not be modified by other means in this case.
  */
 export class SQLiteStorage {
   private db: SQLiteDatabase | null = null;
+  private kvStore: SQLiteKVStore | null | undefined = undefined;
 
-  constructor(private readonly databaseName: string) {}
+  constructor(
+    private readonly databaseName: string,
+    private readonly options: SQLiteStorageOptions = {}
+  ) {}
 
   //#region Asynchronous API
 
@@ -49,6 +76,10 @@ export class SQLiteStorage {
    */
   async getItemAsync(key: string): Promise<string | null> {
     checkValidInput(key);
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      return kvStore.getItem(key);
+    }
     const db = this.getDbSync();
     const result = await db.getFirstAsync<{ value: string }>(STATEMENT_GET, key);
     return result?.value ?? null;
@@ -63,6 +94,12 @@ export class SQLiteStorage {
     value: string | SQLiteStorageSetItemUpdateFunction
   ): Promise<void> {
     checkValidInput(key, value);
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      SQLiteStorage.setKVStoreItem(kvStore, key, value);
+      await kvStore.scheduleFlushAsync();
+      return;
+    }
     const db = this.getDbSync();
 
     if (typeof value === 'function') {
@@ -84,6 +121,12 @@ export class SQLiteStorage {
    */
   async removeItemAsync(key: string): Promise<boolean> {
     checkValidInput(key);
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      const removed = kvStore.removeItem(key);
+      await kvStore.scheduleFlushAsync();
+      return removed;
+    }
     const db = this.getDbSync();
     const result = await db.runAsync(STATEMENT_REMOVE, key);
     return result.changes > 0;
@@ -93,6 +136,10 @@ export class SQLiteStorage {
    * Retrieves all keys stored in the storage asynchronously.
    */
   async getAllKeysAsync(): Promise<string[]> {
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      return kvStore.getAllKeys();
+    }
     const db = this.getDbSync();
     const result = await db.getAllAsync<{ key: string }>(STATEMENT_GET_ALL_KEYS);
     return result.map(({ key }) => key);
@@ -102,15 +149,33 @@ export class SQLiteStorage {
    * Clears all key-value pairs from the storage asynchronously.
    */
   async clearAsync(): Promise<boolean> {
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      const cleared = kvStore.clear();
+      await kvStore.scheduleFlushAsync();
+      return cleared;
+    }
     const db = this.getDbSync();
     const result = await db.runAsync(STATEMENT_CLEAR);
     return result.changes > 0;
   }
 
+  /**
+   * Commits the pending writes to the database asynchronously.
+   */
+  async flushAsync(): Promise<void> {
+    await this.kvStore?.flushAsync();
+  }
+
   /**
    * Closes the database connection asynchronously.
    */
   async closeAsync(): Promise<void> {
+    if (this.kvStore) {
+      const kvStore = this.kvStore;
+      this.kvStore = undefined;
+      await kvStore.closeAsync();
+    }
     if (this.db) {
       await this.db.closeAsync();
       this.db = null;
@@ -126,6 +191,10 @@ export class SQLiteStorage {
    */
   getItemSync(key: string): string | null {
     checkValidInput(key);
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      return kvStore.getItem(key);
+    }
     const db = this.getDbSync();
     const result = db.getFirstSync<{ value: string }>(STATEMENT_GET, key);
     return result?.value ?? null;
@@ -137,6 +206,12 @@ export class SQLiteStorage {
    */
   setItemSync(key: string, value: string | SQLiteStorageSetItemUpdateFunction): void {
     checkValidInput(key, value);
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      SQLiteStorage.setKVStoreItem(kvStore, key, value);
+      kvStore.flushSync();
+      return;
+    }
     const db = this.getDbSync();
 
     if (typeof value === 'function') {
@@ -158,6 +233,12 @@ export class SQLiteStorage {
    */
   removeItemSync(key: string): boolean {
     checkValidInput(key);
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      const removed = kvStore.removeItem(key);
+      kvStore.flushSync();
+      return removed;
+    }
     const db = this.getDbSync();
     const result = db.runSync(STATEMENT_REMOVE, key);
     return result.changes > 0;
@@ -167,6 +248,10 @@ export class SQLiteStorage {
    * Retrieves all keys stored in the storage synchronously.
    */
   getAllKeysSync(): string[] {
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      return kvStore.getAllKeys();
+    }
     const db = this.getDbSync();
     const result = db.getAllSync<{ key: string }>(STATEMENT_GET_ALL_KEYS);
     return result.map(({ key }) => key);
@@ -176,15 +261,33 @@ export class SQLiteStorage {
    * Clears all key-value pairs from the storage synchronously.
    */
   clearSync(): boolean {
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      const cleared = kvStore.clear();
+      kvStore.flushSync();
+      return cleared;
+    }
     const db = this.getDbSync();
     const result = db.runSync(STATEMENT_CLEAR);
     return result.changes > 0;
   }
 
+  /**
+   * Commits the pending writes to the database synchronously.
+   */
+  flushSync(): void {
+    this.kvStore?.flushSync();
+  }
+
   /**
    * Closes the database connection synchronously.
    */
   closeSync(): void {
+    if (this.kvStore) {
+      const kvStore = this.kvStore;
+      this.kvStore = undefined;
+      kvStore.closeSync();
+    }
     if (this.db) {
       this.db.closeSync();
       this.db = null;
@@ -236,21 +339,19 @@ export class SQLiteStorage {
    */
   async mergeItem(key: string, value: string): Promise<void> {
     checkValidInput(key, value);
-    await this.setItemAsync(key, (prevValue) => {
-      if (prevValue == null) {
-        return value;
-      }
-      const prevJSON = JSON.parse(prevValue);
-      const newJSON = JSON.parse(value);
-      const mergedJSON = SQLiteStorage.mergeDeep(prevJSON, newJSON);
-      return JSON.stringify(mergedJSON);
-    });
+    await this.setItemAsync(key, (prevValue) => SQLiteStorage.mergeJSON(prevValue, value));
   }
 
   /**
    * Retrieves the values associated with the given keys asynchronously.
    */
   async multiGet(keys: string[]): Promise<[string, string | null][]> {
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      keys.forEach((key) => checkValidInput(key));
+      const values = kvStore.multiGet(keys);
+      return keys.map((key, index) => [key, values[index]]);
+    }
     return Promise.all(
       keys.map(async (key): Promise<[string, string | null]> => {
         checkValidInput(key);
@@ -263,6 +364,13 @@ export class SQLiteStorage {
    * Sets multiple key-value pairs asynchronously.
    */
   async multiSet(keyValuePairs: [string, string][]): Promise<void> {
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      keyValuePairs.forEach(([key, value]) => checkValidInput(key, value));
+      kvStore.multiSet(keyValuePairs);
+      await kvStore.scheduleFlushAsync();
+      return;
+    }
     const db = this.getDbSync();
     await db.withExclusiveTransactionAsync(async (tx) => {
       for (const [key, value] of keyValuePairs) {
@@ -276,6 +384,13 @@ export class SQLiteStorage {
    * Removes the values associated with the given keys asynchronously.
    */
   async multiRemove(keys: string[]): Promise<void> {
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      keys.forEach((key) => checkValidInput(key));
+      kvStore.multiRemove(keys);
+      await kvStore.scheduleFlushAsync();
+      return;
+    }
     const db = this.getDbSync();
     await db.withExclusiveTransactionAsync(async (tx) => {
       for (const key of keys) {
@@ -290,6 +405,20 @@ export class SQLiteStorage {
    * If existing values are JSON objects, performs a deep merge.
    */
   async multiMerge(keyValuePairs: [string, string][]): Promise<void> {
+    const kvStore = this.getKVStoreSync();
+    if (kvStore) {
+      keyValuePairs.forEach(([key, value]) => checkValidInput(key, value));
+      const prevValues = kvStore.multiGet(keyValuePairs.map(([key]) => key));
+      // Later pairs of the same key merge into the result of the earlier ones.
+      const mergedValues = new Map<string, string>();
+      keyValuePairs.forEach(([key, value], index) => {
+        const prevValue = mergedValues.get(key) ?? prevValues[index];
+        mergedValues.set(key, SQLiteStorage.mergeJSON(prevValue, value));
+      });
+      kvStore.multiSet([...mergedValues]);
+      await kvStore.scheduleFlushAsync();
+      return;
+    }
     const db = this.getDbSync();
     await db.withExclusiveTransactionAsync(async (tx) => {
       for (const [key, value] of keyValuePairs) {
@@ -327,6 +456,40 @@ export class SQLiteStorage {
     return this.db;
   }
 
+  private getKVStoreSync(): SQLiteKVStore | null {
+    if (this.kvStore === undefined) {
+      this.kvStore = this.getDbSync().openKVStoreSync(TABLE_NAME, this.options.flushInterval ?? 0);
+    }
+    return this.kvStore;
+  }
+
+  private static setKVStoreItem(
+    kvStore: SQLiteKVStore,
+    key: string,
+    value: string | SQLiteStorageSetItemUpdateFunction
+  ) {
+    if (typeof value === 'function') {
+      // The native store is the only writer of the table and is updated synchronously,
+      // so reading and writing here is atomic without a transaction.
+      const nextValue = value(kvStore.getItem(key));
+      checkValidInput(key, nextValue);
+      kvStore.setItem(key, nextValue);
+      return;
+    }
+    kvStore.setItem(key, value);
+  }
+
+  /**
+   * Merge a JSON string into the previous one, or return it as-is if there is no previous value.
+   */
+  private static mergeJSON(prevValue: string | null, value: string): string {
+    if (prevValue == null) {
+      return value;
+    }
+    const mergedJSON = SQLiteStorage.mergeDeep(JSON.parse(prevValue), JSON.parse(value));
+    return JSON.stringify(mergedJSON);
+  }
+
   private maybeMigrateDbSync(db: SQLiteDatabase) {
     db.withTransactionSync(() => {
       const result = db.getFirstSync<{ user_version: number }>('PRAGMA user_version');
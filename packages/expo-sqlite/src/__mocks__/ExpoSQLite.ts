@@ -27,8 +27,16 @@ export default {
     ),
 
   NativeStatement: jest.fn().mockImplementation(() => new NativeStatement()),
+
+  NativeBlob: jest.fn().mockImplementation(() => new NativeBlob()),
 };
 
+/**
+ * The native key-value engine is only available on some platforms.
+ * Tests of that path add it to the module, e.g. `{ ...mock.default, NativeKVStore: mock.NativeKVStoreMock }`.
+ */
+export const NativeKVStoreMock = jest.fn().mockImplementation(() => new NativeKVStore());
+
 //#region async sqlite3
 
 /**
@@ -65,6 +73,23 @@ class NativeDatabase {
     .mockImplementation(async (nativeStatement: NativeStatement, source: string) => {
       nativeStatement.sqlite3Stmt = this.sqlite3Db.prepare(source);
     });
+  openKVStoreAsync = jest
+    .fn()
+    .mockImplementation(async (nativeKVStore: NativeKVStore, tableName: string) =>
+      nativeKVStore.open(this.sqlite3Db, tableName)
+    );
+  openBlobAsync = jest
+    .fn()
+    .mockImplementation(
+      async (
+        nativeBlob: NativeBlob,
+        databaseName: string,
+        tableName: string,
+        columnName: string,
+        rowId: number,
+        readOnly: boolean
+      ) => nativeBlob.open(this.sqlite3Db, databaseName, tableName, columnName, rowId, readOnly)
+    );
 
   //#endregion
 
@@ -80,6 +105,23 @@ class NativeDatabase {
   prepareSync = jest.fn().mockImplementation((nativeStatement: NativeStatement, source: string) => {
     nativeStatement.sqlite3Stmt = this.sqlite3Db.prepare(source);
   });
+  openKVStoreSync = jest
+    .fn()
+    .mockImplementation((nativeKVStore: NativeKVStore, tableName: string) =>
+      nativeKVStore.open(this.sqlite3Db, tableName)
+    );
+  openBlobSync = jest
+    .fn()
+    .mockImplementation(
+      (
+        nativeBlob: NativeBlob,
+        databaseName: string,
+        tableName: string,
+        columnName: string,
+        rowId: number,
+        readOnly: boolean
+      ) => nativeBlob.open(this.sqlite3Db, databaseName, tableName, columnName, rowId, readOnly)
+    );
 
   //#endregion
 }
@@ -216,6 +258,246 @@ class NativeStatement {
   };
 }
 
+/**
+ * Emulates the incremental blob I/O handle on top of plain queries, since better-sqlite3 does not expose `sqlite3_blob_open()`.
+ * Range checks mirror the native implementation.
+ */
+class NativeBlob {
+  private sqlite3Db: sqlite3.Database | null = null;
+  private location: { table: string; column: string; rowId: number; readOnly: boolean } | null =
+    null;
+  private isClosed = false;
+
+  public open(
+    sqlite3Db: sqlite3.Database,
+    databaseName: string,
+    tableName: string,
+    columnName: string,
+    rowId: number,
+    readOnly: boolean
+  ) {
+    this._assertNotClosed();
+    if (this.location != null) {
+      throw new Error('The blob handle is already opened. Use reopen to move it to another row');
+    }
+    this.sqlite3Db = sqlite3Db;
+    this.location = {
+      table: `"${databaseName}"."${tableName}"`,
+      column: `"${columnName}"`,
+      rowId,
+      readOnly,
+    };
+    this._getValue();
+  }
+
+  //#region Asynchronous API
+
+  public getSizeAsync = jest.fn().mockImplementation(async () => this._getValue().byteLength);
+  public readAsync = jest
+    .fn()
+    .mockImplementation(async (database: NativeDatabase, offset: number, length: number) => {
+      const value = this._getValue();
+      const readLength = this._getReadLength(value, offset, length);
+      return new Uint8Array(value.subarray(offset, offset + readLength));
+    });
+  public writeAsync = jest
+    .fn()
+    .mockImplementation(async (database: NativeDatabase, data: Uint8Array, offset: number) =>
+      this._write(data, offset)
+    );
+  public reopenAsync = jest
+    .fn()
+    .mockImplementation(async (database: NativeDatabase, rowId: number) => this._reopen(rowId));
+  public closeAsync = jest.fn().mockImplementation(async (database: NativeDatabase) => {
+    this._close();
+  });
+
+  //#endregion
+
+  //#region Synchronous API
+
+  public getSizeSync = jest.fn().mockImplementation(() => this._getValue().byteLength);
+  public readSync = jest
+    .fn()
+    .mockImplementation((database: NativeDatabase, buffer: Uint8Array, offset: number) => {
+      const value = this._getValue();
+      const readLength = this._getReadLength(value, offset, buffer.byteLength);
+      buffer.set(value.subarray(offset, offset + readLength));
+      return readLength;
+    });
+  public writeSync = jest
+    .fn()
+    .mockImplementation((database: NativeDatabase, data: Uint8Array, offset: number) =>
+      this._write(data, offset)
+    );
+  public reopenSync = jest
+    .fn()
+    .mockImplementation((database: NativeDatabase, rowId: number) => this._reopen(rowId));
+  public closeSync = jest.fn().mockImplementation((database: NativeDatabase) => {
+    this._close();
+  });
+
+  //#endregion
+
+  private _getValue = (): Buffer => {
+    this._assertNotClosed();
+    assert(this.sqlite3Db && this.location);
+    const { table, column, rowId } = this.location;
+    const row = this.sqlite3Db
+      .prepare(`SELECT ${column} AS value FROM ${table} WHERE rowid = ?`)
+      .get(rowId) as { value: unknown } | undefined;
+    if (row == null) {
+      throw new Error('no such rowid: ' + rowId);
+    }
+    if (!Buffer.isBuffer(row.value)) {
+      throw new Error('cannot open value of type ' + typeof row.value);
+    }
+    return row.value;
+  };
+
+  private _getReadLength = (value: Buffer, offset: number, length: number): number => {
+    if (length < 0) {
+      throw new Error(`Length ${length} must not be negative`);
+    }
+    if (offset < 0 || offset > value.byteLength) {
+      throw new Error(`Offset ${offset} is out of range of the blob with size ${value.byteLength}`);
+    }
+    return Math.min(length, value.byteLength - offset);
+  };
+
+  private _write = (data: Uint8Array, offset: number) => {
+    const value = this._getValue();
+    assert(this.sqlite3Db && this.location);
+    if (this.location.readOnly) {
+      throw new Error('attempt to write a readonly database');
+    }
+    if (offset < 0 || offset + data.byteLength > value.byteLength) {
+      throw new Error('SQL logic error');
+    }
+    value.set(data, offset);
+    const { table, column, rowId } = this.location;
+    this.sqlite3Db.prepare(`UPDATE ${table} SET ${column} = ? WHERE rowid = ?`).run(value, rowId);
+  };
+
+  private _reopen = (rowId: number) => {
+    assert(this.location);
+    this.location.rowId = rowId;
+    this._getValue();
+  };
+
+  private _close = () => {
+    this._assertNotClosed();
+    this.isClosed = true;
+  };
+
+  private _assertNotClosed = () => {
+    if (this.isClosed) {
+      throw new Error('Access to closed resource');
+    }
+  };
+}
+
+/**
+ * Mirrors the native write-back engine: the table is loaded into memory on open, and writes stay pending until a flush.
+ */
+class NativeKVStore {
+  private sqlite3Db: sqlite3.Database | null = null;
+  private tableName = '';
+  private readonly entries = new Map<string, string>();
+  private readonly dirtyKeys = new Set<string>();
+  private cleared = false;
+
+  public open(sqlite3Db: sqlite3.Database, tableName: string) {
+    this.sqlite3Db = sqlite3Db;
+    this.tableName = `"${tableName}"`;
+    const rows = sqlite3Db.prepare(`SELECT key, value FROM ${this.tableName}`).all() as {
+      key: string;
+      value: string;
+    }[];
+    for (const { key, value } of rows) {
+      this.entries.set(key, value);
+    }
+  }
+
+  //#region Asynchronous API
+
+  public flushAsync = jest.fn().mockImplementation(async (database: NativeDatabase) => {
+    this._flush();
+  });
+  public closeAsync = jest.fn().mockImplementation(async (database: NativeDatabase) => {
+    this._flush();
+  });
+
+  //#endregion
+
+  //#region Synchronous API
+
+  public getItem = jest.fn().mockImplementation((key: string) => this.entries.get(key) ?? null);
+  public multiGet = jest
+    .fn()
+    .mockImplementation((keys: string[]) => keys.map((key) => this.entries.get(key) ?? null));
+  public setItem = jest.fn().mockImplementation((key: string, value: string) => {
+    this.entries.set(key, value);
+    this.dirtyKeys.add(key);
+  });
+  public multiSet = jest.fn().mockImplementation((keys: string[], values: string[]) => {
+    keys.forEach((key, index) => this.setItem(key, values[index]));
+  });
+  public removeItem = jest.fn().mockImplementation((key: string) => {
+    if (!this.entries.delete(key)) {
+      return false;
+    }
+    this.dirtyKeys.add(key);
+    return true;
+  });
+  public multiRemove = jest.fn().mockImplementation((keys: string[]) => {
+    keys.forEach((key) => this.removeItem(key));
+  });
+  public getAllKeys = jest.fn().mockImplementation(() => [...this.entries.keys()]);
+  public clear = jest.fn().mockImplementation(() => {
+    const hadEntries = this.entries.size > 0;
+    this.entries.clear();
+    this.dirtyKeys.clear();
+    this.cleared = true;
+    return hadEntries;
+  });
+  public hasPendingWrites = jest
+    .fn()
+    .mockImplementation(() => this.cleared || this.dirtyKeys.size > 0);
+  public flushSync = jest.fn().mockImplementation((database: NativeDatabase) => {
+    this._flush();
+  });
+  public closeSync = jest.fn().mockImplementation((database: NativeDatabase) => {
+    this._flush();
+  });
+
+  //#endregion
+
+  private _flush = () => {
+    assert(this.sqlite3Db);
+    const db = this.sqlite3Db;
+    const upsert = db.prepare(
+      `INSERT INTO ${this.tableName} (key, value) VALUES (?, ?) ON CONFLICT(key) DO UPDATE SET value = excluded.value`
+    );
+    const remove = db.prepare(`DELETE FROM ${this.tableName} WHERE key = ?`);
+    db.transaction(() => {
+      if (this.cleared) {
+        db.prepare(`DELETE FROM ${this.tableName}`).run();
+      }
+      for (const key of this.dirtyKeys) {
+        const value = this.entries.get(key);
+        if (value != null) {
+          upsert.run(key, value);
+        } else {
+          remove.run(key);
+        }
+      }
+    })();
+    this.cleared = false;
+    this.dirtyKeys.clear();
+  };
+}
+
 //#endregion
 
 function normalizeSQLite3Args(
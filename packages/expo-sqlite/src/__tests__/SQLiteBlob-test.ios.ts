@@ -0,0 +1,83 @@
+import { SQLiteBlob } from '../SQLiteBlob';
+import { openDatabaseAsync, SQLiteDatabase } from '../SQLiteDatabase';
+
+jest.mock('../ExpoSQLite', () => require('../__mocks__/ExpoSQLite'));
+
+describe(SQLiteBlob, () => {
+  let db: SQLiteDatabase;
+  let rowId: number;
+
+  beforeEach(async () => {
+    db = await openDatabaseAsync(':memory:');
+    await db.execAsync(
+      'CREATE TABLE IF NOT EXISTS blobs (id INTEGER PRIMARY KEY NOT NULL, data BLOB NOT NULL);'
+    );
+    const result = await db.runAsync('INSERT INTO blobs (data) VALUES (zeroblob(?))', 8);
+    rowId = result.lastInsertRowId;
+  });
+
+  afterEach(async () => {
+    await db.closeAsync();
+  });
+
+  it('should write and read chunks asynchronously', async () => {
+    const blob = await db.openBlobAsync('blobs', 'data', rowId);
+    expect(await blob.getSizeAsync()).toBe(8);
+    await blob.writeAsync(new Uint8Array([1, 2, 3, 4]), 0);
+    await blob.writeAsync(new Uint8Array([5, 6, 7, 8]), 4);
+
+    const buffer = new Uint8Array(3);
+    expect(await blob.readAsync(buffer, 2)).toBe(3);
+    expect(buffer).toEqual(new Uint8Array([3, 4, 5]));
+    await blob.closeAsync();
+
+    const row = await db.getFirstAsync<{ data: Uint8Array }>('SELECT data FROM blobs');
+    expect(new Uint8Array(row!.data)).toEqual(new Uint8Array([1, 2, 3, 4, 5, 6, 7, 8]));
+  });
+
+  it('should write and read chunks synchronously', () => {
+    const blob = db.openBlobSync('blobs', 'data', rowId);
+    blob.writeSync(new Uint8Array([9, 9]), 6);
+
+    const buffer = new Uint8Array(4);
+    expect(blob.readSync(buffer, 4)).toBe(4);
+    expect(buffer).toEqual(new Uint8Array([0, 0, 9, 9]));
+    blob.closeSync();
+  });
+
+  it('should read only up to the end of the blob', async () => {
+    const blob = await db.openBlobAsync('blobs', 'data', rowId);
+    const buffer = new Uint8Array(16);
+    expect(await blob.readAsync(buffer, 6)).toBe(2);
+    expect(await blob.readAsync(buffer, 8)).toBe(0);
+    await expect(blob.readAsync(buffer, 9)).rejects.toThrow();
+    await blob.closeAsync();
+  });
+
+  it('should not grow the blob', async () => {
+    const blob = await db.openBlobAsync('blobs', 'data', rowId);
+    await expect(blob.writeAsync(new Uint8Array(4), 6)).rejects.toThrow();
+    await blob.closeAsync();
+  });
+
+  it('should reject writes to a read-only blob', async () => {
+    const blob = await db.openBlobAsync('blobs', 'data', rowId, { readOnly: true });
+    await expect(blob.writeAsync(new Uint8Array([1]), 0)).rejects.toThrow();
+    await blob.closeAsync();
+  });
+
+  it('should move the handle to another row', async () => {
+    const { lastInsertRowId } = await db.runAsync('INSERT INTO blobs (data) VALUES (zeroblob(2))');
+    const blob = await db.openBlobAsync('blobs', 'data', rowId);
+    await blob.reopenAsync(lastInsertRowId);
+    expect(await blob.getSizeAsync()).toBe(2);
+    await blob.closeAsync();
+  });
+
+  it('should throw when accessing a closed blob', async () => {
+    const blob = await db.openBlobAsync('blobs', 'data', rowId);
+    await blob.closeAsync();
+    await expect(blob.getSizeAsync()).rejects.toThrow();
+    expect(() => blob.closeSync()).toThrow();
+  });
+});
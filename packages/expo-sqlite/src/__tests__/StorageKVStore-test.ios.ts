@@ -0,0 +1,109 @@
+// @ts-ignore-next-line: no @types/node
+import fs from 'fs/promises';
+
+import { openDatabaseSync, SQLiteDatabase } from '../SQLiteDatabase';
+import { SQLiteStorage } from '../Storage';
+
+jest.mock('../ExpoSQLite', () => {
+  const mock = require('../__mocks__/ExpoSQLite');
+  return {
+    __esModule: true,
+    default: { ...mock.default, NativeKVStore: mock.NativeKVStoreMock },
+  };
+});
+
+const DATABASE_NAME = 'TestKVStorage';
+
+describe('SQLiteStorage with the native key-value engine', () => {
+  let storage: SQLiteStorage;
+  let observer: SQLiteDatabase;
+
+  function getCommittedValue(key: string): string | null {
+    return (
+      observer.getFirstSync<{ value: string }>('SELECT value FROM storage WHERE key = ?', key)
+        ?.value ?? null
+    );
+  }
+
+  beforeEach(() => {
+    storage = new SQLiteStorage(DATABASE_NAME, { flushInterval: 10 });
+    storage.clearSync();
+    // A separate connection only sees the writes that are committed.
+    observer = openDatabaseSync(DATABASE_NAME);
+  });
+
+  afterEach(async () => {
+    observer.closeSync();
+    await storage.clearAsync();
+    await storage.closeAsync();
+  });
+
+  afterAll(async () => {
+    await fs.unlink(DATABASE_NAME).catch(() => {});
+  });
+
+  it('should serve reads from memory', async () => {
+    await storage.setItemAsync('key1', 'value1');
+    expect(storage.getItemSync('key1')).toBe('value1');
+    expect(await storage.getItemAsync('missing')).toBeNull();
+    expect(storage.getAllKeysSync()).toEqual(['key1']);
+  });
+
+  it('should commit synchronous writes before returning', () => {
+    storage.setItemSync('key1', 'value1');
+    expect(getCommittedValue('key1')).toBe('value1');
+
+    storage.setItemSync('key1', (prevValue) => `${prevValue}_updated`);
+    expect(getCommittedValue('key1')).toBe('value1_updated');
+
+    expect(storage.removeItemSync('key1')).toBe(true);
+    expect(getCommittedValue('key1')).toBeNull();
+  });
+
+  it('should commit coalesced asynchronous writes once resolved', async () => {
+    const first = storage.setItemAsync('key1', 'value1');
+    const second = storage.setItemAsync('key1', 'value2');
+    expect(getCommittedValue('key1')).toBeNull();
+    await Promise.all([first, second]);
+    expect(getCommittedValue('key1')).toBe('value2');
+  });
+
+  it('should commit pending writes on flush', async () => {
+    const pendingWrite = storage.setItemAsync('key1', 'value1');
+    await storage.flushAsync();
+    expect(getCommittedValue('key1')).toBe('value1');
+    await pendingWrite;
+  });
+
+  it('should support the multi methods', async () => {
+    await storage.multiSet([
+      ['key1', 'value1'],
+      ['key2', '{"a":1}'],
+    ]);
+    await storage.multiMerge([['key2', '{"b":2}']]);
+    expect(await storage.multiGet(['key1', 'key2', 'key3'])).toEqual([
+      ['key1', 'value1'],
+      ['key2', '{"a":1,"b":2}'],
+      ['key3', null],
+    ]);
+
+    await storage.multiRemove(['key1']);
+    expect(getCommittedValue('key1')).toBeNull();
+    expect(getCommittedValue('key2')).toBe('{"a":1,"b":2}');
+  });
+
+  it('should keep the data after reopening', async () => {
+    storage.setItemSync('key1', 'value1');
+    await storage.closeAsync();
+
+    storage = new SQLiteStorage(DATABASE_NAME);
+    expect(storage.getItemSync('key1')).toBe('value1');
+  });
+
+  it('should clear the committed data', () => {
+    storage.setItemSync('key1', 'value1');
+    expect(storage.clearSync()).toBe(true);
+    expect(getCommittedValue('key1')).toBeNull();
+    expect(storage.getAllKeysSync()).toEqual([]);
+  });
+});
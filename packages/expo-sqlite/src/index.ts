@@ -1,3 +1,4 @@
+export * from './SQLiteBlob';
 export * from './SQLiteDatabase';
 export * from './SQLiteStatement';
 export * from './hooks';